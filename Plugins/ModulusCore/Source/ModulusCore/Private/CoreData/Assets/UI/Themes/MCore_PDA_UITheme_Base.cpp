@@ -1,3 +1,16 @@
 // Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
 
 #include "CoreData/Assets/UI/Themes/MCore_PDA_UITheme_Base.h"
+
+const TArray<TSubclassOf<UCommonTextStyle>>& UMCore_PDA_UITheme_Base::GetTextStyles(EMCore_ThemeTextRole Role) const
+{
+	switch (Role)
+	{
+	case EMCore_ThemeTextRole::Heading: return HeadingTextStyle;
+	case EMCore_ThemeTextRole::Label: return LabelTextStyle;
+	case EMCore_ThemeTextRole::Value: return ValueTextStyle;
+	case EMCore_ThemeTextRole::Description: return DescriptionTextStyle;
+	case EMCore_ThemeTextRole::MAX: break;
+	}
+	return LabelTextStyle;
+}
@@ -124,6 +124,15 @@ const TArray<UMCore_DA_SettingsCollection*>& UMCore_CoreSettings::GetAllSettings
 	return EmptyArray;
 }
 
+TArray<UMCore_DA_SettingDefinition*> UMCore_CoreSettings::GetAllSettingDefinitions() const
+{
+	if (UMCore_SettingsCollectionSubsystem* Subsystem = FindRuntimeSubsystem())
+	{
+		return Subsystem->GetAllSettingDefinitions();
+	}
+	return {};
+}
+
 UMCore_DA_SettingDefinition* UMCore_CoreSettings::FindSettingDefinitionByTag(
 	const FGameplayTag& SettingTag) const
 {
@@ -187,7 +196,9 @@ void UMCore_CoreSettings::PostEditChangeProperty(FPropertyChangedEvent& Property
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
 	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
-	if (PropertyName == GET_MEMBER_NAME_CHECKED(UMCore_CoreSettings, SettingsCollections))
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UMCore_CoreSettings, SettingsCollections)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UMCore_CoreSettings, BakedSettingsRegistry)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UMCore_CoreSettings, bUseBakedSettingsRegistryInEditor))
 	{
 		InvalidateCollectionCache();
 	}
@@ -1,9 +1,13 @@
-// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
 
 #include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
 
 #include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
+#include "CoreData/Settings/MCore_SettingDependencyGraph.h"
+#include "CoreData/Settings/MCore_SettingsApplyTelemetry.h"
+#include "CoreData/Settings/MCore_SettingsCollectionSubsystem.h"
 #include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Logging/StatModulusSettings.h"
 #include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
 #include "CoreData/Libraries/MCore_EventFunctionLibrary.h"
 #include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
@@ -28,6 +32,7 @@
 #include "Scalability.h"
 
 FOnSettingsConfirmationRequired UMCore_GameSettingsLibrary::OnSettingsConfirmationRequired;
+FOnSettingDependentsUpdated UMCore_GameSettingsLibrary::OnSettingDependentsUpdated;
 
 // ============================================================================
 // CONSOLE VARIABLES
@@ -110,11 +115,360 @@ static TAutoConsoleVariable<int32> CVarLargeText(
 	ECVF_Default
 	);
 
+// ============================================================================
+// SCALABILITY BATCH
+// ============================================================================
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scalability Pushes"), STAT_MCore_ScalabilityPushes, STATGROUP_ModulusSettings);
+DECLARE_CYCLE_STAT(TEXT("ApplyAllSettingsToEngine"), STAT_MCore_ApplyAllSettingsToEngine, STATGROUP_ModulusSettings);
+
+namespace
+{
+	using FMCore_QualityMember = int32 Scalability::FQualityLevels::*;
+
+	/* ScalabilityQuality child setters keyed by the literal FQualityLevels member name.
+	 * Shared by the ApplyViaNamedSetter child bucket and CascadeScalabilityValuesToSave
+	 * so the two can't drift. Listed alphabetically. */
+	const TMap<FName, FMCore_QualityMember>& GetScalabilityChildMembers()
+	{
+		static const TMap<FName, FMCore_QualityMember> Members = {
+			{ TEXT("AntiAliasingQuality"),       &Scalability::FQualityLevels::AntiAliasingQuality },
+			{ TEXT("EffectsQuality"),            &Scalability::FQualityLevels::EffectsQuality },
+			{ TEXT("FoliageQuality"),            &Scalability::FQualityLevels::FoliageQuality },
+			{ TEXT("GlobalIlluminationQuality"), &Scalability::FQualityLevels::GlobalIlluminationQuality },
+			{ TEXT("LandscapeQuality"),          &Scalability::FQualityLevels::LandscapeQuality },
+			{ TEXT("PostProcessQuality"),        &Scalability::FQualityLevels::PostProcessQuality },
+			{ TEXT("ReflectionQuality"),         &Scalability::FQualityLevels::ReflectionQuality },
+			{ TEXT("ShadingQuality"),            &Scalability::FQualityLevels::ShadingQuality },
+			{ TEXT("ShadowQuality"),             &Scalability::FQualityLevels::ShadowQuality },
+			{ TEXT("TextureQuality"),            &Scalability::FQualityLevels::TextureQuality },
+			{ TEXT("ViewDistanceQuality"),       &Scalability::FQualityLevels::ViewDistanceQuality }
+		};
+		return Members;
+	}
+
+	/* Governor levels (group name -> level) layered over GUS->ScalabilityQuality when pushing to
+	 * the engine. GUS keeps the player's levels, so no GameUserSettings save can persist these. */
+	TMap<FName, int32> GMCore_TransientScalabilityLevels;
+
+	Scalability::FQualityLevels GetEngineQualityLevels(const UGameUserSettings& GUS)
+	{
+		Scalability::FQualityLevels Levels = GUS.ScalabilityQuality;
+		for (const TPair<FName, int32>& Entry : GMCore_TransientScalabilityLevels)
+		{
+			if (const FMCore_QualityMember* Member = GetScalabilityChildMembers().Find(Entry.Key))
+			{
+				Levels.*(*Member) = Entry.Value;
+			}
+		}
+		return Levels;
+	}
+
+	void PushQualityLevels(const UGameUserSettings& GUS)
+	{
+		Scalability::SetQualityLevels(GetEngineQualityLevels(GUS));
+		INC_DWORD_STAT(STAT_MCore_ScalabilityPushes);
+	}
+
+	/* ApplySettings pushes GUS's own (player) levels and saves them; put the governed ones back */
+	void ApplyGameUserSettings(UGameUserSettings& GUS)
+	{
+		GUS.ApplySettings(false);
+		if (!GMCore_TransientScalabilityLevels.IsEmpty())
+		{
+			PushQualityLevels(GUS);
+		}
+	}
+
+	/* Deferred work accumulated while an FScalabilityBatchScope is open. Game-thread
+	 * only, like the rest of the library. Every Scalability::SetQualityLevels re-sets
+	 * the whole sg.* CVar family and invalidates render state, so a preset change or
+	 * boot replay that touched ten children used to pay that ten times. */
+	struct FMCore_ScalabilityBatchState
+	{
+		int32 Depth{0};
+		bool bPendingPush{false};
+		bool bPendingMarkCustom{false};
+		bool bPendingEvent{false};
+		TWeakObjectPtr<const UObject> WorldContext;
+	};
+
+	FMCore_ScalabilityBatchState GMCore_ScalabilityBatch;
+
+#if !UE_BUILD_SHIPPING
+	/* Lets ModulusSettingsBenchmark time the per-child push path against the batched one */
+	TAutoConsoleVariable<int32> CVarBatchScalabilityPushes(
+		TEXT("Modulus.Settings.BatchScalabilityPushes"),
+		1,
+		TEXT("Coalesce scalability child pushes per apply pass (0=push on every child write, 1=batched, default: 1). Non-shipping only."),
+		ECVF_Cheat
+		);
+#endif
+}
+
+UMCore_GameSettingsLibrary::FScalabilityBatchScope::FScalabilityBatchScope(const UObject* WorldContextObject)
+{
+#if !UE_BUILD_SHIPPING
+	if (CVarBatchScalabilityPushes.GetValueOnGameThread() == 0) { return; }
+#endif
+
+	bOpened = true;
+	if (GMCore_ScalabilityBatch.Depth++ == 0)
+	{
+		GMCore_ScalabilityBatch.WorldContext = WorldContextObject;
+	}
+}
+
+UMCore_GameSettingsLibrary::FScalabilityBatchScope::~FScalabilityBatchScope()
+{
+	if (!bOpened) { return; }
+
+	check(GMCore_ScalabilityBatch.Depth > 0);
+	if (--GMCore_ScalabilityBatch.Depth > 0) { return; }
+
+	const FMCore_ScalabilityBatchState Pending = GMCore_ScalabilityBatch;
+	GMCore_ScalabilityBatch = FMCore_ScalabilityBatchState();
+
+	const UObject* WorldContextObject = Pending.WorldContext.Get();
+
+	if (Pending.bPendingPush)
+	{
+		if (const UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+		{
+			PushQualityLevels(*GUS);
+		}
+	}
+
+	if (Pending.bPendingMarkCustom)
+	{
+		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
+	}
+
+	if (Pending.bPendingEvent && WorldContextObject)
+	{
+		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
+			WorldContextObject,
+			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
+			EMCore_EventScope::Local);
+	}
+}
+
+void UMCore_GameSettingsLibrary::CommitScalabilityChange(const UObject* WorldContextObject, bool bPushToEngine)
+{
+	if (GMCore_ScalabilityBatch.Depth > 0)
+	{
+		GMCore_ScalabilityBatch.bPendingPush |= bPushToEngine;
+		GMCore_ScalabilityBatch.bPendingMarkCustom = true;
+		GMCore_ScalabilityBatch.bPendingEvent = true;
+		if (!GMCore_ScalabilityBatch.WorldContext.IsValid())
+		{
+			GMCore_ScalabilityBatch.WorldContext = WorldContextObject;
+		}
+		return;
+	}
+
+	if (bPushToEngine)
+	{
+		if (const UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+		{
+			PushQualityLevels(*GUS);
+		}
+	}
+
+	MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
+	UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
+		WorldContextObject,
+		MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
+		EMCore_EventScope::Local);
+}
+
+// ============================================================================
+// APPLIED VALUE CACHE
+// ============================================================================
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Settings Applied"), STAT_MCore_SettingsApplied, STATGROUP_ModulusSettings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Settings Skipped (Unchanged)"), STAT_MCore_SettingsSkipped, STATGROUP_ModulusSettings);
+
+namespace
+{
+	struct FMCore_AppliedSettingValue
+	{
+		float FloatValue{0.0f};
+		int32 IntValue{0};
+		bool bBoolValue{false};
+	};
+
+	/* Last value pushed through ApplySettingToEngine per definition. Lets the
+	 * ApplyAllSettingsToEngine replay (boot, ReloadAndApplyFromDisk, revert) skip
+	 * definitions whose engine targets already hold the persisted value, so a
+	 * one-setting revert costs one engine write instead of a full re-apply.
+	 * Weak keys so entries don't pin definitions across collection reloads. */
+	TMap<TWeakObjectPtr<const UMCore_DA_SettingDefinition>, FMCore_AppliedSettingValue> GMCore_AppliedValues;
+
+	/* Audio device the sound-targeted entries above were pushed to. A new device
+	 * (PIE restart, device swap) starts with no class overrides or pushed mixes. */
+	Audio::FDeviceId GMCore_AppliedAudioDeviceId = INDEX_NONE;
+
+	bool MatchesAppliedValue(const UMCore_DA_SettingDefinition* Setting,
+		float FloatValue, int32 IntValue, bool bBoolValue)
+	{
+		const FMCore_AppliedSettingValue* Applied = GMCore_AppliedValues.Find(Setting);
+		if (!Applied) { return false; }
+
+		switch (Setting->SettingType)
+		{
+		case EMCore_SettingType::Slider:   return FMath::IsNearlyEqual(Applied->FloatValue, FloatValue);
+		case EMCore_SettingType::Dropdown: return Applied->IntValue == IntValue;
+		case EMCore_SettingType::Toggle:   return Applied->bBoolValue == bBoolValue;
+		default:                           return false;
+		}
+	}
+
+	/* Drops entries whose engine target was rewritten outside ApplySettingToEngine.
+	 * Stale weak keys are purged on the same pass. */
+	template<typename TPredicate>
+	void ForgetAppliedValues(TPredicate&& Predicate)
+	{
+		for (auto It = GMCore_AppliedValues.CreateIterator(); It; ++It)
+		{
+			const UMCore_DA_SettingDefinition* Setting = It.Key().Get();
+			if (!Setting || Predicate(Setting))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	/* A preset change rewrites every FQualityLevels member on GUS directly. */
+	void ForgetAppliedScalabilityChildren()
+	{
+		const TMap<FName, FMCore_QualityMember>& ChildMembers = GetScalabilityChildMembers();
+		ForgetAppliedValues([&ChildMembers](const UMCore_DA_SettingDefinition* Setting)
+		{
+			return ChildMembers.Contains(Setting->NamedSetter);
+		});
+	}
+
+	void ForgetAppliedSoundValuesOnDeviceChange(const UObject* WorldContextObject)
+	{
+		const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(
+			WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+		if (!World) { return; }
+
+		const FAudioDeviceHandle DeviceHandle = World->GetAudioDevice();
+		if (!DeviceHandle) { return; }
+
+		if (DeviceHandle->DeviceID == GMCore_AppliedAudioDeviceId) { return; }
+		GMCore_AppliedAudioDeviceId = DeviceHandle->DeviceID;
+
+		ForgetAppliedValues([](const UMCore_DA_SettingDefinition* Setting)
+		{
+			return !Setting->SoundClass.IsNull() || !Setting->PushedSoundMix.IsNull();
+		});
+	}
+}
+
+void UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache()
+{
+	GMCore_AppliedValues.Reset();
+}
+
+void UMCore_GameSettingsLibrary::InvalidateAppliedSetting(const UMCore_DA_SettingDefinition* Setting)
+{
+	GMCore_AppliedValues.Remove(Setting);
+}
+
+// ============================================================================
+// RUNTIME SCALABILITY OVERRIDES
+// ============================================================================
+
+TArray<FName> UMCore_GameSettingsLibrary::GetScalabilityGroupNames()
+{
+	TArray<FName> GroupNames;
+	GetScalabilityChildMembers().GetKeys(GroupNames);
+	return GroupNames;
+}
+
+int32 UMCore_GameSettingsLibrary::GetActiveScalabilityLevel(FName GroupName)
+{
+	const FMCore_QualityMember* Member = GetScalabilityChildMembers().Find(GroupName);
+	const UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings();
+	if (!Member || !GUS) { return INDEX_NONE; }
+
+	if (const int32* TransientLevel = GMCore_TransientScalabilityLevels.Find(GroupName))
+	{
+		return *TransientLevel;
+	}
+	return GUS->ScalabilityQuality.*(*Member);
+}
+
+int32 UMCore_GameSettingsLibrary::ApplyTransientScalabilityLevels(const TMap<FName, int32>& Levels)
+{
+	if (GIsEditor && !IsRunningGame())
+	{
+		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+		if (CoreSettings && !CoreSettings->bApplyScalabilitySettingsInPIE) { return 0; }
+	}
+
+	UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings();
+	if (!GUS) { return 0; }
+
+	const TMap<FName, FMCore_QualityMember>& ChildMembers = GetScalabilityChildMembers();
+	TSet<FName> WrittenGroups;
+
+	for (const TPair<FName, int32>& Entry : Levels)
+	{
+		const FMCore_QualityMember* Member = ChildMembers.Find(Entry.Key);
+		if (!Member)
+		{
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("GameSettingsLibrary::ApplyTransientScalabilityLevels -- '%s' is not a ScalabilityQuality group"),
+				*Entry.Key.ToString());
+			continue;
+		}
+
+		const int32 ClampedLevel = FMath::Clamp(Entry.Value, 0, 3);
+		const int32 PlayerLevel = GUS->ScalabilityQuality.*(*Member);
+		const int32* TransientLevel = GMCore_TransientScalabilityLevels.Find(Entry.Key);
+		if ((TransientLevel ? *TransientLevel : PlayerLevel) == ClampedLevel) { continue; }
+
+		/* Back at the player's level the group needs no override */
+		if (ClampedLevel == PlayerLevel)
+		{
+			GMCore_TransientScalabilityLevels.Remove(Entry.Key);
+		}
+		else
+		{
+			GMCore_TransientScalabilityLevels.Add(Entry.Key, ClampedLevel);
+		}
+		WrittenGroups.Add(Entry.Key);
+	}
+
+	if (WrittenGroups.Num() == 0) { return 0; }
+
+	ForgetAppliedValues([&WrittenGroups](const UMCore_DA_SettingDefinition* Setting)
+	{
+		return WrittenGroups.Contains(Setting->NamedSetter);
+	});
+
+	if (GMCore_ScalabilityBatch.Depth > 0)
+	{
+		GMCore_ScalabilityBatch.bPendingPush = true;
+	}
+	else
+	{
+		PushQualityLevels(*GUS);
+	}
+
+	return WrittenGroups.Num();
+}
+
 // ============================================================================
 // INTERNAL HELPER
 // ============================================================================
 
-UMCore_PlayerSettingsSave* UMCore_GameSettingsLibrary::GetPlayerSave(const UObject* WorldContextObject)
+UMCore_PlayerSettingsSubsystem* UMCore_GameSettingsLibrary::GetPlayerSettingsSubsystem(
+	const UObject* WorldContextObject)
 {
 	if (!WorldContextObject) { return nullptr; }
 
@@ -125,10 +479,34 @@ UMCore_PlayerSettingsSave* UMCore_GameSettingsLibrary::GetPlayerSave(const UObje
 	const ULocalPlayer* LocalPlayer = World->GetFirstLocalPlayerFromController();
 	if (!LocalPlayer) { return nullptr; }
 
-	UMCore_PlayerSettingsSubsystem* SettingsSubsystem = LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>();
-	if (!SettingsSubsystem) { return nullptr; }
+	return LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>();
+}
+
+UMCore_PlayerSettingsSave* UMCore_GameSettingsLibrary::GetPlayerSave(const UObject* WorldContextObject)
+{
+	UMCore_PlayerSettingsSubsystem* SettingsSubsystem = GetPlayerSettingsSubsystem(WorldContextObject);
+	return SettingsSubsystem ? SettingsSubsystem->GetPlayerSettings() : nullptr;
+}
+
+FMCore_SettingsHistory* UMCore_GameSettingsLibrary::GetSettingsHistory(const UObject* WorldContextObject)
+{
+	UMCore_PlayerSettingsSubsystem* SettingsSubsystem = GetPlayerSettingsSubsystem(WorldContextObject);
+	return SettingsSubsystem ? &SettingsSubsystem->GetSettingsHistory() : nullptr;
+}
 
-	return SettingsSubsystem->GetPlayerSettings();
+namespace
+{
+	/* "A|B|C" payload for the SettingTags event parameter. */
+	FString JoinSettingTags(const TArray<FGameplayTag>& Tags)
+	{
+		TArray<FString> TagStrings;
+		TagStrings.Reserve(Tags.Num());
+		for (const FGameplayTag& Tag : Tags)
+		{
+			TagStrings.Add(Tag.ToString());
+		}
+		return FString::Join(TagStrings, TEXT("|"));
+	}
 }
 
 // ============================================================================
@@ -150,7 +528,7 @@ float UMCore_GameSettingsLibrary::GetSettingFloat(const UObject* WorldContextObj
 	if (const UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject))
 	{
 		float StoredValue = 0.f;
-		if (Save->GetFloatSetting(Setting->GetSaveKey(), StoredValue))
+		if (Save->GetFloatValue(Setting, StoredValue))
 		{
 			return StoredValue;
 		}
@@ -174,7 +552,7 @@ int32 UMCore_GameSettingsLibrary::GetSettingInt(const UObject* WorldContextObjec
 	if (const UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject))
 	{
 		int32 StoredValue = 0;
-		if (Save->GetIntSetting(Setting->GetSaveKey(), StoredValue))
+		if (Save->GetIntValue(Setting, StoredValue))
 		{
 			return StoredValue;
 		}
@@ -198,7 +576,7 @@ bool UMCore_GameSettingsLibrary::GetSettingBool(const UObject* WorldContextObjec
 	if (const UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject))
 	{
 		bool StoredValue = false;
-		if (Save->GetBoolSetting(Setting->GetSaveKey(), StoredValue))
+		if (Save->GetBoolValue(Setting, StoredValue))
 		{
 			return StoredValue;
 		}
@@ -212,89 +590,50 @@ bool UMCore_GameSettingsLibrary::GetSettingBool(const UObject* WorldContextObjec
 // ============================================================================
 
 template<typename TChangeStruct, typename TValue>
-void UMCore_GameSettingsLibrary::ApplySettingChanges_Internal(
+void UMCore_GameSettingsLibrary::StageSettingChanges_Internal(
 	const UObject* WorldContextObject,
+	FSettingsCommitContext& Context,
 	const TArray<TChangeStruct>& Changes,
-	bool bBypassConfirmation,
 	TFunctionRef<TValue(const UMCore_DA_SettingDefinition*, TValue)> ClampValue,
-	TFunctionRef<void(UMCore_PlayerSettingsSave*, const FString&, TValue)> SetCommitted,
+	TFunctionRef<void(UMCore_PlayerSettingsSave*, const UMCore_DA_SettingDefinition*, TValue)> SetCommitted,
 	TFunctionRef<void(const UMCore_DA_SettingDefinition*, TValue)> ApplyToEngine)
 {
-	if (!WorldContextObject || Changes.IsEmpty()) { return; }
-
-	UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject);
-	if (!Save)
-	{
-		UE_LOG(LogModulusSettings, Warning,
-			TEXT("GameSettingsLibrary::ApplySettingChanges -- failed to get PlayerSettingsSave"));
-		return;
-	}
-
-	TArray<FGameplayTag> AffectedTags;
-	TArray<FGameplayTag> ProcessedTags;
-	bool bAnyRequiresConfirmation{false};
-
 	for (const TChangeStruct& Change : Changes)
 	{
 		if (!Change.Setting)
 		{
 			UE_LOG(LogModulusSettings, Warning,
-				TEXT("GameSettingsLibrary::ApplySettingChanges -- null Setting in Changes, skipping"));
+				TEXT("GameSettingsLibrary::StageSettingChanges -- null Setting in Changes, skipping"));
 			continue;
 		}
 
-		const FString Key = Change.Setting->GetSaveKey();
 		const TValue ClampedVal = ClampValue(Change.Setting, Change.Value);
+		const bool bNeedsConfirmation = Change.Setting->bRequiresConfirmation && !Context.bBypassConfirmation;
 
-		SetCommitted(Save, Key, ClampedVal);
-		ApplyToEngine(Change.Setting, ClampedVal);
-
-		if (Change.Setting->bRequiresConfirmation && !bBypassConfirmation)
-		{
-			bAnyRequiresConfirmation = true;
-			AffectedTags.Add(Change.Setting->SettingTag);
-		}
-		else
+		/* Pre-change values: confirmation-gated settings feed the pending revert snapshot,
+		   everything else becomes one undo entry for this pass. */
+		if (Context.History)
 		{
-			ProcessedTags.Add(Change.Setting->SettingTag);
+			FMCore_SettingsSnapshot& Target = bNeedsConfirmation
+				? Context.History->PendingConfirmation : Context.UndoSnapshot;
+			if (!Target.Contains(Change.Setting))
+			{
+				CaptureSnapshotEntry(WorldContextObject, Target, Change.Setting);
+			}
 		}
-	}
 
-	if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
-	{
-		GUS->ApplySettings(false);
-	}
+		SetCommitted(Context.Save, Change.Setting, ClampedVal);
+		ApplyToEngine(Change.Setting, ClampedVal);
+		Context.bTouchedGameUserSettings |= !Change.Setting->NamedSetter.IsNone();
+		Context.StagedSettings.Add(Change.Setting);
 
-	if (bAnyRequiresConfirmation)
-	{
-		/* Stringify tags for the event broadcast payload */
-		TArray<FString> AffectedTagStrings;
-		AffectedTagStrings.Reserve(AffectedTags.Num());
-		for (const FGameplayTag& Tag : AffectedTags)
+		if (bNeedsConfirmation)
 		{
-			AffectedTagStrings.Add(Tag.ToString());
+			Context.AffectedTags.Add(Change.Setting->SettingTag);
 		}
-
-		TMap<FString, FString> EventParams;
-		EventParams.Add(TEXT("SettingTags"), FString::Join(AffectedTagStrings, TEXT("|")));
-
-		UMCore_EventFunctionLibrary::BroadcastEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ConfirmationRequired,
-			EventParams, EMCore_EventScope::Local);
-
-		OnSettingsConfirmationRequired.Broadcast(AffectedTags);
-	}
-	else
-	{
-		SavePlayerSettings(WorldContextObject);
-	}
-
-	if (!bBypassConfirmation)
-	{
-		for (const FGameplayTag& Tag : ProcessedTags)
+		else
 		{
-			BroadcastSettingChanged(WorldContextObject, Tag);
+			Context.ProcessedTags.Add(Change.Setting->SettingTag);
 		}
 	}
 }
@@ -358,14 +697,13 @@ void UMCore_GameSettingsLibrary::SetSettingFloat(
 	const TArray<FMCore_FloatSettingChange>& Changes,
 	bool bBypassConfirmation)
 {
-	ApplySettingChanges_Internal<FMCore_FloatSettingChange, float>(
-		WorldContextObject, Changes, bBypassConfirmation,
-		[](const UMCore_DA_SettingDefinition* S, float V) {
-			return (S->SettingType == EMCore_SettingType::Slider)
-				? FMath::Clamp(V, S->MinValue, S->MaxValue) : V;
-		},
-		[](UMCore_PlayerSettingsSave* Save, const FString& Key, float V) { Save->SetFloatSetting(Key, V); },
-		[WorldContextObject](const UMCore_DA_SettingDefinition* S, float V) { ApplySettingToEngine(WorldContextObject, S, V, 0, false); });
+	if (Changes.IsEmpty()) { return; }
+
+	CommitSettingChanges_Internal(WorldContextObject, bBypassConfirmation, false,
+		[WorldContextObject, &Changes](FSettingsCommitContext& Context)
+		{
+			StageFloatChanges(WorldContextObject, Context, Changes);
+		});
 }
 
 void UMCore_GameSettingsLibrary::SetSettingInt(
@@ -373,14 +711,13 @@ void UMCore_GameSettingsLibrary::SetSettingInt(
 	const TArray<FMCore_IntSettingChange>& Changes,
 	bool bBypassConfirmation)
 {
-	ApplySettingChanges_Internal<FMCore_IntSettingChange, int32>(
-		WorldContextObject, Changes, bBypassConfirmation,
-		[](const UMCore_DA_SettingDefinition* S, int32 V) {
-			return (S->SettingType == EMCore_SettingType::Dropdown && S->DropdownOptions.Num() > 0)
-				? FMath::Clamp(V, 0, S->DropdownOptions.Num() - 1) : V;
-		},
-		[](UMCore_PlayerSettingsSave* Save, const FString& Key, int32 V) { Save->SetIntSetting(Key, V); },
-		[WorldContextObject](const UMCore_DA_SettingDefinition* S, int32 V) { ApplySettingToEngine(WorldContextObject, S, 0.f, V, false); });
+	if (Changes.IsEmpty()) { return; }
+
+	CommitSettingChanges_Internal(WorldContextObject, bBypassConfirmation, false,
+		[WorldContextObject, &Changes](FSettingsCommitContext& Context)
+		{
+			StageIntChanges(WorldContextObject, Context, Changes);
+		});
 }
 
 void UMCore_GameSettingsLibrary::SetSettingBool(
@@ -388,65 +725,220 @@ void UMCore_GameSettingsLibrary::SetSettingBool(
 	const TArray<FMCore_BoolSettingChange>& Changes,
 	bool bBypassConfirmation)
 {
-	ApplySettingChanges_Internal<FMCore_BoolSettingChange, bool>(
-		WorldContextObject, Changes, bBypassConfirmation,
-		[](const UMCore_DA_SettingDefinition*, bool V) { return V; },
-		[](UMCore_PlayerSettingsSave* Save, const FString& Key, bool V) { Save->SetBoolSetting(Key, V); },
-		[WorldContextObject](const UMCore_DA_SettingDefinition* S, bool V) { ApplySettingToEngine(WorldContextObject, S, 0.f, 0, V); });
+	if (Changes.IsEmpty()) { return; }
+
+	CommitSettingChanges_Internal(WorldContextObject, bBypassConfirmation, false,
+		[WorldContextObject, &Changes](FSettingsCommitContext& Context)
+		{
+			StageBoolChanges(WorldContextObject, Context, Changes);
+		});
 }
 
 // ============================================================================
-// UTILITIES
+// TRANSACTIONS
 // ============================================================================
 
-void UMCore_GameSettingsLibrary::ResetSettingToDefault(const UObject* WorldContextObject,
-	const UMCore_DA_SettingDefinition* Setting)
+void UMCore_GameSettingsLibrary::CommitSettingsTransaction(
+	const UObject* WorldContextObject,
+	const FMCore_SettingsTransaction& Transaction,
+	bool bBypassConfirmation)
 {
-	if (!Setting) { return; }
-
-	/* const_cast safe: DataAsset from asset registry; const parameter is
-	   caller-side guarantee; change struct needs non-const for UPROPERTY serialization */
-	UMCore_DA_SettingDefinition* MutableSetting =
-		const_cast<UMCore_DA_SettingDefinition*>(Setting);
+	if (Transaction.IsEmpty()) { return; }
 
-	switch (Setting->SettingType)
-	{
-	case EMCore_SettingType::Slider:
-		SetSettingFloat(WorldContextObject,
-			{ { MutableSetting, Setting->DefaultValue } }, true);
-		break;
-	case EMCore_SettingType::Toggle:
-		SetSettingBool(WorldContextObject,
-			{ { MutableSetting, Setting->DefaultToggleValue } }, true);
-		break;
-	case EMCore_SettingType::Dropdown:
-		SetSettingInt(WorldContextObject,
-			{ { MutableSetting, Setting->DefaultDropdownIndex } }, true);
-		break;
-	default:
-		break;
-	}
+	CommitSettingChanges_Internal(WorldContextObject, bBypassConfirmation, true,
+		[WorldContextObject, &Transaction](FSettingsCommitContext& Context)
+		{
+			StageFloatChanges(WorldContextObject, Context, Transaction.FloatChanges);
+			StageIntChanges(WorldContextObject, Context, Transaction.IntChanges);
+			StageBoolChanges(WorldContextObject, Context, Transaction.BoolChanges);
+		});
 }
 
-void UMCore_GameSettingsLibrary::ResetAllSettingsToDefault(const UObject* WorldContextObject)
+void UMCore_GameSettingsLibrary::AddFloatToSettingsTransaction(FMCore_SettingsTransaction& Transaction,
+	UMCore_DA_SettingDefinition* Setting, float Value)
+{
+	Transaction.AddFloat(Setting, Value);
+}
+
+void UMCore_GameSettingsLibrary::AddIntToSettingsTransaction(FMCore_SettingsTransaction& Transaction,
+	UMCore_DA_SettingDefinition* Setting, int32 Value)
 {
-	const TArray<UMCore_DA_SettingsCollection*>& Collections = UMCore_CoreSettings::Get()->GetAllSettingsCollections();
-	if (Collections.IsEmpty())
+	Transaction.AddInt(Setting, Value);
+}
+
+void UMCore_GameSettingsLibrary::AddBoolToSettingsTransaction(FMCore_SettingsTransaction& Transaction,
+	UMCore_DA_SettingDefinition* Setting, bool Value)
+{
+	Transaction.AddBool(Setting, Value);
+}
+
+// ============================================================================
+// COMMIT PIPELINE
+// ============================================================================
+
+void UMCore_GameSettingsLibrary::CommitSettingChanges_Internal(
+	const UObject* WorldContextObject,
+	bool bBypassConfirmation,
+	bool bCoalesceEvents,
+	TFunctionRef<void(FSettingsCommitContext&)> StageChanges)
+{
+	if (!WorldContextObject) { return; }
+
+	FSettingsCommitContext Context;
+	Context.Save = GetPlayerSave(WorldContextObject);
+	if (!Context.Save)
 	{
 		UE_LOG(LogModulusSettings, Warning,
-			TEXT("GameSettingsLibrary::ResetAllSettingsToDefault -- no settings collections configured in CoreSettings"));
+			TEXT("GameSettingsLibrary::CommitSettingChanges -- failed to get PlayerSettingsSave"));
 		return;
 	}
+	Context.History = GetSettingsHistory(WorldContextObject);
+	Context.bBypassConfirmation = bBypassConfirmation;
+
+	{
+		FScalabilityBatchScope ScalabilityBatch(WorldContextObject);
+		StageChanges(Context);
+		PropagateSettingDependencies(WorldContextObject, Context);
+	}
 
-	TArray<UMCore_DA_SettingDefinition*> Definitions;
-	for (const UMCore_DA_SettingsCollection* Collection : Collections)
+	if (Context.AffectedTags.IsEmpty() && Context.ProcessedTags.IsEmpty()) { return; }
+
+	if (Context.bTouchedGameUserSettings)
 	{
-		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
 		{
-			if (Setting) { Definitions.Add(Setting); }
+			ApplyGameUserSettings(*GUS);
 		}
 	}
 
+	if (!Context.UndoSnapshot.IsEmpty())
+	{
+		PushUndoSnapshot(WorldContextObject, MoveTemp(Context.UndoSnapshot));
+	}
+
+	if (!Context.AffectedTags.IsEmpty())
+	{
+		TMap<FString, FString> EventParams;
+		EventParams.Add(TEXT("SettingTags"), JoinSettingTags(Context.AffectedTags));
+
+		UMCore_EventFunctionLibrary::BroadcastEvent(
+			WorldContextObject,
+			MCore_SettingsTags::MCore_Settings_Event_ConfirmationRequired,
+			EventParams, EMCore_EventScope::Local);
+
+		OnSettingsConfirmationRequired.Broadcast(Context.AffectedTags);
+	}
+	else
+	{
+		SavePlayerSettings(WorldContextObject);
+	}
+
+	/* Widgets need dependent rewrites and enable flips even when per-tag events are suppressed */
+	if (!Context.DependencyUpdate.IsEmpty())
+	{
+		OnSettingDependentsUpdated.Broadcast(Context.DependencyUpdate);
+	}
+
+	if (bBypassConfirmation || Context.ProcessedTags.IsEmpty()) { return; }
+
+	if (bCoalesceEvents)
+	{
+		TMap<FString, FString> EventParams;
+		EventParams.Add(TEXT("SettingTags"), JoinSettingTags(Context.ProcessedTags));
+
+		UMCore_EventFunctionLibrary::BroadcastEvent(
+			WorldContextObject,
+			MCore_SettingsTags::MCore_Settings_Event_SettingsChanged,
+			EventParams, EMCore_EventScope::Local);
+	}
+	else
+	{
+		for (const FGameplayTag& Tag : Context.ProcessedTags)
+		{
+			BroadcastSettingChanged(WorldContextObject, Tag);
+		}
+	}
+}
+
+void UMCore_GameSettingsLibrary::StageFloatChanges(const UObject* WorldContextObject,
+	FSettingsCommitContext& Context, const TArray<FMCore_FloatSettingChange>& Changes)
+{
+	StageSettingChanges_Internal<FMCore_FloatSettingChange, float>(
+		WorldContextObject, Context, Changes,
+		[](const UMCore_DA_SettingDefinition* S, float V) {
+			return (S->SettingType == EMCore_SettingType::Slider)
+				? FMath::Clamp(V, S->MinValue, S->MaxValue) : V;
+		},
+		[](UMCore_PlayerSettingsSave* Save, const UMCore_DA_SettingDefinition* Setting, float V) { Save->SetFloatValue(Setting, V); },
+		[WorldContextObject](const UMCore_DA_SettingDefinition* S, float V) { ApplySettingToEngine(WorldContextObject, S, V, 0, false); });
+}
+
+void UMCore_GameSettingsLibrary::StageIntChanges(const UObject* WorldContextObject,
+	FSettingsCommitContext& Context, const TArray<FMCore_IntSettingChange>& Changes)
+{
+	StageSettingChanges_Internal<FMCore_IntSettingChange, int32>(
+		WorldContextObject, Context, Changes,
+		[](const UMCore_DA_SettingDefinition* S, int32 V) {
+			return (S->SettingType == EMCore_SettingType::Dropdown && S->DropdownOptions.Num() > 0)
+				? FMath::Clamp(V, 0, S->DropdownOptions.Num() - 1) : V;
+		},
+		[](UMCore_PlayerSettingsSave* Save, const UMCore_DA_SettingDefinition* Setting, int32 V) { Save->SetIntValue(Setting, V); },
+		[WorldContextObject](const UMCore_DA_SettingDefinition* S, int32 V) { ApplySettingToEngine(WorldContextObject, S, 0.f, V, false); });
+}
+
+void UMCore_GameSettingsLibrary::StageBoolChanges(const UObject* WorldContextObject,
+	FSettingsCommitContext& Context, const TArray<FMCore_BoolSettingChange>& Changes)
+{
+	StageSettingChanges_Internal<FMCore_BoolSettingChange, bool>(
+		WorldContextObject, Context, Changes,
+		[](const UMCore_DA_SettingDefinition*, bool V) { return V; },
+		[](UMCore_PlayerSettingsSave* Save, const UMCore_DA_SettingDefinition* Setting, bool V) { Save->SetBoolValue(Setting, V); },
+		[WorldContextObject](const UMCore_DA_SettingDefinition* S, bool V) { ApplySettingToEngine(WorldContextObject, S, 0.f, 0, V); });
+}
+
+// ============================================================================
+// UTILITIES
+// ============================================================================
+
+void UMCore_GameSettingsLibrary::ResetSettingToDefault(const UObject* WorldContextObject,
+	const UMCore_DA_SettingDefinition* Setting)
+{
+	if (!Setting) { return; }
+
+	/* const_cast safe: DataAsset from asset registry; const parameter is
+	   caller-side guarantee; change struct needs non-const for UPROPERTY serialization */
+	UMCore_DA_SettingDefinition* MutableSetting =
+		const_cast<UMCore_DA_SettingDefinition*>(Setting);
+
+	switch (Setting->SettingType)
+	{
+	case EMCore_SettingType::Slider:
+		SetSettingFloat(WorldContextObject,
+			{ { MutableSetting, Setting->DefaultValue } }, true);
+		break;
+	case EMCore_SettingType::Toggle:
+		SetSettingBool(WorldContextObject,
+			{ { MutableSetting, Setting->DefaultToggleValue } }, true);
+		break;
+	case EMCore_SettingType::Dropdown:
+		SetSettingInt(WorldContextObject,
+			{ { MutableSetting, Setting->DefaultDropdownIndex } }, true);
+		break;
+	default:
+		break;
+	}
+}
+
+void UMCore_GameSettingsLibrary::ResetAllSettingsToDefault(const UObject* WorldContextObject)
+{
+	const TArray<UMCore_DA_SettingDefinition*> Definitions = UMCore_CoreSettings::Get()->GetAllSettingDefinitions();
+	if (Definitions.IsEmpty())
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("GameSettingsLibrary::ResetAllSettingsToDefault -- no settings collections configured in CoreSettings"));
+		return;
+	}
+
 	ResetDefinitionsToDefault(WorldContextObject, Definitions);
 }
 
@@ -467,9 +959,7 @@ void UMCore_GameSettingsLibrary::ResetDefinitionsToDefault(const UObject* WorldC
 {
 	if (Definitions.IsEmpty()) { return; }
 
-	TArray<FMCore_FloatSettingChange> FloatChanges;
-	TArray<FMCore_IntSettingChange> IntChanges;
-	TArray<FMCore_BoolSettingChange> BoolChanges;
+	FMCore_SettingsTransaction Transaction;
 
 	for (UMCore_DA_SettingDefinition* Setting : Definitions)
 	{
@@ -478,29 +968,34 @@ void UMCore_GameSettingsLibrary::ResetDefinitionsToDefault(const UObject* WorldC
 		switch (Setting->SettingType)
 		{
 		case EMCore_SettingType::Slider:
-			FloatChanges.Add({ Setting, Setting->DefaultValue });
+			Transaction.AddFloat(Setting, Setting->DefaultValue);
 			break;
 		case EMCore_SettingType::Toggle:
-			BoolChanges.Add({ Setting, Setting->DefaultToggleValue });
+			Transaction.AddBool(Setting, Setting->DefaultToggleValue);
 			break;
 		case EMCore_SettingType::Dropdown:
-			IntChanges.Add({ Setting, Setting->DefaultDropdownIndex });
+			Transaction.AddInt(Setting, Setting->DefaultDropdownIndex);
 			break;
 		default:
 			break;
 		}
 	}
 
-	if (FloatChanges.Num() > 0) { SetSettingFloat(WorldContextObject, FloatChanges, true); }
-	if (IntChanges.Num() > 0) { SetSettingInt(WorldContextObject, IntChanges, true); }
-	if (BoolChanges.Num() > 0) { SetSettingBool(WorldContextObject, BoolChanges, true); }
+	/* One flush, one save and one undo step for the whole reset */
+	CommitSettingsTransaction(WorldContextObject, Transaction, true);
 }
 
 void UMCore_GameSettingsLibrary::SavePlayerSettings(const UObject* WorldContextObject)
 {
 	if (UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject))
 	{
-		Save->SaveSettings();
+		Save->PersistSettingValues();
+
+		/* The save carries any still-unconfirmed values; a later revert must re-save. */
+		if (FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject))
+		{
+			History->bPendingConfirmationPersisted |= !History->PendingConfirmation.IsEmpty();
+		}
 	}
 }
 
@@ -522,7 +1017,8 @@ void UMCore_GameSettingsLibrary::ReloadAndApplyFromDisk(const UObject* WorldCont
 		return;
 	}
 
-	UMCore_PlayerSettingsSave* FreshSave = UMCore_PlayerSettingsSave::LoadPlayerSettings(SlotName);
+	/* Load-only: CachedSave still owns the slot and journal, so the fresh copy must not compact them */
+	UMCore_PlayerSettingsSave* FreshSave = UMCore_PlayerSettingsSave::ReadPlayerSettings(SlotName);
 	if (!FreshSave)
 	{
 		UE_LOG(LogModulusSettings, Warning,
@@ -530,27 +1026,29 @@ void UMCore_GameSettingsLibrary::ReloadAndApplyFromDisk(const UObject* WorldCont
 		return;
 	}
 
-	/* Replace in-memory setting maps with on-disk values */
-	CachedSave->FloatSettings = FreshSave->FloatSettings;
-	CachedSave->IntSettings = FreshSave->IntSettings;
-	CachedSave->BoolSettings = FreshSave->BoolSettings;
+	/* Replace in-memory setting values with on-disk values (keeps the cached save's ordinal binding) */
+	CachedSave->CopySettingValuesFrom(FreshSave);
 
 	ApplyAllSettingsToEngine(WorldContextObject);
 
 	UE_LOG(LogModulusSettings, Log,
-		TEXT("GameSettingsLibrary::ReloadAndApplyFromDisk -- restored from slot '%s', %d float / %d int / %d bool settings re-applied"),
-		*SlotName, CachedSave->FloatSettings.Num(), CachedSave->IntSettings.Num(), CachedSave->BoolSettings.Num());
+		TEXT("GameSettingsLibrary::ReloadAndApplyFromDisk -- restored from slot '%s', %d setting value(s) reloaded"),
+		*SlotName, CachedSave->GetStoredSettingCount());
 }
 
 /* Engine-apply half of the load-then-apply pair extracted from ReloadAndApplyFromDisk.
  * Iterates every setting in CoreSettings::SettingsCollections and dispatches the persisted
  * value through ApplySettingToEngine, then flushes UGameUserSettings once at the end.
+ * Diff-aware: definitions whose persisted value matches the last value applied to the
+ * engine are skipped, and the GUS flush only runs when a GUS-backed value changed.
  * Idempotent — safe to call repeatedly. Early-outs on dedicated server (no audio device,
  * GUS is a no-op, and all dispatchers warn on missing world context). */
 void UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(const UObject* WorldContextObject)
 {
 	if (IsRunningDedicatedServer()) { return; }
 
+	SCOPE_CYCLE_COUNTER(STAT_MCore_ApplyAllSettingsToEngine);
+
 	UMCore_PlayerSettingsSave* CachedSave = GetPlayerSave(WorldContextObject);
 	if (!CachedSave)
 	{
@@ -574,15 +1072,19 @@ void UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(const UObject* WorldCo
 	   pre-iteration value, and lets the post-loop restore reverse any clobber. */
 	const int32 PreservedQualityPreset = CachedSave->GetLastSelectedQualityPreset();
 
-	const TArray<UMCore_DA_SettingsCollection*>& Collections = CoreSettings->GetAllSettingsCollections();
-	for (const UMCore_DA_SettingsCollection* Collection : Collections)
+	ForgetAppliedSoundValuesOnDeviceChange(WorldContextObject);
+
+	int32 AppliedCount = 0;
+	int32 SkippedCount = 0;
+	bool bTouchedGameUserSettings = false;
+
+	/* Scalability children replayed below coalesce into one sg.* push + one
+	   ExternalValueChange when the scope closes, ahead of the intent restore. */
 	{
-		if (!Collection) { continue; }
+		FScalabilityBatchScope ScalabilityBatch(WorldContextObject);
 
-		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Definition : Collection->GetAllSettings())
+		for (UMCore_DA_SettingDefinition* Definition : CoreSettings->GetAllSettingDefinitions())
 		{
-			if (!Definition) { continue; }
-
 			/* Custom intent — skip QualityPreset apply so individual scalability DAs drive engine state.
 			   Without this guard, the cascade in ApplyViaNamedSetter would overwrite just-loaded
 			   individual save values with engine state matching the saved preset value. The read uses
@@ -595,69 +1097,549 @@ void UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(const UObject* WorldCo
 				continue;
 			}
 
-			switch (Definition->SettingType)
+			float FloatValue = 0.0f;
+			int32 IntValue = 0;
+			bool bBoolValue = false;
+
+			switch (Definition->SettingType)
+			{
+			case EMCore_SettingType::Slider:
+				FloatValue = GetSettingFloat(WorldContextObject, Definition);
+				break;
+			case EMCore_SettingType::Dropdown:
+				IntValue = GetSettingInt(WorldContextObject, Definition);
+				break;
+			case EMCore_SettingType::Toggle:
+				bBoolValue = GetSettingBool(WorldContextObject, Definition);
+				break;
+			default:
+				continue;
+			}
+
+			/* Engine already holds this value from an earlier apply — no write. */
+			if (MatchesAppliedValue(Definition, FloatValue, IntValue, bBoolValue))
+			{
+				++SkippedCount;
+				continue;
+			}
+
+			ApplySettingToEngine(WorldContextObject, Definition, FloatValue, IntValue, bBoolValue);
+			bTouchedGameUserSettings |= !Definition->NamedSetter.IsNone();
+			++AppliedCount;
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_MCore_SettingsApplied, AppliedCount);
+	INC_DWORD_STAT_BY(STAT_MCore_SettingsSkipped, SkippedCount);
+
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("GameSettingsLibrary::ApplyAllSettingsToEngine -- %d applied, %d unchanged"),
+		AppliedCount, SkippedCount);
+
+	/* GUS->ApplySettings re-applies resolution, window mode and scalability wholesale;
+	   only pay for it when a GUS-backed definition actually changed. */
+	if (bTouchedGameUserSettings)
+	{
+		if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+		{
+			ApplyGameUserSettings(*GUS);
+		}
+	}
+
+	/* Restore user intent if iteration mutated it. The dispatcher's MarkQualityPresetCustom
+	   fire-paths are correct for slider commits but wrong for replay; this restore reverses
+	   the side effect without touching the dispatcher. Guarded write so the save remains
+	   untouched in the common case (no scalability DAs, or intent already -1 pre-iteration). */
+	if (CachedSave->GetLastSelectedQualityPreset() != PreservedQualityPreset)
+	{
+		CachedSave->SetLastSelectedQualityPreset(PreservedQualityPreset);
+	}
+}
+
+// ============================================================================
+// CONFIRMATION & UNDO
+// ============================================================================
+
+void UMCore_GameSettingsLibrary::ConfirmPendingSettings(const UObject* WorldContextObject)
+{
+	if (FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject))
+	{
+		FMCore_SettingsSnapshot Confirmed = MoveTemp(History->PendingConfirmation);
+		History->PendingConfirmation = FMCore_SettingsSnapshot();
+		History->bPendingConfirmationPersisted = false;
+
+		if (!Confirmed.IsEmpty())
+		{
+			PushUndoSnapshot(WorldContextObject, MoveTemp(Confirmed));
+		}
+	}
+
+	SavePlayerSettings(WorldContextObject);
+}
+
+void UMCore_GameSettingsLibrary::RevertPendingSettings(const UObject* WorldContextObject)
+{
+	FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject);
+	if (!History || History->PendingConfirmation.IsEmpty())
+	{
+		UE_LOG(LogModulusSettings, Log,
+			TEXT("GameSettingsLibrary::RevertPendingSettings -- no pending snapshot, reloading from disk"));
+		ReloadAndApplyFromDisk(WorldContextObject);
+		return;
+	}
+
+	const FMCore_SettingsSnapshot Pending = MoveTemp(History->PendingConfirmation);
+	const bool bPendingWasPersisted = History->bPendingConfirmationPersisted;
+	History->PendingConfirmation = FMCore_SettingsSnapshot();
+	History->bPendingConfirmationPersisted = false;
+
+	RestoreSnapshot(WorldContextObject, Pending);
+
+	/* Disk only holds unconfirmed values if an unrelated save ran inside the window. */
+	if (bPendingWasPersisted)
+	{
+		SavePlayerSettings(WorldContextObject);
+	}
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("GameSettingsLibrary::RevertPendingSettings -- restored %d setting(s) from memory"),
+		Pending.Entries.Num());
+}
+
+bool UMCore_GameSettingsLibrary::UndoLastSettingsChange(const UObject* WorldContextObject)
+{
+	if (!CanUndoSettingsChange(WorldContextObject)) { return false; }
+
+	FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject);
+	const FMCore_SettingsSnapshot Snapshot = History->UndoStack.Pop();
+
+	RestoreSnapshot(WorldContextObject, Snapshot);
+	SavePlayerSettings(WorldContextObject);
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("GameSettingsLibrary::UndoLastSettingsChange -- restored %d setting(s), %d undo step(s) left"),
+		Snapshot.Entries.Num(), History->UndoStack.Num());
+	return true;
+}
+
+bool UMCore_GameSettingsLibrary::CanUndoSettingsChange(const UObject* WorldContextObject)
+{
+	/* Undo while a confirmation is pending would race the countdown's revert. */
+	const FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject);
+	return History && !History->UndoStack.IsEmpty() && History->PendingConfirmation.IsEmpty();
+}
+
+void UMCore_GameSettingsLibrary::ClearSettingsUndoHistory(const UObject* WorldContextObject)
+{
+	if (FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject))
+	{
+		History->UndoStack.Empty();
+	}
+}
+
+// ============================================================================
+// DEPENDENCIES
+// ============================================================================
+
+namespace
+{
+	/* Any setting type as a float: toggles 0/1, dropdowns their option index. */
+	float ReadSettingValue(const UObject* WorldContextObject, const UMCore_DA_SettingDefinition* Setting)
+	{
+		switch (Setting->SettingType)
+		{
+		case EMCore_SettingType::Slider:
+			return UMCore_GameSettingsLibrary::GetSettingFloat(WorldContextObject, Setting);
+		case EMCore_SettingType::Dropdown:
+			return static_cast<float>(UMCore_GameSettingsLibrary::GetSettingInt(WorldContextObject, Setting));
+		case EMCore_SettingType::Toggle:
+		default:
+			return UMCore_GameSettingsLibrary::GetSettingBool(WorldContextObject, Setting) ? 1.0f : 0.0f;
+		}
+	}
+
+	/* DrivenBy target for a source value; unset when the source value maps to nothing
+	   (no DrivenValues entry, or a display-only dropdown index such as "Custom"). */
+	TOptional<float> ResolveDrivenValue(const FMCore_SettingDependency& Dependency,
+		const UMCore_DA_SettingDefinition& Source, float SourceValue)
+	{
+		const int32 SourceIndex = FMath::RoundToInt(SourceValue);
+		if (Source.SettingType == EMCore_SettingType::Dropdown
+			&& Source.NumSelectableOptions > 0 && SourceIndex >= Source.NumSelectableOptions)
+		{
+			return {};
+		}
+
+		if (Dependency.DrivenValues.IsEmpty()) { return SourceValue; }
+		if (!Dependency.DrivenValues.IsValidIndex(SourceIndex)) { return {}; }
+		return Dependency.DrivenValues[SourceIndex];
+	}
+
+	float ApplyDependencyClamp(const FMCore_SettingDependency& Dependency, float SourceValue, float Value)
+	{
+		const float Bound = SourceValue + Dependency.ClampOffset;
+		return Dependency.ClampMode == EMCore_SettingClampMode::AtMost
+			? FMath::Min(Value, Bound) : FMath::Max(Value, Bound);
+	}
+
+	bool IsWithinEnabledRange(const FMCore_SettingDependency& Dependency, float SourceValue)
+	{
+		return SourceValue >= Dependency.EnabledMinValue && SourceValue <= Dependency.EnabledMaxValue;
+	}
+
+	TSharedPtr<const FMCore_SettingDependencyGraph> GetDependencyGraph(const UObject* WorldContextObject)
+	{
+		UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(WorldContextObject);
+		return Collections ? Collections->GetDependencyGraph() : nullptr;
+	}
+}
+
+bool UMCore_GameSettingsLibrary::IsSettingEnabled(const UObject* WorldContextObject,
+	const UMCore_DA_SettingDefinition* Setting)
+{
+	if (!Setting || Setting->Dependencies.IsEmpty()) { return true; }
+
+	const TSharedPtr<const FMCore_SettingDependencyGraph> Graph = GetDependencyGraph(WorldContextObject);
+	const int32 Node = Graph ? Graph->FindNode(Setting) : INDEX_NONE;
+	if (Node == INDEX_NONE) { return true; }
+
+	for (const int32 EdgeIndex : Graph->GetInEdges(Node))
+	{
+		const FMCore_SettingDependencyGraph::FEdge& Edge = Graph->GetEdge(EdgeIndex);
+		const FMCore_SettingDependency& Dependency = Graph->GetDependency(Edge);
+		if (Dependency.Type == EMCore_SettingDependencyType::DisabledBy
+			&& !IsWithinEnabledRange(Dependency, ReadSettingValue(WorldContextObject, Graph->GetDefinition(Edge.Source))))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UMCore_GameSettingsLibrary::PropagateSettingDependencies(const UObject* WorldContextObject,
+	FSettingsCommitContext& Context)
+{
+	if (Context.StagedSettings.IsEmpty()) { return; }
+
+	const TSharedPtr<const FMCore_SettingDependencyGraph> Graph = GetDependencyGraph(WorldContextObject);
+	if (!Graph || !Graph->HasEdges()) { return; }
+
+	/* Written: value changed in this pass (drives successors). CallerWritten: never re-driven.
+	   AwaitingConfirmation: reverting it must also revert whatever it rewrote. */
+	TBitArray<> Written(false, Graph->NumNodes());
+	TBitArray<> CallerWritten(false, Graph->NumNodes());
+	TBitArray<> AwaitingConfirmation(false, Graph->NumNodes());
+	TArray<int32> Seeds;
+	for (const UMCore_DA_SettingDefinition* Setting : Context.StagedSettings)
+	{
+		const int32 Node = Graph->FindNode(Setting);
+		if (Node == INDEX_NONE) { continue; }
+		Seeds.Add(Node);
+		Written[Node] = true;
+		CallerWritten[Node] = true;
+		AwaitingConfirmation[Node] = Setting->bRequiresConfirmation && !Context.bBypassConfirmation;
+	}
+
+	TArray<int32> Downstream;
+	Graph->CollectDownstream(Seeds, Downstream);
+
+	/* Topological order: every source is final before its dependents read it */
+	for (const int32 Node : Downstream)
+	{
+		const UMCore_DA_SettingDefinition* Setting = Graph->GetDefinition(Node);
+		const float CurrentValue = ReadSettingValue(WorldContextObject, Setting);
+		float TargetValue = CurrentValue;
+		bool bHasEnableCondition = false;
+		bool bEnabled = true;
+		bool bUpstreamAwaitingConfirmation = false;
+
+		/* Edges apply in declaration order, so a ClampedTo listed after a DrivenBy bounds the driven value */
+		for (const int32 EdgeIndex : Graph->GetInEdges(Node))
+		{
+			const FMCore_SettingDependencyGraph::FEdge& Edge = Graph->GetEdge(EdgeIndex);
+			const FMCore_SettingDependency& Dependency = Graph->GetDependency(Edge);
+			const UMCore_DA_SettingDefinition* Source = Graph->GetDefinition(Edge.Source);
+			const float SourceValue = ReadSettingValue(WorldContextObject, Source);
+			bUpstreamAwaitingConfirmation |= AwaitingConfirmation[Edge.Source];
+
+			switch (Dependency.Type)
+			{
+			case EMCore_SettingDependencyType::DrivenBy:
+				if (Written[Edge.Source] && !CallerWritten[Node])
+				{
+					if (const TOptional<float> DrivenValue = ResolveDrivenValue(Dependency, *Source, SourceValue))
+					{
+						TargetValue = DrivenValue.GetValue();
+					}
+				}
+				break;
+			case EMCore_SettingDependencyType::ClampedTo:
+				TargetValue = ApplyDependencyClamp(Dependency, SourceValue, TargetValue);
+				break;
+			case EMCore_SettingDependencyType::DisabledBy:
+				bHasEnableCondition = true;
+				bEnabled &= IsWithinEnabledRange(Dependency, SourceValue);
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (bHasEnableCondition)
+		{
+			Context.DependencyUpdate.EnabledStates.Add(Setting->SettingTag, bEnabled);
+		}
+
+		if (FMath::IsNearlyEqual(TargetValue, CurrentValue)) { continue; }
+
+		Written[Node] = true;
+		Context.DependencyUpdate.ValueChangedTags.Add(Setting->SettingTag);
+
+		if (bUpstreamAwaitingConfirmation && Context.History)
+		{
+			AwaitingConfirmation[Node] = true;
+			if (!Context.History->PendingConfirmation.Contains(Setting))
+			{
+				CaptureSnapshotEntry(WorldContextObject, Context.History->PendingConfirmation, Setting);
+			}
+		}
+
+		/* const_cast safe: see ResetSettingToDefault */
+		UMCore_DA_SettingDefinition* MutableSetting = const_cast<UMCore_DA_SettingDefinition*>(Setting);
+		switch (Setting->SettingType)
+		{
+		case EMCore_SettingType::Slider:
+			StageFloatChanges(WorldContextObject, Context, { { MutableSetting, TargetValue } });
+			break;
+		case EMCore_SettingType::Dropdown:
+			StageIntChanges(WorldContextObject, Context, { { MutableSetting, FMath::RoundToInt(TargetValue) } });
+			break;
+		case EMCore_SettingType::Toggle:
+			StageBoolChanges(WorldContextObject, Context, { { MutableSetting, TargetValue >= 0.5f } });
+			break;
+		default:
+			break;
+		}
+	}
+
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("GameSettingsLibrary::PropagateSettingDependencies -- %d staged, %d downstream re-evaluated, %d rewritten"),
+		Seeds.Num(), Downstream.Num(), Context.DependencyUpdate.ValueChangedTags.Num());
+}
+
+// ============================================================================
+// SNAPSHOT HELPERS
+// ============================================================================
+
+void UMCore_GameSettingsLibrary::CaptureSnapshotEntry(const UObject* WorldContextObject,
+	FMCore_SettingsSnapshot& Snapshot, const UMCore_DA_SettingDefinition* Setting)
+{
+	if (!Setting) { return; }
+
+	FMCore_SettingSnapshotEntry& Entry = Snapshot.AddEntry(Setting);
+
+	switch (Setting->SettingType)
+	{
+	case EMCore_SettingType::Slider:
+		Entry.FloatValue = GetSettingFloat(WorldContextObject, Setting);
+		break;
+	case EMCore_SettingType::Dropdown:
+		Entry.IntValue = GetSettingInt(WorldContextObject, Setting);
+		break;
+	case EMCore_SettingType::Toggle:
+		Entry.bBoolValue = GetSettingBool(WorldContextObject, Setting);
+		break;
+	default:
+		break;
+	}
+
+	static const FName OverallScalabilityProp(TEXT("OverallScalabilityLevel"));
+	if (Setting->NamedSetter != OverallScalabilityProp || Snapshot.QualityPreset.IsSet()) { return; }
+
+	if (const UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject))
+	{
+		Snapshot.QualityPreset = Save->GetLastSelectedQualityPreset();
+	}
+
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings) { return; }
+
+	const TMap<FName, FMCore_QualityMember>& ChildMembers = GetScalabilityChildMembers();
+	for (const UMCore_DA_SettingDefinition* Child : CoreSettings->GetAllSettingDefinitions())
+	{
+		if (ChildMembers.Contains(Child->NamedSetter) && !Snapshot.Contains(Child))
+		{
+			CaptureSnapshotEntry(WorldContextObject, Snapshot, Child);
+		}
+	}
+}
+
+void UMCore_GameSettingsLibrary::PushUndoSnapshot(const UObject* WorldContextObject,
+	FMCore_SettingsSnapshot&& Snapshot)
+{
+	FMCore_SettingsHistory* History = GetSettingsHistory(WorldContextObject);
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	const int32 MaxDepth = CoreSettings ? CoreSettings->SettingsUndoDepth : 0;
+	if (!History || MaxDepth <= 0 || Snapshot.IsEmpty()) { return; }
+
+	History->UndoStack.Add(MoveTemp(Snapshot));
+
+	if (History->UndoStack.Num() > MaxDepth)
+	{
+		History->UndoStack.RemoveAt(0, History->UndoStack.Num() - MaxDepth);
+	}
+}
+
+/* Targeted counterpart of ApplyAllSettingsToEngine: touches only the snapshot's
+ * settings, then flushes GUS once if any of them is GUS-backed. Mirrors the replay
+ * path's preset handling — a Custom intent skips the OverallScalabilityLevel write
+ * so the restored children drive engine state, and the intent is written back after
+ * the scalability batch has flushed its deferred Custom flip. */
+void UMCore_GameSettingsLibrary::RestoreSnapshot(const UObject* WorldContextObject,
+	const FMCore_SettingsSnapshot& Snapshot)
+{
+	UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject);
+	if (!Save || Snapshot.IsEmpty()) { return; }
+
+	static const FName OverallScalabilityProp(TEXT("OverallScalabilityLevel"));
+	const bool bRestoringCustomPreset = Snapshot.QualityPreset.IsSet() && Snapshot.QualityPreset.GetValue() == -1;
+
+	TArray<FGameplayTag> RestoredTags;
+	bool bTouchedGameUserSettings = false;
+
+	{
+		FScalabilityBatchScope ScalabilityBatch(WorldContextObject);
+
+		for (const FMCore_SettingSnapshotEntry& Entry : Snapshot.Entries)
+		{
+			const UMCore_DA_SettingDefinition* Setting = Entry.Setting.Get();
+			if (!Setting) { continue; }
+
+			switch (Setting->SettingType)
 			{
-			case EMCore_SettingType::Slider:
-				ApplySettingToEngine(WorldContextObject, Definition,
-					GetSettingFloat(WorldContextObject, Definition), 0, false);
-				break;
-			case EMCore_SettingType::Dropdown:
-				ApplySettingToEngine(WorldContextObject, Definition,
-					0.0f, GetSettingInt(WorldContextObject, Definition), false);
-				break;
-			case EMCore_SettingType::Toggle:
-				ApplySettingToEngine(WorldContextObject, Definition,
-					0.0f, 0, GetSettingBool(WorldContextObject, Definition));
-				break;
-			default:
-				break;
+			case EMCore_SettingType::Slider:   Save->SetFloatValue(Setting, Entry.FloatValue); break;
+			case EMCore_SettingType::Dropdown: Save->SetIntValue(Setting, Entry.IntValue); break;
+			case EMCore_SettingType::Toggle:   Save->SetBoolValue(Setting, Entry.bBoolValue); break;
+			default: continue;
 			}
+
+			RestoredTags.Add(Setting->SettingTag);
+
+			if (bRestoringCustomPreset && Setting->NamedSetter == OverallScalabilityProp) { continue; }
+
+			ApplySettingToEngine(WorldContextObject, Setting, Entry.FloatValue, Entry.IntValue, Entry.bBoolValue);
+			bTouchedGameUserSettings |= !Setting->NamedSetter.IsNone();
 		}
 	}
 
-	if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+	if (bTouchedGameUserSettings)
 	{
-		GUS->ApplySettings(false);
+		if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+		{
+			ApplyGameUserSettings(*GUS);
+		}
 	}
 
-	/* Restore user intent if iteration mutated it. The dispatcher's MarkQualityPresetCustom
-	   fire-paths are correct for slider commits but wrong for replay; this restore reverses
-	   the side effect without touching the dispatcher. Guarded write so the save remains
-	   untouched in the common case (no scalability DAs, or intent already -1 pre-iteration). */
-	if (CachedSave->GetLastSelectedQualityPreset() != PreservedQualityPreset)
+	if (Snapshot.QualityPreset.IsSet())
 	{
-		CachedSave->SetLastSelectedQualityPreset(PreservedQualityPreset);
+		Save->SetLastSelectedQualityPreset(Snapshot.QualityPreset.GetValue());
+	}
+
+	for (const FGameplayTag& Tag : RestoredTags)
+	{
+		BroadcastSettingChanged(WorldContextObject, Tag);
 	}
+
+	UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
+		WorldContextObject,
+		MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
+		EMCore_EventScope::Local);
 }
 
 // ============================================================================
 // ENGINE APPLY DISPATCHER
 // ============================================================================
 
+namespace
+{
+	/* Keys that mutate the host process's window/display state; in PIE they freeze or
+	 * destabilize the editor, so the engine write is suppressed unless CoreSettings opts in. */
+	bool IsEditorUnsafeDisplayKey(const FName& SetterName)
+	{
+		static const TSet<FName> EditorUnsafeKeys = {
+			TEXT("ScreenResolution"),
+			TEXT("FullscreenMode"),
+			TEXT("bUseHDRDisplayOutput"),
+			TEXT("HDRDisplayOutputNits")
+		};
+		return EditorUnsafeKeys.Contains(SetterName);
+	}
+
+	bool IsEditorUnsafeScalabilityKey(const FName& SetterName)
+	{
+		static const TSet<FName> EditorUnsafeScalabilityKeys = {
+			TEXT("OverallScalabilityLevel"),
+			TEXT("TextureQuality"),
+			TEXT("ShadowQuality"),
+			TEXT("AntiAliasingQuality"),
+			TEXT("PostProcessQuality"),
+			TEXT("ViewDistanceQuality"),
+			TEXT("FoliageQuality"),
+			TEXT("ShadingQuality"),
+			TEXT("EffectsQuality"),
+			TEXT("GlobalIlluminationQuality"),
+			TEXT("ReflectionQuality"),
+			TEXT("LandscapeQuality"),
+			TEXT("ResolutionQuality"),
+			TEXT("bUseDynamicResolution")
+		};
+		return EditorUnsafeScalabilityKeys.Contains(SetterName);
+	}
+
+	/* True when ApplyViaNamedSetter will treat SetterName as handled without touching the engine */
+	bool IsNamedSetterSuppressedInEditor(const FName& SetterName)
+	{
+		if (!GIsEditor || IsRunningGame()) { return false; }
+
+		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+		if (!CoreSettings) { return false; }
+
+		return (IsEditorUnsafeDisplayKey(SetterName) && !CoreSettings->bApplyDisplaySettingsInPIE)
+			|| (IsEditorUnsafeScalabilityKey(SetterName) && !CoreSettings->bApplyScalabilitySettingsInPIE);
+	}
+}
+
 void UMCore_GameSettingsLibrary::ApplySettingToEngine(const UObject* WorldContextObject,
 	const UMCore_DA_SettingDefinition* Setting, float FloatValue, int32 IntValue, bool BoolValue)
 {
 	if (!Setting) { return; }
 
+	/* Only a value every configured target accepted is recorded as applied; anything
+	 * that fell through is retried by the next ApplyAllSettingsToEngine. */
+	bool bApplied = true;
+
 	/* Phase 1 — GameUserSettings (three-bucket dispatcher) */
 	if (!Setting->NamedSetter.IsNone())
 	{
-		ApplyViaNamedSetter(Setting->NamedSetter, FloatValue, IntValue, BoolValue, WorldContextObject);
+		MCORE_SCOPE_SETTING_APPLY_COST(Setting->SettingTag, EMCore_SettingApplyPhase::NamedSetter);
+		bApplied &= ApplyViaNamedSetter(Setting->NamedSetter, FloatValue, IntValue, BoolValue, WorldContextObject)
+			&& !IsNamedSetterSuppressedInEditor(Setting->NamedSetter);
 	}
 
 	/* Phase 2 — Console Variables */
 	if (!Setting->ConsoleVariable.IsNone())
 	{
+		MCORE_SCOPE_SETTING_APPLY_COST(Setting->SettingTag, EMCore_SettingApplyPhase::ConsoleVariable);
 		switch (Setting->SettingType)
 		{
 		case EMCore_SettingType::Slider:
-			ApplyToConsoleVariable(Setting->ConsoleVariable, FloatValue);
+			bApplied &= ApplyToConsoleVariable(Setting->ConsoleVariable, FloatValue);
 			break;
 		case EMCore_SettingType::Toggle:
-			ApplyToConsoleVariable(Setting->ConsoleVariable, BoolValue);
+			bApplied &= ApplyToConsoleVariable(Setting->ConsoleVariable, BoolValue);
 			break;
 		case EMCore_SettingType::Dropdown:
-			ApplyToConsoleVariable(Setting->ConsoleVariable, IntValue);
+			bApplied &= ApplyToConsoleVariable(Setting->ConsoleVariable, IntValue);
 			break;
 		default:
 			break;
@@ -667,20 +1649,32 @@ void UMCore_GameSettingsLibrary::ApplySettingToEngine(const UObject* WorldContex
 	/* Phase 3 — Sound Class volume (Slider only) */
 	if (!Setting->SoundClass.IsNull() && Setting->SettingType == EMCore_SettingType::Slider)
 	{
-		ApplyToSoundClass(WorldContextObject, Setting->SoundClass, FloatValue);
+		MCORE_SCOPE_SETTING_APPLY_COST(Setting->SettingTag, EMCore_SettingApplyPhase::SoundClass);
+		bApplied &= ApplyToSoundClass(WorldContextObject, Setting->SoundClass, FloatValue);
 	}
 
 	/* Phase 4 — SoundMix push/pop (Toggle only) */
 	if (!Setting->PushedSoundMix.IsNull() && Setting->SettingType == EMCore_SettingType::Toggle)
 	{
-		ApplyToSoundMix(WorldContextObject, Setting->PushedSoundMix,
+		MCORE_SCOPE_SETTING_APPLY_COST(Setting->SettingTag, EMCore_SettingApplyPhase::SoundMix);
+		bApplied &= ApplyToSoundMix(WorldContextObject, Setting->PushedSoundMix,
 			Setting->GetSaveKey(), BoolValue);
 	}
 
 	/* Phase 5 — Color Vision Deficiency (Slate renderer, client-only) */
 	if (Setting->ColorVisionRole != EModulusColorVisionRole::None)
 	{
-		ApplyToColorVisionDeficiency(Setting, IntValue, FloatValue);
+		MCORE_SCOPE_SETTING_APPLY_COST(Setting->SettingTag, EMCore_SettingApplyPhase::ColorVision);
+		bApplied &= ApplyToColorVisionDeficiency(Setting, IntValue, FloatValue);
+	}
+
+	if (bApplied)
+	{
+		GMCore_AppliedValues.Add(Setting, { FloatValue, IntValue, BoolValue });
+	}
+	else
+	{
+		GMCore_AppliedValues.Remove(Setting);
 	}
 }
 
@@ -714,8 +1708,9 @@ void UMCore_GameSettingsLibrary::ApplySettingToEngine(const UObject* WorldContex
  * without a follow-up Scalability::SetQualityLevels call. Explicit per-member
  * dispatch is reliable and matches Lyra's pattern.
  *
- * Returns true if the dispatch landed in any bucket, false (with warning) if
- * the FName matched none of them. */
+ * Returns true if the dispatch landed in any bucket and the write reached its
+ * target; false if the FName matched none of them or the target rejected the
+ * value (missing GUS/GEngine, out-of-range resolution index). */
 bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 	float FloatValue, int32 IntValue, bool bBoolValue,
 	const UObject* WorldContextObject)
@@ -733,31 +1728,7 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 	//
 	// Developers can opt in to applying these in PIE by setting
 	// UMCore_CoreSettings::bApplyDisplaySettingsInPIE = true.
-	static const TSet<FName> EditorUnsafeKeys = {
-		TEXT("ScreenResolution"),
-		TEXT("FullscreenMode"),
-		TEXT("bUseHDRDisplayOutput"),
-		TEXT("HDRDisplayOutputNits")
-	};
-
-	static const TSet<FName> EditorUnsafeScalabilityKeys = {
-		TEXT("OverallScalabilityLevel"),
-		TEXT("TextureQuality"),
-		TEXT("ShadowQuality"),
-		TEXT("AntiAliasingQuality"),
-		TEXT("PostProcessQuality"),
-		TEXT("ViewDistanceQuality"),
-		TEXT("FoliageQuality"),
-		TEXT("ShadingQuality"),
-		TEXT("EffectsQuality"),
-		TEXT("GlobalIlluminationQuality"),
-		TEXT("ReflectionQuality"),
-		TEXT("LandscapeQuality"),
-		TEXT("ResolutionQuality"),
-		TEXT("bUseDynamicResolution")
-	};
-
-	if (GIsEditor && !IsRunningGame() && EditorUnsafeKeys.Contains(SetterName))
+	if (GIsEditor && !IsRunningGame() && IsEditorUnsafeDisplayKey(SetterName))
 	{
 		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
 		if (CoreSettings && !CoreSettings->bApplyDisplaySettingsInPIE)
@@ -769,7 +1740,7 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 		}
 	}
 
-	if (GIsEditor && !IsRunningGame() && EditorUnsafeScalabilityKeys.Contains(SetterName))
+	if (GIsEditor && !IsRunningGame() && IsEditorUnsafeScalabilityKey(SetterName))
 	{
 		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
 		if (CoreSettings && !CoreSettings->bApplyScalabilitySettingsInPIE)
@@ -780,11 +1751,7 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 			
 			if (SetterName != TEXT("OverallScalabilityLevel"))
 			{
-				MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-				UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-					WorldContextObject,
-					MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-					EMCore_EventScope::Local);
+				CommitScalabilityChange(WorldContextObject, /*bPushToEngine=*/false);
 			}
 			return true; // Treat as handled; save-path proceeds, engine call suppressed
 		}
@@ -800,13 +1767,25 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 		if (!GUS) { return false; }
 		UMCore_PlayerSettingsSave* Save = GetPlayerSave(WorldContextObject);
 
+		/* The player's preset supersedes every governed level */
+		GMCore_TransientScalabilityLevels.Reset();
 		GUS->SetOverallScalabilityLevel(IntValue);
+		ForgetAppliedScalabilityChildren();
 
 		/* Cascade engine values back to individual save keys so subsequent reloads
 		   and per-widget reads reflect what the preset just applied. */
-		CascadeScalabilityValuesToSave(Save);
+		CascadeScalabilityValuesToSave(WorldContextObject, Save);
 		if (Save) { Save->SetLastSelectedQualityPreset(FMath::Clamp(IntValue, 0, 3)); }
 
+		/* Inside a batch the preset supersedes any child edit queued earlier in the same
+		   pass: cancel the deferred Custom flip and let the batch carry the one event. */
+		if (GMCore_ScalabilityBatch.Depth > 0)
+		{
+			GMCore_ScalabilityBatch.bPendingMarkCustom = false;
+			GMCore_ScalabilityBatch.bPendingEvent = true;
+			return true;
+		}
+
 		/* Notify subscribed widgets to refresh from save. */
 		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
 			WorldContextObject,
@@ -816,152 +1795,18 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 	}
 
 	/* ScalabilityQuality child setters. Each writes the FQualityLevels member directly
-	   and calls Scalability::SetQualityLevels to push the struct values onto the sg.* CVars
-	   (mirrors what UGameUserSettings::ApplyNonResolutionSettings does internally). Without
-	   the cascade call the field write would persist to ini but never affect the running
-	   session. Each commit flips the saved preset to Custom and broadcasts so the
-	   QualityPreset widget refreshes. Listed alphabetically. */
-	if (SetterName == TEXT("AntiAliasingQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.AntiAliasingQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("EffectsQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.EffectsQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("FoliageQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.FoliageQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("GlobalIlluminationQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.GlobalIlluminationQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("LandscapeQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.LandscapeQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("PostProcessQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.PostProcessQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("ReflectionQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.ReflectionQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("ShadingQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.ShadingQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("ShadowQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.ShadowQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("TextureQuality"))
-	{
-		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.TextureQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
-		return true;
-	}
-	if (SetterName == TEXT("ViewDistanceQuality"))
+	   and commits through CommitScalabilityChange, which calls Scalability::SetQualityLevels
+	   to push the struct values onto the sg.* CVars (mirrors what
+	   UGameUserSettings::ApplyNonResolutionSettings does internally). Without the push the
+	   field write would persist to ini but never affect the running session. Each commit
+	   flips the saved preset to Custom and broadcasts so the QualityPreset widget refreshes;
+	   inside an apply pass the push, flip and broadcast coalesce into one at pass end. */
+	if (const FMCore_QualityMember* Member = GetScalabilityChildMembers().Find(SetterName))
 	{
 		if (!GUS) { return false; }
-		GUS->ScalabilityQuality.ViewDistanceQuality = FMath::Clamp(IntValue, 0, 3);
-		Scalability::SetQualityLevels(GUS->ScalabilityQuality);
-
-		MarkQualityPresetCustom(GetPlayerSave(WorldContextObject));
-		UMCore_EventFunctionLibrary::BroadcastSimpleEvent(
-			WorldContextObject,
-			MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange,
-			EMCore_EventScope::Local);
+		GMCore_TransientScalabilityLevels.Remove(SetterName);
+		GUS->ScalabilityQuality.*(*Member) = FMath::Clamp(IntValue, 0, 3);
+		CommitScalabilityChange(WorldContextObject, /*bPushToEngine=*/true);
 		return true;
 	}
 	if (SetterName == TEXT("ScreenResolution"))
@@ -976,16 +1821,15 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 		UKismetSystemLibrary::GetSupportedFullscreenResolutions(Resolutions);
 		Algo::Reverse(Resolutions);
 
-		if (Resolutions.IsValidIndex(IntValue))
-		{
-			GUS->SetScreenResolution(Resolutions[IntValue]);
-		}
-		else
+		if (!Resolutions.IsValidIndex(IntValue))
 		{
+			/* Nothing reached the engine, so the applied-value cache must not record it */
 			UE_LOG(LogModulusSettings, Warning,
 				TEXT("GameSettingsLibrary::ApplyViaNamedSetter -- resolution index %d out of range (%d available)"),
 				IntValue, Resolutions.Num());
+			return false;
 		}
+		GUS->SetScreenResolution(Resolutions[IntValue]);
 		return true;
 	}
 	if (SetterName == TEXT("bUseHDRDisplayOutput"))
@@ -1011,12 +1855,10 @@ bool UMCore_GameSettingsLibrary::ApplyViaNamedSetter(const FName& SetterName,
 	}
 	if (SetterName == TEXT("DisplayGamma"))
 	{
-		if (GEngine)
-		{
-			GEngine->DisplayGamma = FloatValue;
-			UE_LOG(LogModulusSettings, Log,
-				TEXT("GameSettingsLibrary::ApplyViaNamedSetter -- DisplayGamma=%.3f"), FloatValue);
-		}
+		if (!GEngine) { return false; }
+		GEngine->DisplayGamma = FloatValue;
+		UE_LOG(LogModulusSettings, Log,
+			TEXT("GameSettingsLibrary::ApplyViaNamedSetter -- DisplayGamma=%.3f"), FloatValue);
 		return true;
 	}
 	if (SetterName == TEXT("ApplicationScale"))
@@ -1087,54 +1929,39 @@ bool UMCore_GameSettingsLibrary::WriteReflectedProperty(FProperty* Prop, void* C
 // QUALITY PRESET CASCADE / INTENT
 // ============================================================================
 
-void UMCore_GameSettingsLibrary::CascadeScalabilityValuesToSave(UMCore_PlayerSettingsSave* Save)
+void UMCore_GameSettingsLibrary::CascadeScalabilityValuesToSave(const UObject* WorldContextObject,
+	UMCore_PlayerSettingsSave* Save)
 {
 	if (!Save) { return; }
 
 	UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings();
 	if (!GUS) { return; }
 
+	UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(WorldContextObject);
+	const TSharedPtr<const FMCore_SettingDependencyGraph> Graph = Collections ? Collections->GetDependencyGraph() : nullptr;
+	if (Graph)
+	{
+		for (const TPair<FName, FMCore_QualityMember>& Child : GetScalabilityChildMembers())
+		{
+			for (const int32 Node : Graph->FindNodesByNamedSetter(Child.Key))
+			{
+				Save->SetIntValue(Graph->GetDefinition(Node), GUS->ScalabilityQuality.*(Child.Value));
+			}
+		}
+		return;
+	}
+
+	/* No subsystem reachable from this context (no world, or a save touched before the
+	   GameInstance is up): fall back to the full definition walk */
 	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
 	if (!CoreSettings) { return; }
 
-	static const FName Name_TextureQuality(TEXT("TextureQuality"));
-	static const FName Name_ShadowQuality(TEXT("ShadowQuality"));
-	static const FName Name_AntiAliasingQuality(TEXT("AntiAliasingQuality"));
-	static const FName Name_PostProcessQuality(TEXT("PostProcessQuality"));
-	static const FName Name_ViewDistanceQuality(TEXT("ViewDistanceQuality"));
-	static const FName Name_FoliageQuality(TEXT("FoliageQuality"));
-	static const FName Name_EffectsQuality(TEXT("EffectsQuality"));
-	static const FName Name_ShadingQuality(TEXT("ShadingQuality"));
-	static const FName Name_GlobalIlluminationQuality(TEXT("GlobalIlluminationQuality"));
-	static const FName Name_ReflectionQuality(TEXT("ReflectionQuality"));
-
-	auto ReadMember = [GUS](const FName& Member, int32& OutValue) -> bool
-	{
-		if      (Member == Name_TextureQuality)            { OutValue = GUS->ScalabilityQuality.TextureQuality;            return true; }
-		else if (Member == Name_ShadowQuality)             { OutValue = GUS->ScalabilityQuality.ShadowQuality;             return true; }
-		else if (Member == Name_AntiAliasingQuality)       { OutValue = GUS->ScalabilityQuality.AntiAliasingQuality;       return true; }
-		else if (Member == Name_PostProcessQuality)        { OutValue = GUS->ScalabilityQuality.PostProcessQuality;        return true; }
-		else if (Member == Name_ViewDistanceQuality)       { OutValue = GUS->ScalabilityQuality.ViewDistanceQuality;       return true; }
-		else if (Member == Name_FoliageQuality)            { OutValue = GUS->ScalabilityQuality.FoliageQuality;            return true; }
-		else if (Member == Name_EffectsQuality)            { OutValue = GUS->ScalabilityQuality.EffectsQuality;            return true; }
-		else if (Member == Name_ShadingQuality)            { OutValue = GUS->ScalabilityQuality.ShadingQuality;            return true; }
-		else if (Member == Name_GlobalIlluminationQuality) { OutValue = GUS->ScalabilityQuality.GlobalIlluminationQuality; return true; }
-		else if (Member == Name_ReflectionQuality)         { OutValue = GUS->ScalabilityQuality.ReflectionQuality;         return true; }
-		return false;
-	};
-
-	const TArray<UMCore_DA_SettingsCollection*>& Collections = CoreSettings->GetAllSettingsCollections();
-	for (const UMCore_DA_SettingsCollection* Collection : Collections)
+	const TMap<FName, FMCore_QualityMember>& ChildMembers = GetScalabilityChildMembers();
+	for (UMCore_DA_SettingDefinition* Definition : CoreSettings->GetAllSettingDefinitions())
 	{
-		if (!Collection) { continue; }
-		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Definition : Collection->GetAllSettings())
+		if (const FMCore_QualityMember* Member = ChildMembers.Find(Definition->NamedSetter))
 		{
-			if (!Definition) { continue; }
-			int32 EngineValue = 0;
-			if (ReadMember(Definition->NamedSetter, EngineValue))
-			{
-				Save->SetIntSetting(Definition->GetSaveKey(), EngineValue);
-			}
+			Save->SetIntValue(Definition, GUS->ScalabilityQuality.*(*Member));
 		}
 	}
 }
@@ -1148,64 +1975,108 @@ void UMCore_GameSettingsLibrary::MarkQualityPresetCustom(UMCore_PlayerSettingsSa
 // CONSOLE VARIABLES
 // ============================================================================
 
-void UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, float Value)
+bool UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, float Value)
 {
 	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*CVarName.ToString());
 	if (CVar)
 	{
 		CVar->Set(Value, ECVF_SetByCode);
+		return true;
 	}
-	else
-	{
-		UE_LOG(LogModulusSettings, Warning,
-			TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
-	}
+
+	UE_LOG(LogModulusSettings, Warning,
+		TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
+	return false;
 }
 
-void UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, int32 Value)
+bool UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, int32 Value)
 {
 	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*CVarName.ToString());
 	if (CVar)
 	{
 		CVar->Set(Value, ECVF_SetByCode);
+		return true;
 	}
-	else
-	{
-		UE_LOG(LogModulusSettings, Warning,
-			TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
-	}
+
+	UE_LOG(LogModulusSettings, Warning,
+		TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
+	return false;
 }
 
-void UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, bool Value)
+bool UMCore_GameSettingsLibrary::ApplyToConsoleVariable(const FName& CVarName, bool Value)
 {
 	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*CVarName.ToString());
 	if (CVar)
 	{
 		CVar->Set(Value, ECVF_SetByCode);
+		return true;
 	}
-	else
-	{
-		UE_LOG(LogModulusSettings, Warning,
-			TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
-	}
+
+	UE_LOG(LogModulusSettings, Warning,
+		TEXT("GameSettingsLibrary::ApplyToConsoleVariable -- console variable '%s' not found"), *CVarName.ToString());
+	return false;
 }
 
 // ============================================================================
 // SOUND CLASS
 // ============================================================================
 
+DECLARE_CYCLE_STAT(TEXT("ApplyToSoundClass"), STAT_MCore_ApplyToSoundClass, STATGROUP_ModulusSettings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SoundClass Overrides Pushed"), STAT_MCore_SoundClassOverridesPushed, STATGROUP_ModulusSettings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sound Assets Loaded On Apply"), STAT_MCore_SoundAssetsLoadedOnApply, STATGROUP_ModulusSettings);
+
 namespace
 {
 	/* File-scope cache of the most recent slider value committed per SoundClass.
-	 * Drives the parent-chain product cascade in ApplyToSoundClass — every commit
-	 * walks the cache and re-pushes Product(self × cached ancestors) for every
-	 * tracked class, so a Master adjustment correctly propagates to all
-	 * descendant categories without clobbering their independently-set values.
+	 * Drives the parent-chain product cascade in ApplyToSoundClass — a commit
+	 * re-pushes Product(self × cached ancestors) for the committed class and
+	 * every tracked descendant of it, so a Master adjustment correctly
+	 * propagates to all descendant categories without clobbering their
+	 * independently-set values, while a leaf adjustment pushes only itself.
 	 * Weak pointers so cache entries don't extend SoundClass lifetimes; stale
 	 * entries are skipped at walk time. */
 	TMap<TWeakObjectPtr<USoundClass>, float> GMCore_VolumeCache;
 
 	constexpr int32 GMCore_VolumeWalkMaxDepth = 16;
+
+	/* Sound assets are pinned by UMCore_SettingsCollectionSubsystem when collections
+	 * resolve, so Get() normally succeeds. The synchronous load is a fallback for
+	 * assets that were not reachable from any collection (counted so it shows up). */
+	template <typename TAsset>
+	TAsset* ResolveSoundAsset(const TSoftObjectPtr<TAsset>& SoftRef)
+	{
+		if (TAsset* Resolved = SoftRef.Get()) { return Resolved; }
+		if (SoftRef.IsNull()) { return nullptr; }
+
+		INC_DWORD_STAT(STAT_MCore_SoundAssetsLoadedOnApply);
+		UE_LOG(LogModulusSettings, Verbose,
+			TEXT("GameSettingsLibrary::ResolveSoundAsset -- '%s' not pinned, loading synchronously"),
+			*SoftRef.ToString());
+		return SoftRef.LoadSynchronous();
+	}
+
+	/* Returns the volume product along TrackedClass's ParentClass chain, and whether
+	 * ChangedClass is TrackedClass itself or one of its ancestors. */
+	float ComputeVolumeProduct(USoundClass* TrackedClass, float SelfVolume,
+		const USoundClass* ChangedClass, bool& bOutAffected)
+	{
+		bOutAffected = TrackedClass == ChangedClass;
+
+		float Product = SelfVolume;
+		USoundClass* Ancestor = TrackedClass->ParentClass;
+		int32 Depth = 0;
+		while (Ancestor && Depth < GMCore_VolumeWalkMaxDepth)
+		{
+			bOutAffected |= Ancestor == ChangedClass;
+			if (const float* AncestorVolume = GMCore_VolumeCache.Find(Ancestor))
+			{
+				Product *= *AncestorVolume;
+			}
+			Ancestor = Ancestor->ParentClass;
+			++Depth;
+		}
+		return Product;
+	}
 }
 
 /* Applies a volume slider commit to a SoundClass via the SoundMix override
@@ -1222,32 +2093,43 @@ namespace
  * Parent-chain cascade: SetSoundMixClassOverride with bApplyToChildren=true
  * last-write-wins clobbers per-category overrides; with false, parent volumes
  * never propagate. We keep a per-class cache of the last committed value and,
- * on every commit, re-push Product(self × cached ancestors via ParentClass)
- * for every tracked class. Idempotent: classes whose product is unchanged
- * end up overriding to the same value they already had. Depth-bailed at 16
+ * on each commit, re-push Product(self × cached ancestors via ParentClass)
+ * for the committed class and the tracked classes beneath it. Classes outside
+ * that subtree keep their existing override untouched. Depth-bailed at 16
  * to defend against malformed (cyclic) ParentClass hierarchies — the engine
  * has no cycle guard of its own. */
-void UMCore_GameSettingsLibrary::ApplyToSoundClass(
+bool UMCore_GameSettingsLibrary::ApplyToSoundClass(
 	const UObject* WorldContextObject,
 	const TSoftObjectPtr<USoundClass>& SoundClassRef,
 	float Volume)
 {
-	USoundClass* LoadedClass = SoundClassRef.LoadSynchronous();
+	SCOPE_CYCLE_COUNTER(STAT_MCore_ApplyToSoundClass);
+
+	const UWorld* World = GEngine && WorldContextObject ? GEngine->GetWorldFromContextObject(
+		WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogModulusSettings, Verbose,
+			TEXT("GameSettingsLibrary::ApplyToSoundClass -- no world, '%s' not applied"), *SoundClassRef.ToString());
+		return false;
+	}
+
+	USoundClass* LoadedClass = ResolveSoundAsset(SoundClassRef);
 	if (!LoadedClass)
 	{
 		UE_LOG(LogModulusSettings, Warning,
 			TEXT("GameSettingsLibrary::ApplyToSoundClass -- SoundClass failed to load (ref '%s')"),
 			*SoundClassRef.ToString());
-		return;
+		return false;
 	}
 
 	const UMCore_CoreSettings* CoreSettings = GetDefault<UMCore_CoreSettings>();
-	USoundMix* VolumeMix = CoreSettings ? CoreSettings->VolumeMix.LoadSynchronous() : nullptr;
+	USoundMix* VolumeMix = CoreSettings ? ResolveSoundAsset(CoreSettings->VolumeMix) : nullptr;
 	if (!VolumeMix)
 	{
 		UE_LOG(LogModulusSettings, Warning,
 			TEXT("GameSettingsLibrary::ApplyToSoundClass -- VolumeMix not configured in MCore_CoreSettings"));
-		return;
+		return false;
 	}
 
 	EnsureVolumeMixActive(WorldContextObject, VolumeMix);
@@ -1255,23 +2137,15 @@ void UMCore_GameSettingsLibrary::ApplyToSoundClass(
 	const float ClampedVolume = FMath::Clamp(Volume, 0.0f, 1.0f);
 	GMCore_VolumeCache.Add(LoadedClass, ClampedVolume);
 
+	int32 PushedCount = 0;
 	for (const TPair<TWeakObjectPtr<USoundClass>, float>& Entry : GMCore_VolumeCache)
 	{
 		USoundClass* TrackedClass = Entry.Key.Get();
 		if (!TrackedClass) { continue; }
 
-		float Product = Entry.Value;
-		USoundClass* Ancestor = TrackedClass->ParentClass;
-		int32 Depth = 0;
-		while (Ancestor && Depth < GMCore_VolumeWalkMaxDepth)
-		{
-			if (const float* AncestorVolume = GMCore_VolumeCache.Find(Ancestor))
-			{
-				Product *= *AncestorVolume;
-			}
-			Ancestor = Ancestor->ParentClass;
-			++Depth;
-		}
+		bool bAffected = false;
+		const float Product = ComputeVolumeProduct(TrackedClass, Entry.Value, LoadedClass, bAffected);
+		if (!bAffected) { continue; }
 
 		UGameplayStatics::SetSoundMixClassOverride(
 			WorldContextObject,
@@ -1281,11 +2155,15 @@ void UMCore_GameSettingsLibrary::ApplyToSoundClass(
 			1.0f,    /* PitchAdjuster */
 			0.5f,    /* FadeInTime */
 			false);  /* bApplyToChildren */
+		++PushedCount;
 	}
 
-	UE_LOG(LogModulusSettings, Log,
-		TEXT("GameSettingsLibrary::ApplyToSoundClass -- committed %s = %.3f, %d cached classes re-pushed"),
-		*LoadedClass->GetName(), ClampedVolume, GMCore_VolumeCache.Num());
+	INC_DWORD_STAT_BY(STAT_MCore_SoundClassOverridesPushed, PushedCount);
+
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("GameSettingsLibrary::ApplyToSoundClass -- committed %s = %.3f, %d of %d cached classes re-pushed"),
+		*LoadedClass->GetName(), ClampedVolume, PushedCount, GMCore_VolumeCache.Num());
+	return true;
 }
 
 void UMCore_GameSettingsLibrary::EnsureVolumeMixActive(
@@ -1304,38 +2182,38 @@ void UMCore_GameSettingsLibrary::EnsureVolumeMixActive(
 // SOUND MIX
 // ============================================================================
 
-void UMCore_GameSettingsLibrary::ApplyToSoundMix(const UObject* WorldContextObject,
+bool UMCore_GameSettingsLibrary::ApplyToSoundMix(const UObject* WorldContextObject,
 	TSoftObjectPtr<USoundMix> SoundMixRef, const FString& SaveKey, bool bDesiredActive)
 {
 	static TMap<FString, bool> PushedState;
 	static Audio::FDeviceId LastSeenDeviceId = INDEX_NONE;
 	
-	if (!WorldContextObject) { return; }
+	if (!WorldContextObject) { return false; }
 	
-	if (UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(
-		WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr)
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(
+		WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	if (!World) { return false; }
+
+	if (FAudioDeviceHandle DeviceHandle = World->GetAudioDevice())
 	{
-		if (FAudioDeviceHandle DeviceHandle = World->GetAudioDevice())
+		const Audio::FDeviceId CurrentDeviceId = DeviceHandle->DeviceID;
+		if (CurrentDeviceId != LastSeenDeviceId)
 		{
-			const Audio::FDeviceId CurrentDeviceId = DeviceHandle->DeviceID;
-			if (CurrentDeviceId != LastSeenDeviceId)
-			{
-				PushedState.Reset();
-				LastSeenDeviceId = CurrentDeviceId;
-			}
+			PushedState.Reset();
+			LastSeenDeviceId = CurrentDeviceId;
 		}
 	}
 	
 	const bool* ExistingState = PushedState.Find(SaveKey);
-	if (ExistingState && *ExistingState == bDesiredActive) { return; }
+	if (ExistingState && *ExistingState == bDesiredActive) { return true; }
 	
-	USoundMix* Mix = SoundMixRef.LoadSynchronous();
+	USoundMix* Mix = ResolveSoundAsset(SoundMixRef);
 	if (!Mix)
 	{
 		UE_LOG(LogModulusSettings, Warning,
 			TEXT("GameSettingsLibrary::ApplyToSoundMix -- failed to load SoundMix '%s'"),
 			*SoundMixRef.ToString());
-		return;
+		return false;
 	}
 
 	if (bDesiredActive)
@@ -1352,6 +2230,7 @@ void UMCore_GameSettingsLibrary::ApplyToSoundMix(const UObject* WorldContextObje
 	UE_LOG(LogModulusSettings, Verbose,
 		TEXT("GameSettingsLibrary::ApplyToSoundMix -- SoundMix '%s' %s (key: %s)"),
 		*Mix->GetName(), bDesiredActive ? TEXT("pushed") : TEXT("popped"), *SaveKey);
+	return true;
 }
 
 // ============================================================================
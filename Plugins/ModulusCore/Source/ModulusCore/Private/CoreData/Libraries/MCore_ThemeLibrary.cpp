@@ -4,8 +4,10 @@
 #include "CoreData/Libraries/MCore_ThemeLibrary.h"
 
 #include "CoreData/Assets/UI/Styles/MCore_PDA_SliderStyle.h"
+#include "CoreData/Assets/UI/Themes/MCore_PDA_UITheme_Base.h"
 #include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
 #include "CoreData/Logging/LogModulusUI.h"
+#include "CoreUI/MCore_UISubsystem.h"
 
 #include "CommonTextBlock.h"
 #include "CommonButtonBase.h"
@@ -16,6 +18,29 @@ void UMCore_ThemeLibrary::ApplyTextStyleFromTheme(const ULocalPlayer* LocalPlaye
 {
 	if (!TextBlock || TextStyleArray.IsEmpty()) { return; }
 	
+	int32 SizeIndex{0};
+	if (LocalPlayer)
+	{
+		/* The UI subsystem caches the size index; reading the setting is a save lookup */
+		if (const UMCore_UISubsystem* UI = LocalPlayer->GetSubsystem<UMCore_UISubsystem>())
+		{
+			SizeIndex = UI->GetResolvedTextSizeIndex();
+		}
+		else if (const UMCore_PlayerSettingsSubsystem* SettingsSubsystem = LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>())
+		{
+			SizeIndex = SettingsSubsystem->GetActiveTextSizeIndex();
+		}
+	}
+
+	ApplyTextStyleAtSizeIndex(TextBlock, TextStyleArray, SizeIndex);
+}
+
+#if !UE_BUILD_SHIPPING
+void UMCore_ThemeLibrary::ApplyTextStyleFromSettings(const ULocalPlayer* LocalPlayer, UCommonTextBlock* TextBlock,
+	const TArray<TSubclassOf<UCommonTextStyle>>& TextStyleArray)
+{
+	if (!TextBlock || TextStyleArray.IsEmpty()) { return; }
+
 	int32 SizeIndex{0};
 	if (LocalPlayer)
 	{
@@ -24,7 +49,14 @@ void UMCore_ThemeLibrary::ApplyTextStyleFromTheme(const ULocalPlayer* LocalPlaye
 			SizeIndex = SettingsSubsystem->GetActiveTextSizeIndex();
 		}
 	}
-	
+
+	ApplyTextStyleAtSizeIndex(TextBlock, TextStyleArray, SizeIndex);
+}
+#endif
+
+void UMCore_ThemeLibrary::ApplyTextStyleAtSizeIndex(UCommonTextBlock* TextBlock,
+	const TArray<TSubclassOf<UCommonTextStyle>>& TextStyleArray, int32 SizeIndex)
+{
 	const TSubclassOf<UCommonTextStyle> ResolvedStyle =
 		TextStyleArray.IsValidIndex(SizeIndex)
 		? TextStyleArray[SizeIndex]
@@ -34,6 +66,41 @@ void UMCore_ThemeLibrary::ApplyTextStyleFromTheme(const ULocalPlayer* LocalPlaye
 	UE_LOG(LogModulusUI, VeryVerbose, TEXT("ThemeLibrary::ApplyTextStyleFromTheme -- applied style at size index %d"), SizeIndex);
 }
 
+void UMCore_ThemeLibrary::ApplyThemeTextStyle(const ULocalPlayer* LocalPlayer, UCommonTextBlock* TextBlock,
+	const UMCore_PDA_UITheme_Base* Theme, EMCore_ThemeTextRole Role)
+{
+	if (!TextBlock || !Theme) { return; }
+
+	const UMCore_UISubsystem* UI = LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_UISubsystem>() : nullptr;
+	if (UI && UI->GetActiveTheme() == Theme)
+	{
+		if (const TSubclassOf<UCommonTextStyle> ResolvedStyle = UI->GetResolvedTextStyle(Role))
+		{
+			TextBlock->SetStyle(ResolvedStyle);
+		}
+		return;
+	}
+
+	ApplyTextStyleFromTheme(LocalPlayer, TextBlock, Theme->GetTextStyles(Role));
+}
+
+FSliderStyle UMCore_ThemeLibrary::ResolveThemeSliderStyle(const ULocalPlayer* LocalPlayer,
+	const UMCore_PDA_UITheme_Base* Theme, const FSliderStyle& BaseStyle)
+{
+	if (!Theme) { return BaseStyle; }
+
+	const UMCore_UISubsystem* UI = LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_UISubsystem>() : nullptr;
+	if (UI && UI->GetActiveTheme() == Theme)
+	{
+		if (const FSliderStyle* ResolvedStyle = UI->GetResolvedSliderStyle())
+		{
+			return *ResolvedStyle;
+		}
+	}
+
+	return BuildSliderStyle(Theme->SliderStyle, BaseStyle);
+}
+
 FSliderStyle UMCore_ThemeLibrary::BuildSliderStyle(const UMCore_PDA_SliderStyle* SliderStyleDA,
 	const FSliderStyle& BaseStyle)
 {
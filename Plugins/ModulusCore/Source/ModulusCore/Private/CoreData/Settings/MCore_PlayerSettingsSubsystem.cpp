@@ -2,6 +2,7 @@
 
 #include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
 
+#include "CoreData/Settings/MCore_SettingsCollectionSubsystem.h"
 #include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
 #include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
 #include "CoreData/Tags/MCore_SettingsTags.h"
@@ -17,6 +18,8 @@ void UMCore_PlayerSettingsSubsystem::Deinitialize()
 		CachedPlayerSettings = nullptr;
 	}
 
+	SettingsHistory = FMCore_SettingsHistory();
+
 	Super::Deinitialize();
 }
 
@@ -27,6 +30,9 @@ void UMCore_PlayerSettingsSubsystem::PlayerControllerChanged(APlayerController*
 	if (!NewPlayerController || bBootApplyDone) { return; }
 
 	bBootApplyDone = true;
+
+	/* Engine state may have drifted since a previous session in this process (PIE). */
+	UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache();
 	UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(this);
 
 	UE_LOG(LogModulusSettings, Log,
@@ -51,6 +57,20 @@ UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSubsystem::GetPlayerSettings()
 			*CachedPlayerSettings->GetCachedSlotName());
 	}
 
+	/* Pointer compare per call; rebinds only after the collection cache is rebuilt. */
+	if (const ULocalPlayer* LocalPlayer = GetLocalPlayer())
+	{
+		if (UMCore_SettingsCollectionSubsystem* Collections =
+			UMCore_SettingsCollectionSubsystem::Get(LocalPlayer->GetGameInstance()))
+		{
+			const TSharedPtr<const FMCore_SettingOrdinalTable> OrdinalTable = Collections->GetSettingOrdinalTable();
+			if (!CachedPlayerSettings->IsBoundTo(OrdinalTable.Get()))
+			{
+				CachedPlayerSettings->BindOrdinals(OrdinalTable);
+			}
+		}
+	}
+
 	return CachedPlayerSettings;
 }
 
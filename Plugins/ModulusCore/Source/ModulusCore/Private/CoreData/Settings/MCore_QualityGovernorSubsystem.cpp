@@ -0,0 +1,395 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Settings/MCore_QualityGovernorSubsystem.h"
+
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
+#include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Logging/StatModulusSettings.h"
+#include "CoreData/Types/Settings/MCore_DA_QualityGovernorRules.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Quality Governor Steps"), STAT_MCore_QualityGovernorSteps, STATGROUP_ModulusSettings);
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	FAutoConsoleCommand CmdQualityGovernorSelfTest(
+		TEXT("Modulus.Settings.QualityGovernor.SelfTest"),
+		TEXT("Feeds synthetic frame-time series through the quality governor and checks the levels it picks. Usage: Modulus.Settings.QualityGovernor.SelfTest"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FMCore_QualityGovernor::RunSelfTest();
+		}));
+}
+#endif
+
+// ============================================================================
+// GOVERNOR
+// ============================================================================
+
+void FMCore_QualityGovernor::Configure(const UMCore_DA_QualityGovernorRules& Rules)
+{
+	DowngradeAboveMs = Rules.DowngradeAboveMs;
+	UpgradeBelowMs = FMath::Min(Rules.UpgradeBelowMs, Rules.DowngradeAboveMs);
+	DowngradeSustainSeconds = Rules.DowngradeSustainSeconds;
+	UpgradeSustainSeconds = Rules.UpgradeSustainSeconds;
+	StepCooldownSeconds = Rules.StepCooldownSeconds;
+
+	GroupNames.Reset();
+	MinLevels.Reset();
+	for (const FMCore_QualityGovernorGroupRule& Group : Rules.Groups)
+	{
+		if (Group.ScalabilityGroup.IsNone() || GroupNames.Contains(Group.ScalabilityGroup)) { continue; }
+		GroupNames.Add(Group.ScalabilityGroup);
+		MinLevels.Add(FMath::Clamp(Group.MinLevel, 0, 3));
+	}
+
+	CeilingLevels.Init(3, GroupNames.Num());
+	Levels.Init(3, GroupNames.Num());
+
+	Samples.SetNumZeroed(FMath::Max(Rules.AveragingWindowFrames, 1));
+	ResetTiming();
+}
+
+void FMCore_QualityGovernor::SetCeilingLevels(TConstArrayView<int32> InCeilingLevels)
+{
+	check(InCeilingLevels.Num() == GroupNames.Num());
+	for (int32 GroupIndex = 0; GroupIndex < GroupNames.Num(); ++GroupIndex)
+	{
+		AdoptLevel(GroupIndex, InCeilingLevels[GroupIndex]);
+	}
+}
+
+void FMCore_QualityGovernor::AdoptLevel(int32 GroupIndex, int32 Level)
+{
+	CeilingLevels[GroupIndex] = FMath::Clamp(Level, 0, 3);
+	Levels[GroupIndex] = CeilingLevels[GroupIndex];
+}
+
+void FMCore_QualityGovernor::ResetTiming()
+{
+	NextSampleIndex = 0;
+	SampleCount = 0;
+	SampleSum = 0.0f;
+	OverBudgetSeconds = 0.0f;
+	UnderBudgetSeconds = 0.0f;
+	CooldownRemaining = 0.0f;
+}
+
+float FMCore_QualityGovernor::GetAverageFrameTimeMs() const
+{
+	return SampleCount > 0 ? SampleSum / SampleCount : 0.0f;
+}
+
+TOptional<FMCore_QualityGovernor::FStep> FMCore_QualityGovernor::AddFrameTimeSample(
+	float FrameTimeMs, float DeltaSeconds)
+{
+	if (Samples.Num() == 0) { return {}; }
+
+	/* Moving average over the ring buffer */
+	if (SampleCount == Samples.Num())
+	{
+		SampleSum -= Samples[NextSampleIndex];
+	}
+	else
+	{
+		++SampleCount;
+	}
+	Samples[NextSampleIndex] = FrameTimeMs;
+	SampleSum += FrameTimeMs;
+	NextSampleIndex = (NextSampleIndex + 1) % Samples.Num();
+
+	CooldownRemaining = FMath::Max(CooldownRemaining - DeltaSeconds, 0.0f);
+
+	/* Hysteresis: only time spent outside the band counts, and leaving it resets the opposite timer */
+	const float AverageMs = GetAverageFrameTimeMs();
+	if (AverageMs > DowngradeAboveMs)
+	{
+		OverBudgetSeconds += DeltaSeconds;
+		UnderBudgetSeconds = 0.0f;
+	}
+	else if (AverageMs < UpgradeBelowMs)
+	{
+		UnderBudgetSeconds += DeltaSeconds;
+		OverBudgetSeconds = 0.0f;
+	}
+	else
+	{
+		OverBudgetSeconds = 0.0f;
+		UnderBudgetSeconds = 0.0f;
+	}
+
+	/* Wait for a full window so a handful of hitches right after a step can't decide the next one */
+	if (CooldownRemaining > 0.0f || SampleCount < Samples.Num()) { return {}; }
+
+	TOptional<FStep> Step;
+	if (OverBudgetSeconds >= DowngradeSustainSeconds)
+	{
+		for (int32 GroupIndex = 0; GroupIndex < Levels.Num(); ++GroupIndex)
+		{
+			if (Levels[GroupIndex] > MinLevels[GroupIndex])
+			{
+				Step = FStep{GroupIndex, --Levels[GroupIndex]};
+				break;
+			}
+		}
+	}
+	else if (UnderBudgetSeconds >= UpgradeSustainSeconds)
+	{
+		for (int32 GroupIndex = Levels.Num() - 1; GroupIndex >= 0; --GroupIndex)
+		{
+			if (Levels[GroupIndex] < CeilingLevels[GroupIndex])
+			{
+				Step = FStep{GroupIndex, ++Levels[GroupIndex]};
+				break;
+			}
+		}
+	}
+
+	if (Step.IsSet())
+	{
+		/* Measure the new levels from scratch */
+		ResetTiming();
+		CooldownRemaining = StepCooldownSeconds;
+	}
+
+	return Step;
+}
+
+#if !UE_BUILD_SHIPPING
+bool FMCore_QualityGovernor::RunSelfTest()
+{
+	/* Cooldown longer than the downgrade sustain, so back-to-back drops are cooldown-bound */
+	UMCore_DA_QualityGovernorRules* Rules = NewObject<UMCore_DA_QualityGovernorRules>(GetTransientPackage());
+	Rules->DowngradeAboveMs = 18.0f;
+	Rules->UpgradeBelowMs = 14.0f;
+	Rules->AveragingWindowFrames = 10;
+	Rules->DowngradeSustainSeconds = 0.5f;
+	Rules->UpgradeSustainSeconds = 2.0f;
+	Rules->StepCooldownSeconds = 1.5f;
+	FMCore_QualityGovernorGroupRule& ShadowRule = Rules->Groups.AddDefaulted_GetRef();
+	ShadowRule.ScalabilityGroup = TEXT("ShadowQuality");
+	ShadowRule.MinLevel = 1;
+	FMCore_QualityGovernorGroupRule& EffectsRule = Rules->Groups.AddDefaulted_GetRef();
+	EffectsRule.ScalabilityGroup = TEXT("EffectsQuality");
+	EffectsRule.MinLevel = 0;
+
+	FMCore_QualityGovernor Governor;
+	Governor.Configure(*Rules);
+	Governor.SetCeilingLevels({ 3, 2 });
+
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+	double ElapsedSeconds = 0.0;
+	double LastStepSeconds = 0.0;
+	int32 NumFailures = 0;
+
+	/* Feeds FrameTimeMs for Seconds; checks cooldown and sustain spacing on every step */
+	auto Feed = [&](const TCHAR* Phase, float FrameTimeMs, float Seconds, float SustainSeconds)
+	{
+		int32 NumSteps = 0;
+		const int32 NumSamples = FMath::RoundToInt(Seconds / DeltaSeconds);
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			ElapsedSeconds += DeltaSeconds;
+			if (!Governor.AddFrameTimeSample(FrameTimeMs, DeltaSeconds).IsSet()) { continue; }
+
+			++NumSteps;
+			const double SinceLastStep = ElapsedSeconds - LastStepSeconds;
+			const double MinSpacing = FMath::Max(SustainSeconds, LastStepSeconds > 0.0 ? Rules->StepCooldownSeconds : 0.0f);
+			if (SinceLastStep < MinSpacing - DeltaSeconds)
+			{
+				UE_LOG(LogModulusSettings, Error,
+					TEXT("QualityGovernor::RunSelfTest -- %s: stepped %.3fs after the last step, expected at least %.3fs"),
+					Phase, SinceLastStep, MinSpacing);
+				++NumFailures;
+			}
+			LastStepSeconds = ElapsedSeconds;
+		}
+		return NumSteps;
+	};
+
+	auto Expect = [&](const TCHAR* Phase, int32 NumSteps, int32 ExpectedSteps, int32 ExpectedShadow, int32 ExpectedEffects)
+	{
+		if (NumSteps != ExpectedSteps || Governor.GetLevel(0) != ExpectedShadow || Governor.GetLevel(1) != ExpectedEffects)
+		{
+			UE_LOG(LogModulusSettings, Error,
+				TEXT("QualityGovernor::RunSelfTest -- %s: %d step(s) to [%d, %d], expected %d step(s) to [%d, %d]"),
+				Phase, NumSteps, Governor.GetLevel(0), Governor.GetLevel(1), ExpectedSteps, ExpectedShadow, ExpectedEffects);
+			++NumFailures;
+		}
+	};
+
+	/* Drop: first group steps once the breach is sustained, then the cooldown holds */
+	Expect(TEXT("drop"), Feed(TEXT("drop"), 25.0f, 1.0f, Rules->DowngradeSustainSeconds), 1, 2, 2);
+
+	/* Hysteresis band: with room to move either way, frame time between the thresholds holds */
+	Expect(TEXT("hysteresis band"), Feed(TEXT("hysteresis band"), 16.0f, 10.0f, 0.0f), 0, 2, 2);
+
+	/* Flapping: breaches shorter than either sustain never step */
+	int32 FlapSteps = 0;
+	for (int32 Flap = 0; Flap < 15; ++Flap)
+	{
+		FlapSteps += Feed(TEXT("flapping"), 25.0f, 0.3f, 0.0f);
+		FlapSteps += Feed(TEXT("flapping"), 10.0f, 0.3f, 0.0f);
+	}
+	Expect(TEXT("flapping"), FlapSteps, 0, 2, 2);
+
+	/* Sustained drop: groups step in priority order, one per cooldown, down to their MinLevel */
+	Expect(TEXT("sustained drop"), Feed(TEXT("sustained drop"), 25.0f, 8.0f, Rules->DowngradeSustainSeconds), 3, 1, 0);
+
+	/* Recovery: groups come back in reverse order, one per upgrade sustain, up to their ceilings */
+	Expect(TEXT("recovery"), Feed(TEXT("recovery"), 10.0f, 14.0f, Rules->UpgradeSustainSeconds), 4, 3, 2);
+	Expect(TEXT("at ceiling"), Feed(TEXT("at ceiling"), 10.0f, 5.0f, Rules->UpgradeSustainSeconds), 0, 3, 2);
+	Rules->MarkAsGarbage();
+
+	if (NumFailures == 0)
+	{
+		UE_LOG(LogModulusSettings, Display, TEXT("QualityGovernor::RunSelfTest -- passed"));
+	}
+	else
+	{
+		UE_LOG(LogModulusSettings, Error, TEXT("QualityGovernor::RunSelfTest -- %d failure(s)"), NumFailures);
+	}
+	return NumFailures == 0;
+}
+#endif
+
+// ============================================================================
+// SUBSYSTEM
+// ============================================================================
+
+void UMCore_QualityGovernorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings || !CoreSettings->bEnableQualityGovernor) { return; }
+
+	if (UMCore_DA_QualityGovernorRules* Rules = CoreSettings->QualityGovernorRules.LoadSynchronous())
+	{
+		StartGovernor(Rules);
+	}
+	else
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("QualityGovernorSubsystem::Initialize -- bEnableQualityGovernor is set but QualityGovernorRules failed to load ('%s')"),
+			*CoreSettings->QualityGovernorRules.ToString());
+	}
+}
+
+void UMCore_QualityGovernorSubsystem::Deinitialize()
+{
+	StopGovernor();
+	Super::Deinitialize();
+}
+
+void UMCore_QualityGovernorSubsystem::StartGovernor(UMCore_DA_QualityGovernorRules* Rules)
+{
+	if (!Rules)
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("QualityGovernorSubsystem::StartGovernor -- null Rules, governor not started"));
+		return;
+	}
+
+	StopGovernor();
+
+	ActiveRules = Rules;
+	Governor.Configure(*Rules);
+
+	ObservedEngineLevels.SetNum(Governor.NumGroups());
+	for (int32 GroupIndex = 0; GroupIndex < Governor.NumGroups(); ++GroupIndex)
+	{
+		const int32 EngineLevel = UMCore_GameSettingsLibrary::GetActiveScalabilityLevel(Governor.GetGroupName(GroupIndex));
+		ObservedEngineLevels[GroupIndex] = EngineLevel;
+		if (EngineLevel != INDEX_NONE)
+		{
+			Governor.AdoptLevel(GroupIndex, EngineLevel);
+		}
+	}
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UMCore_QualityGovernorSubsystem::HandleTick));
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("QualityGovernorSubsystem::StartGovernor -- governing %d group(s) with '%s'"),
+		Governor.NumGroups(), *Rules->GetName());
+}
+
+void UMCore_QualityGovernorSubsystem::StopGovernor()
+{
+	if (!ActiveRules) { return; }
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	TMap<FName, int32> RestoredLevels;
+	for (int32 GroupIndex = 0; GroupIndex < Governor.NumGroups(); ++GroupIndex)
+	{
+		if (Governor.GetLevel(GroupIndex) != Governor.GetCeilingLevel(GroupIndex))
+		{
+			RestoredLevels.Add(Governor.GetGroupName(GroupIndex), Governor.GetCeilingLevel(GroupIndex));
+		}
+	}
+	UMCore_GameSettingsLibrary::ApplyTransientScalabilityLevels(RestoredLevels);
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("QualityGovernorSubsystem::StopGovernor -- stopped, %d group(s) restored"), RestoredLevels.Num());
+
+	ActiveRules = nullptr;
+	ObservedEngineLevels.Reset();
+}
+
+int32 UMCore_QualityGovernorSubsystem::GetGovernedLevel(FName ScalabilityGroup) const
+{
+	if (!ActiveRules) { return INDEX_NONE; }
+
+	const int32 GroupIndex = Governor.FindGroupIndex(ScalabilityGroup);
+	return GroupIndex != INDEX_NONE ? Governor.GetLevel(GroupIndex) : INDEX_NONE;
+}
+
+void UMCore_QualityGovernorSubsystem::FeedFrameTimeSample(float FrameTimeMs, float DeltaSeconds)
+{
+	if (!ActiveRules) { return; }
+
+	AdoptExternalLevelChanges();
+
+	const TOptional<FMCore_QualityGovernor::FStep> Step = Governor.AddFrameTimeSample(FrameTimeMs, DeltaSeconds);
+	if (!Step.IsSet()) { return; }
+
+	const FName GroupName = Governor.GetGroupName(Step->GroupIndex);
+	UMCore_GameSettingsLibrary::ApplyTransientScalabilityLevels({ { GroupName, Step->NewLevel } });
+	ObservedEngineLevels[Step->GroupIndex] = UMCore_GameSettingsLibrary::GetActiveScalabilityLevel(GroupName);
+	INC_DWORD_STAT(STAT_MCore_QualityGovernorSteps);
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("QualityGovernorSubsystem::FeedFrameTimeSample -- %s -> %d (ceiling %d)"),
+		*GroupName.ToString(), Step->NewLevel, Governor.GetCeilingLevel(Step->GroupIndex));
+
+	OnGovernorStep.Broadcast(GroupName, Step->NewLevel);
+}
+
+bool UMCore_QualityGovernorSubsystem::HandleTick(float DeltaTime)
+{
+	FeedFrameTimeSample(DeltaTime * 1000.0f, DeltaTime);
+	return true;
+}
+
+void UMCore_QualityGovernorSubsystem::AdoptExternalLevelChanges()
+{
+	for (int32 GroupIndex = 0; GroupIndex < Governor.NumGroups(); ++GroupIndex)
+	{
+		const int32 EngineLevel = UMCore_GameSettingsLibrary::GetActiveScalabilityLevel(Governor.GetGroupName(GroupIndex));
+		if (EngineLevel == INDEX_NONE || EngineLevel == ObservedEngineLevels[GroupIndex]) { continue; }
+
+		UE_LOG(LogModulusSettings, Verbose,
+			TEXT("QualityGovernorSubsystem::AdoptExternalLevelChanges -- %s set to %d outside the governor, adopting as ceiling"),
+			*Governor.GetGroupName(GroupIndex).ToString(), EngineLevel);
+
+		ObservedEngineLevels[GroupIndex] = EngineLevel;
+		Governor.AdoptLevel(GroupIndex, EngineLevel);
+	}
+}
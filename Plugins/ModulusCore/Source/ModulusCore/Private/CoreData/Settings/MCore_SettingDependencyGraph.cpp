@@ -0,0 +1,261 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Settings/MCore_SettingDependencyGraph.h"
+
+#include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsCollection.h"
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+TSharedRef<const FMCore_SettingDependencyGraph> FMCore_SettingDependencyGraph::Build(
+	const TArray<UMCore_DA_SettingsCollection*>& Collections,
+	const TSharedRef<const FMCore_SettingOrdinalTable>& InOrdinals)
+{
+	TArray<const UMCore_DA_SettingDefinition*> Flattened;
+	for (const UMCore_DA_SettingsCollection* Collection : Collections)
+	{
+		if (!Collection) { continue; }
+
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			Flattened.Add(Setting);
+		}
+	}
+	return Build(Flattened, InOrdinals);
+}
+
+TSharedRef<const FMCore_SettingDependencyGraph> FMCore_SettingDependencyGraph::Build(
+	TConstArrayView<const UMCore_DA_SettingDefinition*> InDefinitions,
+	const TSharedRef<const FMCore_SettingOrdinalTable>& InOrdinals)
+{
+	TSharedRef<FMCore_SettingDependencyGraph> Graph = MakeShared<FMCore_SettingDependencyGraph>();
+	Graph->Ordinals = InOrdinals;
+	Graph->Definitions.Init(nullptr, InOrdinals->Num());
+
+	TMap<FGameplayTag, int32> TagToNode;
+	for (const UMCore_DA_SettingDefinition* Setting : InDefinitions)
+	{
+		const int32 Node = Setting ? InOrdinals->FindOrdinal(Setting) : INDEX_NONE;
+		if (Node == INDEX_NONE || Graph->Definitions[Node]) { continue; }
+
+		Graph->Definitions[Node] = Setting;
+		TagToNode.Add(Setting->SettingTag, Node);
+		if (!Setting->NamedSetter.IsNone())
+		{
+			Graph->NodesByNamedSetter.FindOrAdd(Setting->NamedSetter).Add(Node);
+		}
+	}
+
+	Graph->OutEdges.SetNum(Graph->NumNodes());
+	Graph->InEdges.SetNum(Graph->NumNodes());
+
+	for (int32 Node = 0; Node < Graph->NumNodes(); ++Node)
+	{
+		const UMCore_DA_SettingDefinition* Setting = Graph->Definitions[Node];
+		if (!Setting) { continue; }
+
+		for (int32 DependencyIndex = 0; DependencyIndex < Setting->Dependencies.Num(); ++DependencyIndex)
+		{
+			const FGameplayTag& SourceTag = Setting->Dependencies[DependencyIndex].SourceSetting;
+			const int32* Source = TagToNode.Find(SourceTag);
+			if (!Source || *Source == Node)
+			{
+				UE_LOG(LogModulusSettings, Warning,
+					TEXT("SettingDependencyGraph::Build -- '%s' Dependencies[%d] source '%s' is %s, ignored"),
+					*Setting->SettingTag.ToString(), DependencyIndex, *SourceTag.ToString(),
+					Source ? TEXT("the setting itself") : TEXT("not in any collection"));
+				continue;
+			}
+
+			const int32 EdgeIndex = Graph->Edges.Add({ *Source, Node, DependencyIndex });
+			Graph->OutEdges[*Source].Add(EdgeIndex);
+			Graph->InEdges[Node].Add(EdgeIndex);
+		}
+	}
+
+	Graph->DropCycleEdges();
+	Graph->AssignTopologicalRanks();
+
+	return Graph;
+}
+
+void FMCore_SettingDependencyGraph::DropCycleEdges()
+{
+	if (Edges.IsEmpty()) { return; }
+
+	/* Tarjan's strongly connected components; any component of two or more nodes is a cycle */
+	const int32 NumGraphNodes = NumNodes();
+	TArray<int32> Index;
+	TArray<int32> LowLink;
+	TArray<int32> Component;
+	Index.Init(INDEX_NONE, NumGraphNodes);
+	LowLink.Init(0, NumGraphNodes);
+	Component.Init(INDEX_NONE, NumGraphNodes);
+
+	TArray<int32> Stack;
+	TBitArray<> OnStack(false, NumGraphNodes);
+	int32 NextIndex = 0;
+	int32 NumComponents = 0;
+	TArray<int32> CycleComponents;
+
+	auto StrongConnect = [&](auto& Self, int32 Node) -> void
+	{
+		Index[Node] = LowLink[Node] = NextIndex++;
+		Stack.Push(Node);
+		OnStack[Node] = true;
+
+		for (const int32 EdgeIndex : OutEdges[Node])
+		{
+			const int32 Next = Edges[EdgeIndex].Target;
+			if (Index[Next] == INDEX_NONE)
+			{
+				Self(Self, Next);
+				LowLink[Node] = FMath::Min(LowLink[Node], LowLink[Next]);
+			}
+			else if (OnStack[Next])
+			{
+				LowLink[Node] = FMath::Min(LowLink[Node], Index[Next]);
+			}
+		}
+
+		if (LowLink[Node] != Index[Node]) { return; }
+
+		const int32 ComponentId = NumComponents++;
+		int32 Size = 0;
+		int32 Member;
+		do
+		{
+			Member = Stack.Pop(EAllowShrinking::No);
+			OnStack[Member] = false;
+			Component[Member] = ComponentId;
+			++Size;
+		}
+		while (Member != Node);
+
+		if (Size > 1) { CycleComponents.Add(ComponentId); }
+	};
+
+	for (int32 Node = 0; Node < NumGraphNodes; ++Node)
+	{
+		if (Index[Node] == INDEX_NONE && OutEdges[Node].Num() > 0)
+		{
+			StrongConnect(StrongConnect, Node);
+		}
+	}
+
+	if (CycleComponents.IsEmpty()) { return; }
+
+	for (const int32 ComponentId : CycleComponents)
+	{
+		TArray<FString> Members;
+		for (int32 Node = 0; Node < NumGraphNodes; ++Node)
+		{
+			if (Component[Node] == ComponentId) { Members.Add(Definitions[Node]->SettingTag.ToString()); }
+		}
+		UE_LOG(LogModulusSettings, Error,
+			TEXT("SettingDependencyGraph::DropCycleEdges -- dependency cycle between %s, edges inside the cycle are ignored"),
+			*FString::Join(Members, TEXT(", ")));
+	}
+
+	/* Keep only edges that leave their component, then re-index the adjacency lists */
+	TArray<FEdge> KeptEdges;
+	KeptEdges.Reserve(Edges.Num());
+	for (const FEdge& Edge : Edges)
+	{
+		if (Component[Edge.Source] != Component[Edge.Target] || !CycleComponents.Contains(Component[Edge.Source]))
+		{
+			KeptEdges.Add(Edge);
+		}
+	}
+	Edges = MoveTemp(KeptEdges);
+
+	for (int32 Node = 0; Node < NumGraphNodes; ++Node)
+	{
+		OutEdges[Node].Reset();
+		InEdges[Node].Reset();
+	}
+	for (int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); ++EdgeIndex)
+	{
+		OutEdges[Edges[EdgeIndex].Source].Add(EdgeIndex);
+		InEdges[Edges[EdgeIndex].Target].Add(EdgeIndex);
+	}
+}
+
+void FMCore_SettingDependencyGraph::AssignTopologicalRanks()
+{
+	/* Kahn's algorithm, seeded in ordinal order so ranks are stable across builds */
+	const int32 NumGraphNodes = NumNodes();
+	TopologicalRank.Init(INDEX_NONE, NumGraphNodes);
+
+	TArray<int32> PendingInputs;
+	PendingInputs.SetNumUninitialized(NumGraphNodes);
+	TArray<int32> Ready;
+	Ready.Reserve(NumGraphNodes);
+	for (int32 Node = 0; Node < NumGraphNodes; ++Node)
+	{
+		PendingInputs[Node] = InEdges[Node].Num();
+		if (PendingInputs[Node] == 0) { Ready.Add(Node); }
+	}
+
+	for (int32 Head = 0; Head < Ready.Num(); ++Head)
+	{
+		const int32 Node = Ready[Head];
+		TopologicalRank[Node] = Head;
+
+		for (const int32 EdgeIndex : OutEdges[Node])
+		{
+			const int32 Next = Edges[EdgeIndex].Target;
+			if (--PendingInputs[Next] == 0) { Ready.Add(Next); }
+		}
+	}
+
+	check(Ready.Num() == NumGraphNodes);
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+const FMCore_SettingDependency& FMCore_SettingDependencyGraph::GetDependency(const FEdge& Edge) const
+{
+	return Definitions[Edge.Target]->Dependencies[Edge.DependencyIndex];
+}
+
+void FMCore_SettingDependencyGraph::CollectDownstream(TConstArrayView<int32> Seeds, TArray<int32>& OutNodes) const
+{
+	OutNodes.Reset();
+	if (Edges.IsEmpty()) { return; }
+
+	TBitArray<> Visited(false, NumNodes());
+	TArray<int32> Frontier;
+	for (const int32 Seed : Seeds)
+	{
+		if (Seed != INDEX_NONE) { Frontier.Add(Seed); }
+	}
+
+	while (Frontier.Num() > 0)
+	{
+		const int32 Node = Frontier.Pop(EAllowShrinking::No);
+		for (const int32 EdgeIndex : OutEdges[Node])
+		{
+			const int32 Next = Edges[EdgeIndex].Target;
+			if (!Visited[Next])
+			{
+				Visited[Next] = true;
+				OutNodes.Add(Next);
+				Frontier.Add(Next);
+			}
+		}
+	}
+
+	OutNodes.Sort([this](int32 A, int32 B) { return TopologicalRank[A] < TopologicalRank[B]; });
+}
+
+TConstArrayView<int32> FMCore_SettingDependencyGraph::FindNodesByNamedSetter(FName NamedSetter) const
+{
+	const TArray<int32>* Found = NodesByNamedSetter.Find(NamedSetter);
+	return Found ? TConstArrayView<int32>(*Found) : TConstArrayView<int32>();
+}
@@ -0,0 +1,279 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Settings/MCore_SettingsApplyTelemetry.h"
+
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Logging/LogModulusSettings.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	const TCHAR* const GMCore_ApplyCostCsvHeader = TEXT("SettingTag,Phase,Calls,AvgMs,MinMs,MaxMs");
+
+#if MCORE_WITH_SETTINGS_APPLY_TELEMETRY
+	TAutoConsoleVariable<bool> CVarSettingsApplyCostEnable(
+		TEXT("Modulus.Settings.ApplyCost.Enable"),
+		true,
+		TEXT("Record per-setting apply cost in ApplySettingToEngine (non-Shipping only)"),
+		ECVF_Default);
+
+	void LogCosts(TArrayView<const FMCore_SettingApplyCost> Costs, const TCHAR* Heading)
+	{
+		UE_LOG(LogModulusSettings, Display, TEXT("%s -- %d entr%s"),
+			Heading, Costs.Num(), Costs.Num() == 1 ? TEXT("y") : TEXT("ies"));
+		UE_LOG(LogModulusSettings, Display, TEXT("  %-48s %-16s %7s %9s %9s %9s"),
+			TEXT("Setting"), TEXT("Phase"), TEXT("Calls"), TEXT("Avg ms"), TEXT("Min ms"), TEXT("Max ms"));
+
+		for (const FMCore_SettingApplyCost& Cost : Costs)
+		{
+			UE_LOG(LogModulusSettings, Display, TEXT("  %-48s %-16s %7u %9.3f %9.3f %9.3f"),
+				*Cost.SettingTag, LexToString(Cost.Phase), Cost.CallCount,
+				Cost.GetAverageMs(), Cost.MinMs, Cost.MaxMs);
+		}
+	}
+
+	double GetBudgetMsFromArgs(const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0) { return FCString::Atod(*Args[0]); }
+		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+		return CoreSettings ? CoreSettings->SettingApplyBudgetMs : 0.0;
+	}
+
+	FAutoConsoleCommand CmdSettingsApplyCostDump(
+		TEXT("Modulus.Settings.ApplyCost.Dump"),
+		TEXT("Logs per-setting apply cost (calls, avg/min/max ms), most expensive first"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			LogCosts(FMCore_SettingsApplyTelemetry::Get().GetSortedCosts(), TEXT("SettingsApplyTelemetry::Dump"));
+		}));
+
+	FAutoConsoleCommand CmdSettingsApplyCostReport(
+		TEXT("Modulus.Settings.ApplyCost.Report"),
+		TEXT("Logs settings whose max apply cost exceeds a budget. Usage: Modulus.Settings.ApplyCost.Report [BudgetMs] (defaults to CoreSettings SettingApplyBudgetMs)"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const double BudgetMs = GetBudgetMsFromArgs(Args);
+			const TArray<FMCore_SettingApplyCost> OverBudget = FMCore_SettingsApplyTelemetry::FilterOverBudget(
+				FMCore_SettingsApplyTelemetry::Get().GetSortedCosts(), BudgetMs);
+			LogCosts(OverBudget,
+				*FString::Printf(TEXT("SettingsApplyTelemetry::Report (budget %.3f ms)"), BudgetMs));
+		}));
+
+	FAutoConsoleCommand CmdSettingsApplyCostCsv(
+		TEXT("Modulus.Settings.ApplyCost.WriteCsv"),
+		TEXT("Writes per-setting apply cost to CSV. Usage: Modulus.Settings.ApplyCost.WriteCsv [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString FilePath = Args.Num() > 0 ? Args[0] : FMCore_SettingsApplyTelemetry::MakeDefaultCsvPath();
+			if (FMCore_SettingsApplyTelemetry::WriteCsv(FilePath, FMCore_SettingsApplyTelemetry::Get().GetSortedCosts()))
+			{
+				UE_LOG(LogModulusSettings, Display,
+					TEXT("SettingsApplyTelemetry::WriteCsv -- wrote '%s'"), *FilePath);
+			}
+		}));
+
+	FAutoConsoleCommand CmdSettingsApplyCostReset(
+		TEXT("Modulus.Settings.ApplyCost.Reset"),
+		TEXT("Clears recorded per-setting apply cost"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FMCore_SettingsApplyTelemetry::Get().Reset();
+		}));
+#endif
+}
+
+// ============================================================================
+// PHASE NAMES
+// ============================================================================
+
+const TCHAR* LexToString(EMCore_SettingApplyPhase Phase)
+{
+	switch (Phase)
+	{
+	case EMCore_SettingApplyPhase::NamedSetter:     return TEXT("NamedSetter");
+	case EMCore_SettingApplyPhase::ConsoleVariable: return TEXT("ConsoleVariable");
+	case EMCore_SettingApplyPhase::SoundClass:      return TEXT("SoundClass");
+	case EMCore_SettingApplyPhase::SoundMix:        return TEXT("SoundMix");
+	case EMCore_SettingApplyPhase::ColorVision:     return TEXT("ColorVision");
+	default:                                        return TEXT("Unknown");
+	}
+}
+
+bool LexTryParseString(EMCore_SettingApplyPhase& OutPhase, const TCHAR* Buffer)
+{
+	for (uint8 Index = 0; Index < static_cast<uint8>(EMCore_SettingApplyPhase::Num); ++Index)
+	{
+		const EMCore_SettingApplyPhase Phase = static_cast<EMCore_SettingApplyPhase>(Index);
+		if (FCString::Stricmp(Buffer, LexToString(Phase)) == 0)
+		{
+			OutPhase = Phase;
+			return true;
+		}
+	}
+	return false;
+}
+
+// ============================================================================
+// AGGREGATES
+// ============================================================================
+
+void FMCore_SettingApplyCost::AddSample(double Ms)
+{
+	MinMs = CallCount > 0 ? FMath::Min(MinMs, Ms) : Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+	TotalMs += Ms;
+	++CallCount;
+}
+
+FMCore_SettingsApplyTelemetry& FMCore_SettingsApplyTelemetry::Get()
+{
+	static FMCore_SettingsApplyTelemetry Instance;
+	return Instance;
+}
+
+bool FMCore_SettingsApplyTelemetry::IsEnabled()
+{
+#if MCORE_WITH_SETTINGS_APPLY_TELEMETRY
+	return CVarSettingsApplyCostEnable.GetValueOnGameThread();
+#else
+	return false;
+#endif
+}
+
+void FMCore_SettingsApplyTelemetry::Record(const FGameplayTag& SettingTag, EMCore_SettingApplyPhase Phase, double Ms)
+{
+	FMCore_SettingApplyCost& Cost = Costs.FindOrAdd({ SettingTag, Phase });
+	if (Cost.CallCount == 0)
+	{
+		Cost.SettingTag = SettingTag.ToString();
+		Cost.Phase = Phase;
+	}
+	Cost.AddSample(Ms);
+}
+
+void FMCore_SettingsApplyTelemetry::Reset()
+{
+	Costs.Reset();
+}
+
+TArray<FMCore_SettingApplyCost> FMCore_SettingsApplyTelemetry::GetSortedCosts() const
+{
+	TArray<FMCore_SettingApplyCost> Sorted;
+	Costs.GenerateValueArray(Sorted);
+	Sorted.Sort([](const FMCore_SettingApplyCost& A, const FMCore_SettingApplyCost& B)
+	{
+		return A.MaxMs > B.MaxMs;
+	});
+	return Sorted;
+}
+
+TArray<FMCore_SettingApplyCost> FMCore_SettingsApplyTelemetry::FilterOverBudget(
+	TArrayView<const FMCore_SettingApplyCost> InCosts, double BudgetMs)
+{
+	TArray<FMCore_SettingApplyCost> OverBudget;
+	for (const FMCore_SettingApplyCost& Cost : InCosts)
+	{
+		if (Cost.MaxMs > BudgetMs) { OverBudget.Add(Cost); }
+	}
+	OverBudget.Sort([](const FMCore_SettingApplyCost& A, const FMCore_SettingApplyCost& B)
+	{
+		return A.MaxMs > B.MaxMs;
+	});
+	return OverBudget;
+}
+
+// ============================================================================
+// CSV
+// ============================================================================
+
+bool FMCore_SettingsApplyTelemetry::WriteCsv(const FString& FilePath, TArrayView<const FMCore_SettingApplyCost> InCosts)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(InCosts.Num() + 1);
+	Lines.Add(GMCore_ApplyCostCsvHeader);
+
+	for (const FMCore_SettingApplyCost& Cost : InCosts)
+	{
+		Lines.Add(FString::Printf(TEXT("%s,%s,%u,%.4f,%.4f,%.4f"),
+			*Cost.SettingTag, LexToString(Cost.Phase), Cost.CallCount,
+			Cost.GetAverageMs(), Cost.MinMs, Cost.MaxMs));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsApplyTelemetry::WriteCsv -- failed to write '%s'"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FMCore_SettingsApplyTelemetry::ReadCsv(const FString& FilePath, TArray<FMCore_SettingApplyCost>& OutCosts)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsApplyTelemetry::ReadCsv -- failed to read '%s'"), *FilePath);
+		return false;
+	}
+
+	OutCosts.Reset();
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		if (LineIndex == 0 && Lines[LineIndex].StartsWith(TEXT("SettingTag,"))) { continue; }
+
+		TArray<FString> Fields;
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT(","), /*InCullEmpty=*/false);
+
+		FMCore_SettingApplyCost Cost;
+		if (Fields.Num() != 6 || !LexTryParseString(Cost.Phase, *Fields[1]))
+		{
+			UE_LOG(LogModulusSettings, Verbose,
+				TEXT("SettingsApplyTelemetry::ReadCsv -- skipping malformed line %d in '%s'"), LineIndex + 1, *FilePath);
+			continue;
+		}
+
+		Cost.SettingTag = Fields[0];
+		Cost.CallCount = static_cast<uint32>(FCString::Atoi(*Fields[2]));
+		Cost.TotalMs = FCString::Atod(*Fields[3]) * Cost.CallCount;
+		Cost.MinMs = FCString::Atod(*Fields[4]);
+		Cost.MaxMs = FCString::Atod(*Fields[5]);
+		OutCosts.Add(MoveTemp(Cost));
+	}
+	return true;
+}
+
+FString FMCore_SettingsApplyTelemetry::MakeDefaultCsvPath()
+{
+	return FPaths::ProfilingDir() / TEXT("ModulusSettings") /
+		FString::Printf(TEXT("ApplyCost-%s.csv"), *FDateTime::Now().ToString());
+}
+
+// ============================================================================
+// SCOPED TIMER
+// ============================================================================
+
+FMCore_ScopedSettingApplyTimer::FMCore_ScopedSettingApplyTimer(
+	const FGameplayTag& InSettingTag, EMCore_SettingApplyPhase InPhase)
+	: SettingTag(InSettingTag)
+	, Phase(InPhase)
+{
+	if (FMCore_SettingsApplyTelemetry::IsEnabled())
+	{
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FMCore_ScopedSettingApplyTimer::~FMCore_ScopedSettingApplyTimer()
+{
+	if (StartCycles == 0) { return; }
+
+	const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	FMCore_SettingsApplyTelemetry::Get().Record(SettingTag, Phase, Ms);
+}
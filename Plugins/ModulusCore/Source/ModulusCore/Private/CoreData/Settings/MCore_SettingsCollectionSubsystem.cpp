@@ -3,13 +3,42 @@
 #include "CoreData/Settings/MCore_SettingsCollectionSubsystem.h"
 
 #include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
 #include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Settings/MCore_SettingDependencyGraph.h"
+#include "CoreData/Settings/MCore_SettingsSearchIndex.h"
 #include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
 #include "CoreData/Types/Settings/MCore_DA_SettingsCollection.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsRegistry.h"
 
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Sound/SoundClass.h"
+#include "Sound/SoundMix.h"
+
+void UMCore_SettingsCollectionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+		this, &UMCore_SettingsCollectionSubsystem::HandleObjectPropertyChanged);
+#endif
+}
+
+void UMCore_SettingsCollectionSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif
+
+	OnRegistryPatched.Clear();
+
+	Super::Deinitialize();
+}
 
 UMCore_SettingsCollectionSubsystem* UMCore_SettingsCollectionSubsystem::Get(
 	const UObject* WorldContextObject)
@@ -31,9 +60,11 @@ UMCore_SettingsCollectionSubsystem::GetAllSettingsCollections()
 	if (!bCollectionsCacheValid)
 	{
 		ResolvedCollections.Reset();
+		BakedRegistry = LoadBakedRegistry();
 
 		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
-		if (CoreSettings)
+		/* A baked registry carries everything the runtime needs; its collections stay unloaded */
+		if (!BakedRegistry && CoreSettings)
 		{
 			for (const TSoftObjectPtr<UMCore_DA_SettingsCollection>& SoftRef : CoreSettings->SettingsCollections)
 			{
@@ -56,17 +87,62 @@ UMCore_SettingsCollectionSubsystem::GetAllSettingsCollections()
 		}
 
 		bCollectionsCacheValid = true;
+		if (BakedRegistry)
+		{
+			BuildBakedSettingOrdinalTable();
+		}
+		else
+		{
+			BuildSettingOrdinalTable();
+		}
+		PinSoundAssets();
+#if WITH_EDITOR
+		CaptureRegistryLayout();
+#endif
 		UE_LOG(LogModulusSettings, Log,
-			TEXT("SettingsCollectionSubsystem::GetAllSettingsCollections -- loaded %d collection(s)"),
-			ResolvedCollections.Num());
+			TEXT("SettingsCollectionSubsystem::GetAllSettingsCollections -- loaded %d collection(s)%s, %d setting ordinal(s), %d sound asset(s) pinned"),
+			ResolvedCollections.Num(), BakedRegistry ? TEXT(" (baked registry, collections left unloaded)") : TEXT(""),
+			SettingOrdinalTable->Num(), PinnedSoundAssets.Num());
 	}
 
 	return ResolvedCollections;
 }
 
+UMCore_DA_SettingsRegistry* UMCore_SettingsCollectionSubsystem::LoadBakedRegistry()
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings || CoreSettings->BakedSettingsRegistry.IsNull()) { return nullptr; }
+
+	if (!FPlatformProperties::RequiresCookedData() && !CoreSettings->bUseBakedSettingsRegistryInEditor)
+	{
+		return nullptr;
+	}
+
+	UMCore_DA_SettingsRegistry* Registry = CoreSettings->BakedSettingsRegistry.LoadSynchronous();
+	if (!Registry)
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsCollectionSubsystem::LoadBakedRegistry -- failed to load '%s', resolving collections directly"),
+			*CoreSettings->BakedSettingsRegistry.ToString());
+	}
+	return Registry;
+}
+
+UMCore_DA_SettingsRegistry* UMCore_SettingsCollectionSubsystem::GetBakedRegistry()
+{
+	GetAllSettingsCollections();
+	return BakedRegistry;
+}
+
 UMCore_DA_SettingDefinition* UMCore_SettingsCollectionSubsystem::FindSettingDefinitionByTag(
 	const FGameplayTag& SettingTag)
 {
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		const int32 Ordinal = Registry->FindOrdinalByTag(SettingTag);
+		return Ordinal != INDEX_NONE ? Registry->Settings[Ordinal].Definition.Get() : nullptr;
+	}
+
 	for (const UMCore_DA_SettingsCollection* Collection : GetAllSettingsCollections())
 	{
 		if (UMCore_DA_SettingDefinition* Found = Collection->FindSettingByTag(SettingTag))
@@ -80,6 +156,20 @@ UMCore_DA_SettingDefinition* UMCore_SettingsCollectionSubsystem::FindSettingDefi
 TArray<UMCore_DA_SettingDefinition*> UMCore_SettingsCollectionSubsystem::GetSettingsForCategory(
 	const FGameplayTag& CategoryTag)
 {
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		TArray<UMCore_DA_SettingDefinition*> Baked;
+		if (const FMCore_BakedSettingCategory* Category = Registry->FindCategory(CategoryTag))
+		{
+			Baked.Reserve(Category->SettingOrdinals.Num());
+			for (const int32 Ordinal : Category->SettingOrdinals)
+			{
+				Baked.Add(Registry->Settings[Ordinal].Definition);
+			}
+		}
+		return Baked;
+	}
+
 	TArray<UMCore_DA_SettingDefinition*> Combined;
 	for (const UMCore_DA_SettingsCollection* Collection : GetAllSettingsCollections())
 	{
@@ -94,6 +184,17 @@ TArray<UMCore_DA_SettingDefinition*> UMCore_SettingsCollectionSubsystem::GetSett
 
 TArray<FGameplayTag> UMCore_SettingsCollectionSubsystem::GetAllSettingsCategories()
 {
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		TArray<FGameplayTag> Baked;
+		Baked.Reserve(Registry->Categories.Num());
+		for (const FMCore_BakedSettingCategory& Category : Registry->Categories)
+		{
+			Baked.Add(Category.CategoryTag);
+		}
+		return Baked;
+	}
+
 	TMap<FGameplayTag, int32> CategoryMinSort;
 	for (const UMCore_DA_SettingsCollection* Collection : GetAllSettingsCollections())
 	{
@@ -125,11 +226,22 @@ TArray<FGameplayTag> UMCore_SettingsCollectionSubsystem::GetAllSettingsCategorie
 
 FText UMCore_SettingsCollectionSubsystem::GetCategoryDisplayName(const FGameplayTag& CategoryTag)
 {
-	for (const UMCore_DA_SettingsCollection* Collection : GetAllSettingsCollections())
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		const FMCore_BakedSettingCategory* Category = Registry->FindCategory(CategoryTag);
+		if (Category && !Category->DisplayName.IsEmpty())
+		{
+			return Category->DisplayName;
+		}
+	}
+	else
 	{
-		if (const FText* Name = Collection->CategoryDisplayName.Find(CategoryTag))
+		for (const UMCore_DA_SettingsCollection* Collection : GetAllSettingsCollections())
 		{
-			return *Name;
+			if (const FText* Name = Collection->CategoryDisplayName.Find(CategoryTag))
+			{
+				return *Name;
+			}
 		}
 	}
 	/* Fallback: last segment of the tag path */
@@ -144,13 +256,477 @@ FText UMCore_SettingsCollectionSubsystem::GetCategoryDisplayName(const FGameplay
 
 bool UMCore_SettingsCollectionSubsystem::HasValidSettingsCollections()
 {
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		return Registry->Settings.Num() > 0;
+	}
 	return GetAllSettingsCollections().Num() > 0;
 }
 
+TArray<UMCore_DA_SettingDefinition*> UMCore_SettingsCollectionSubsystem::GetAllSettingDefinitions()
+{
+	TArray<UMCore_DA_SettingDefinition*> Definitions;
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		Definitions.Reserve(Registry->Settings.Num());
+		for (const FMCore_BakedSettingEntry& Entry : Registry->Settings)
+		{
+			if (Entry.Definition) { Definitions.Add(Entry.Definition); }
+		}
+		return Definitions;
+	}
+
+	/* Collection walk, keeping the first listing of each ordinal */
+	TBitArray<> Seen(false, SettingOrdinalTable->Num());
+	for (const UMCore_DA_SettingsCollection* Collection : ResolvedCollections)
+	{
+		if (!Collection) { continue; }
+
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			const int32 Ordinal = Setting ? SettingOrdinalTable->FindOrdinal(Setting.Get()) : INDEX_NONE;
+			if (Ordinal == INDEX_NONE || Seen[Ordinal]) { continue; }
+
+			Seen[Ordinal] = true;
+			Definitions.Add(Setting);
+		}
+	}
+	return Definitions;
+}
+
+FGameplayTag UMCore_SettingsCollectionSubsystem::GetCategoryParent(const FGameplayTag& CategoryTag)
+{
+	if (const UMCore_DA_SettingsRegistry* Registry = GetBakedRegistry())
+	{
+		if (const FMCore_BakedSettingCategory* Category = Registry->FindCategory(CategoryTag))
+		{
+			return Category->ParentTag;
+		}
+	}
+	return CategoryTag.RequestDirectParent();
+}
+
+TSharedPtr<const FMCore_SettingOrdinalTable> UMCore_SettingsCollectionSubsystem::GetSettingOrdinalTable()
+{
+	GetAllSettingsCollections();
+	return SettingOrdinalTable;
+}
+
+TSharedPtr<const FMCore_SettingDependencyGraph> UMCore_SettingsCollectionSubsystem::GetDependencyGraph()
+{
+	GetAllSettingsCollections();
+	return DependencyGraph;
+}
+
+TSharedPtr<const FMCore_SettingsSearchIndex> UMCore_SettingsCollectionSubsystem::GetSearchIndex()
+{
+	GetAllSettingsCollections();
+	if (SearchIndex && SearchIndex->IsCurrentLanguage())
+	{
+		return SearchIndex;
+	}
+
+	/* First listing of each ordinal, in ordinal order, so ties rank in registry order */
+	TArray<const UMCore_DA_SettingDefinition*> Definitions;
+	Definitions.Reserve(DependencyGraph->NumNodes());
+	for (int32 Node = 0; Node < DependencyGraph->NumNodes(); ++Node)
+	{
+		const UMCore_DA_SettingDefinition* Definition = DependencyGraph->GetDefinition(Node);
+		if (Definition && Definition->CategoryTag.IsValid())
+		{
+			Definitions.Add(Definition);
+		}
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	SearchIndex = FMCore_SettingsSearchIndex::Build(Definitions,
+		[this](const FGameplayTag& CategoryTag) { return GetCategoryDisplayName(CategoryTag); },
+		[this](const FGameplayTag& CategoryTag) { return GetCategoryParent(CategoryTag); });
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("SettingsCollectionSubsystem::GetSearchIndex -- indexed %d setting(s) for language '%s' in %.2f ms"),
+		SearchIndex->Num(), *SearchIndex->GetLanguage(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	return SearchIndex;
+}
+
+void UMCore_SettingsCollectionSubsystem::BuildSettingOrdinalTable()
+{
+	TSharedRef<FMCore_SettingOrdinalTable> Table = MakeShared<FMCore_SettingOrdinalTable>();
+
+	for (const UMCore_DA_SettingsCollection* Collection : ResolvedCollections)
+	{
+		if (!Collection) { continue; }
+
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			if (!Setting || !Setting->SettingTag.IsValid()) { continue; }
+
+			/* The same tag listed in two collections shares one slot — first listing wins. */
+			FString SaveKey = Setting->GetSaveKey();
+			int32 Ordinal = Table->FindOrdinal(SaveKey);
+			if (Ordinal == INDEX_NONE)
+			{
+				Ordinal = Table->SaveKeys.Add(SaveKey);
+				Table->Types.Add(Setting->SettingType);
+				Table->SaveKeyToOrdinal.Add(MoveTemp(SaveKey), Ordinal);
+			}
+			Table->DefinitionToOrdinal.Add(Setting, Ordinal);
+		}
+	}
+
+	SettingOrdinalTable = Table;
+	DependencyGraph = FMCore_SettingDependencyGraph::Build(ResolvedCollections, Table);
+
+	/* Built lazily on the first search against this registry */
+	SearchIndex.Reset();
+}
+
+void UMCore_SettingsCollectionSubsystem::BuildBakedSettingOrdinalTable()
+{
+	/* The bake already resolved first-listing-wins; an entry's index is its ordinal */
+	TSharedRef<FMCore_SettingOrdinalTable> Table = MakeShared<FMCore_SettingOrdinalTable>();
+	TArray<const UMCore_DA_SettingDefinition*> Definitions;
+
+	const TArray<FMCore_BakedSettingEntry>& Entries = BakedRegistry->Settings;
+	Table->SaveKeys.Reserve(Entries.Num());
+	Table->Types.Reserve(Entries.Num());
+	Definitions.Reserve(Entries.Num());
+	for (int32 Ordinal = 0; Ordinal < Entries.Num(); ++Ordinal)
+	{
+		const FMCore_BakedSettingEntry& Entry = Entries[Ordinal];
+		Table->SaveKeys.Add(Entry.SaveKey);
+		Table->Types.Add(Entry.SettingType);
+		Table->SaveKeyToOrdinal.Add(Entry.SaveKey, Ordinal);
+		if (Entry.Definition)
+		{
+			Table->DefinitionToOrdinal.Add(Entry.Definition, Ordinal);
+		}
+		Definitions.Add(Entry.Definition);
+	}
+
+	SettingOrdinalTable = Table;
+	DependencyGraph = FMCore_SettingDependencyGraph::Build(Definitions, Table);
+	SearchIndex.Reset();
+}
+
+void UMCore_SettingsCollectionSubsystem::PinSoundAssets()
+{
+	PinnedSoundAssets.Reset();
+
+	if (const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get())
+	{
+		PinSoundAsset(CoreSettings->VolumeMix);
+	}
+
+	if (BakedRegistry)
+	{
+		for (const FMCore_BakedSettingEntry& Entry : BakedRegistry->Settings)
+		{
+			PinSoundAsset(TSoftObjectPtr<UObject>(Entry.SoundClass));
+			PinSoundAsset(TSoftObjectPtr<UObject>(Entry.PushedSoundMix));
+		}
+		return;
+	}
+
+	for (const UMCore_DA_SettingsCollection* Collection : ResolvedCollections)
+	{
+		if (!Collection) { continue; }
+
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			PinDefinitionSounds(Setting);
+		}
+	}
+}
+
+void UMCore_SettingsCollectionSubsystem::PinDefinitionSounds(const UMCore_DA_SettingDefinition* Definition)
+{
+	if (!Definition) { return; }
+	PinSoundAsset(Definition->SoundClass);
+	PinSoundAsset(Definition->PushedSoundMix);
+}
+
+void UMCore_SettingsCollectionSubsystem::PinSoundAsset(const TSoftObjectPtr<UObject>& SoftRef)
+{
+	if (SoftRef.IsNull()) { return; }
+	if (UObject* Loaded = SoftRef.LoadSynchronous())
+	{
+		PinnedSoundAssets.AddUnique(Loaded);
+	}
+	else
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsCollectionSubsystem::PinSoundAsset -- failed to load '%s'"),
+			*SoftRef.ToString());
+	}
+}
+
 void UMCore_SettingsCollectionSubsystem::InvalidateCollectionCache()
 {
 	ResolvedCollections.Reset();
+	BakedRegistry = nullptr;
+	SettingOrdinalTable.Reset();
+	DependencyGraph.Reset();
+	SearchIndex.Reset();
+	PinnedSoundAssets.Reset();
 	bCollectionsCacheValid = false;
 	UE_LOG(LogModulusSettings, Log,
 		TEXT("SettingsCollectionSubsystem::InvalidateCollectionCache -- collection cache invalidated"));
 }
+
+// ============================================================================
+// EDITOR HOT RELOAD
+// ============================================================================
+
+#if WITH_EDITOR
+UMCore_SettingsCollectionSubsystem::FDefinitionLayout UMCore_SettingsCollectionSubsystem::CaptureDefinitionLayout(
+	const UMCore_DA_SettingDefinition* Definition)
+{
+	FDefinitionLayout Layout;
+	Layout.SettingTag = Definition->SettingTag;
+	Layout.CategoryTag = Definition->CategoryTag;
+	Layout.SortOrder = Definition->SortOrder;
+	Layout.SettingType = Definition->SettingType;
+	Layout.WidgetClass = Definition->WidgetClassOverride.Get();
+	Layout.SoundClass = Definition->SoundClass.ToSoftObjectPath();
+	Layout.PushedSoundMix = Definition->PushedSoundMix.ToSoftObjectPath();
+	return Layout;
+}
+
+void UMCore_SettingsCollectionSubsystem::CaptureRegistryLayout()
+{
+	DefinitionLayouts.Reset();
+	CollectionMembers.Reset();
+
+	for (const UMCore_DA_SettingsCollection* Collection : ResolvedCollections)
+	{
+		if (!Collection) { continue; }
+
+		TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>>& Members = CollectionMembers.Add(Collection);
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			if (!Setting) { continue; }
+			Members.Add(Setting.Get());
+			DefinitionLayouts.Add(Setting.Get(), CaptureDefinitionLayout(Setting));
+		}
+	}
+}
+
+TSet<FGameplayTag> UMCore_SettingsCollectionSubsystem::GetLayoutCategories() const
+{
+	TSet<FGameplayTag> Categories;
+	for (const TPair<TWeakObjectPtr<const UMCore_DA_SettingDefinition>, FDefinitionLayout>& Entry : DefinitionLayouts)
+	{
+		if (Entry.Value.CategoryTag.IsValid()) { Categories.Add(Entry.Value.CategoryTag); }
+	}
+	return Categories;
+}
+
+void UMCore_SettingsCollectionSubsystem::HandleObjectPropertyChanged(
+	UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	/* A baked registry is a snapshot; edits show up after the next bake */
+	if (!bCollectionsCacheValid || BakedRegistry || !Object) { return; }
+
+	/* Slider drags and spinbox scrubs; the committing ValueSet follows */
+	if (PropertyChangedEvent.ChangeType & EPropertyChangeType::Interactive) { return; }
+
+	if (const UMCore_DA_SettingDefinition* Definition = Cast<UMCore_DA_SettingDefinition>(Object))
+	{
+		PatchDefinition(Definition, PropertyChangedEvent.GetMemberPropertyName());
+	}
+	else if (const UMCore_DA_SettingsCollection* Collection = Cast<UMCore_DA_SettingsCollection>(Object))
+	{
+		PatchCollection(Collection, PropertyChangedEvent.GetMemberPropertyName());
+	}
+}
+
+void UMCore_SettingsCollectionSubsystem::PatchDefinition(
+	const UMCore_DA_SettingDefinition* Definition, FName ChangedProperty)
+{
+	FDefinitionLayout* StoredLayout = DefinitionLayouts.Find(Definition);
+	if (!StoredLayout) { return; }
+
+	const TSet<FGameplayTag> CategoriesBefore = GetLayoutCategories();
+	const FDefinitionLayout NewLayout = CaptureDefinitionLayout(Definition);
+
+	FMCore_SettingsRegistryChange Change;
+	if (NewLayout.HasSamePlacement(*StoredLayout))
+	{
+		Change.ChangedDefinitions.Add(Definition);
+	}
+	else
+	{
+		Change.AffectedCategories.Add(StoredLayout->CategoryTag);
+		Change.AffectedCategories.Add(NewLayout.CategoryTag);
+	}
+
+	const bool bSaveSlotChanged = NewLayout.SettingTag != StoredLayout->SettingTag
+		|| NewLayout.SettingType != StoredLayout->SettingType;
+	const bool bSoundsChanged = !NewLayout.HasSameSounds(*StoredLayout);
+	*StoredLayout = NewLayout;
+
+	if (bSaveSlotChanged)
+	{
+		PatchSettingOrdinals({ Definition }, {});
+	}
+	else if (ChangedProperty == GET_MEMBER_NAME_CHECKED(UMCore_DA_SettingDefinition, Dependencies)
+		|| ChangedProperty == GET_MEMBER_NAME_CHECKED(UMCore_DA_SettingDefinition, NamedSetter))
+	{
+		DependencyGraph = FMCore_SettingDependencyGraph::Build(ResolvedCollections, SettingOrdinalTable.ToSharedRef());
+	}
+
+	/* Previously pinned assets stay held until the next full build */
+	if (bSoundsChanged)
+	{
+		PinDefinitionSounds(Definition);
+	}
+
+	/* Apply targets (CVar, SoundClass, setter) may have changed; re-push on next apply */
+	UMCore_GameSettingsLibrary::InvalidateAppliedSetting(Definition);
+
+	FinishPatch(MoveTemp(Change), CategoriesBefore);
+}
+
+void UMCore_SettingsCollectionSubsystem::PatchCollection(
+	const UMCore_DA_SettingsCollection* Collection, FName ChangedProperty)
+{
+	if (!ResolvedCollections.Contains(Collection)) { return; }
+
+	const TSet<FGameplayTag> CategoriesBefore = GetLayoutCategories();
+
+	FMCore_SettingsRegistryChange Change;
+
+	/* Category display names drive tab labels */
+	if (ChangedProperty == GET_MEMBER_NAME_CHECKED(UMCore_DA_SettingsCollection, CategoryDisplayName))
+	{
+		Change.bCategoryLayoutChanged = true;
+	}
+
+	/* Membership or order diff: every category that gained, lost or reordered a row */
+	TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>> NewMembers;
+	for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+	{
+		if (Setting) { NewMembers.Add(Setting.Get()); }
+	}
+
+	/* Copied: CaptureRegistryLayout below resets the member map */
+	const TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>>* StoredMembers = CollectionMembers.Find(Collection);
+	const TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>> OldMembers =
+		StoredMembers ? *StoredMembers : TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>>();
+	if (!StoredMembers || OldMembers != NewMembers)
+	{
+		for (const TWeakObjectPtr<const UMCore_DA_SettingDefinition>& Member : OldMembers)
+		{
+			if (const FDefinitionLayout* Layout = DefinitionLayouts.Find(Member))
+			{
+				Change.AffectedCategories.Add(Layout->CategoryTag);
+			}
+		}
+		for (const TWeakObjectPtr<const UMCore_DA_SettingDefinition>& Member : NewMembers)
+		{
+			if (const UMCore_DA_SettingDefinition* Definition = Member.Get())
+			{
+				Change.AffectedCategories.Add(Definition->CategoryTag);
+			}
+		}
+
+		CaptureRegistryLayout();
+
+		/* Only definitions entering or leaving the registry need new slots or pins */
+		TArray<const UMCore_DA_SettingDefinition*> Added;
+		for (const TWeakObjectPtr<const UMCore_DA_SettingDefinition>& Member : NewMembers)
+		{
+			const UMCore_DA_SettingDefinition* Definition = Member.Get();
+			if (Definition && SettingOrdinalTable->FindOrdinal(Definition) == INDEX_NONE)
+			{
+				Added.Add(Definition);
+				PinDefinitionSounds(Definition);
+			}
+		}
+
+		TArray<const UMCore_DA_SettingDefinition*> Removed;
+		for (const TWeakObjectPtr<const UMCore_DA_SettingDefinition>& Member : OldMembers)
+		{
+			const UMCore_DA_SettingDefinition* Definition = Member.Get();
+			if (Definition && !DefinitionLayouts.Contains(Member))
+			{
+				Removed.Add(Definition);
+			}
+		}
+
+		/* A reorder alone can change which listing of a shared save key the graph resolves to */
+		if (Added.Num() > 0 || Removed.Num() > 0)
+		{
+			PatchSettingOrdinals(Added, Removed);
+		}
+		else
+		{
+			DependencyGraph = FMCore_SettingDependencyGraph::Build(ResolvedCollections, SettingOrdinalTable.ToSharedRef());
+		}
+	}
+
+	FinishPatch(MoveTemp(Change), CategoriesBefore);
+}
+
+void UMCore_SettingsCollectionSubsystem::PatchSettingOrdinals(
+	TConstArrayView<const UMCore_DA_SettingDefinition*> Remapped,
+	TConstArrayView<const UMCore_DA_SettingDefinition*> Removed)
+{
+	/* Vacated slots are kept so existing ordinals stay stable; the next full build compacts them */
+	TSharedRef<FMCore_SettingOrdinalTable> Table = MakeShared<FMCore_SettingOrdinalTable>(*SettingOrdinalTable);
+
+	for (const UMCore_DA_SettingDefinition* Definition : Removed)
+	{
+		Table->DefinitionToOrdinal.Remove(Definition);
+	}
+
+	for (const UMCore_DA_SettingDefinition* Definition : Remapped)
+	{
+		const int32 PreviousOrdinal = Table->FindOrdinal(Definition);
+		Table->DefinitionToOrdinal.Remove(Definition);
+		if (!Definition->SettingTag.IsValid()) { continue; }
+
+		FString SaveKey = Definition->GetSaveKey();
+		int32 Ordinal = Table->FindOrdinal(SaveKey);
+		if (Ordinal == INDEX_NONE)
+		{
+			Ordinal = Table->SaveKeys.Add(SaveKey);
+			Table->Types.Add(Definition->SettingType);
+			Table->SaveKeyToOrdinal.Add(MoveTemp(SaveKey), Ordinal);
+		}
+		else if (Ordinal == PreviousOrdinal)
+		{
+			/* Same key, new type: the rebind folds the old value back out by key */
+			Table->Types[Ordinal] = Definition->SettingType;
+		}
+		Table->DefinitionToOrdinal.Add(Definition, Ordinal);
+	}
+
+	SettingOrdinalTable = Table;
+	DependencyGraph = FMCore_SettingDependencyGraph::Build(ResolvedCollections, Table);
+}
+
+void UMCore_SettingsCollectionSubsystem::FinishPatch(
+	FMCore_SettingsRegistryChange&& Change, const TSet<FGameplayTag>& CategoriesBefore)
+{
+	const TSet<FGameplayTag> CategoriesAfter = GetLayoutCategories();
+	if (CategoriesBefore.Num() != CategoriesAfter.Num() || !CategoriesBefore.Includes(CategoriesAfter))
+	{
+		Change.bCategoryLayoutChanged = true;
+	}
+	Change.AffectedCategories.Remove(FGameplayTag());
+
+	if (Change.IsEmpty()) { return; }
+
+	/* Display text and keywords may have changed with the edit */
+	SearchIndex.Reset();
+
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("SettingsCollectionSubsystem::FinishPatch -- patched registry: %d row(s) changed, %d page(s) affected%s"),
+		Change.ChangedDefinitions.Num(), Change.AffectedCategories.Num(),
+		Change.bCategoryLayoutChanged ? TEXT(", category layout changed") : TEXT(""));
+
+	OnRegistryPatched.Broadcast(Change);
+}
+#endif
@@ -0,0 +1,406 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Settings/MCore_SettingsJournal.h"
+
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/* 'MCJ1', 'MCJR', 'MCS1' read as little-endian uint32 */
+	constexpr uint32 JournalMagic = 0x314A434D;
+	constexpr uint32 RecordMagic = 0x524A434D;
+	constexpr uint32 SnapshotMagic = 0x3153434D;
+	constexpr uint32 FormatVersion = 1;
+
+	/* First four bytes of anything UGameplayStatics::SaveGameToMemory wrote ('GVAS') */
+	constexpr uint32 SaveGameFileTag = 0x53415647;
+
+	/* Magic, Version, BaseSequence, HeaderCrc */
+	constexpr int32 JournalHeaderSize = 4 + 4 + 8 + 4;
+	/* Magic, PayloadSize, PayloadCrc */
+	constexpr int32 RecordHeaderSize = 4 + 4 + 4;
+	/* Magic, Version, Generation, LastSequence, PayloadSize, PayloadCrc, HeaderCrc */
+	constexpr int32 SnapshotHeaderSize = 4 + 4 + 8 + 8 + 4 + 4 + 4;
+
+	/* Far above any real record; a size past this is corruption, not a long key */
+	constexpr uint32 MaxRecordPayloadSize = 64 * 1024;
+
+	template <typename T>
+	void AppendPod(TArray<uint8>& Bytes, const T& Value)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	template <typename T>
+	bool ReadPod(TConstArrayView<uint8> Bytes, int32& Offset, T& OutValue)
+	{
+		if (Offset + static_cast<int32>(sizeof(T)) > Bytes.Num()) { return false; }
+		FMemory::Memcpy(&OutValue, Bytes.GetData() + Offset, sizeof(T));
+		Offset += sizeof(T);
+		return true;
+	}
+
+	void AppendJournalHeader(TArray<uint8>& Bytes, uint64 BaseSequence)
+	{
+		const int32 Start = Bytes.Num();
+		AppendPod(Bytes, JournalMagic);
+		AppendPod(Bytes, FormatVersion);
+		AppendPod(Bytes, BaseSequence);
+		AppendPod(Bytes, FCrc::MemCrc32(Bytes.GetData() + Start, Bytes.Num() - Start));
+	}
+
+	void SerializeRecordPayload(FArchive& Ar, FMCore_SettingsJournalRecord& Record)
+	{
+		uint8 Type = static_cast<uint8>(Record.Type);
+		uint8 bBoolValue = Record.bBoolValue ? 1 : 0;
+		Ar << Record.Sequence;
+		Ar << Type;
+		Ar << Record.Key;
+		Ar << Record.FloatValue;
+		Ar << Record.IntValue;
+		Ar << bBoolValue;
+		Record.Type = static_cast<EMCore_SettingsJournalRecordType>(Type);
+		Record.bBoolValue = bBoolValue != 0;
+	}
+
+	void AppendRecord(TArray<uint8>& Bytes, const FMCore_SettingsJournalRecord& Record)
+	{
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+		FMCore_SettingsJournalRecord Copy = Record;
+		SerializeRecordPayload(Writer, Copy);
+
+		AppendPod(Bytes, RecordMagic);
+		AppendPod(Bytes, static_cast<uint32>(Payload.Num()));
+		AppendPod(Bytes, FCrc::MemCrc32(Payload.GetData(), Payload.Num()));
+		Bytes.Append(Payload);
+	}
+
+	bool WriteJournalFile(const FString& SlotName, const TArray<uint8>& Bytes, bool bAppend)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const FString Filename = FMCore_SettingsJournal::GetJournalFilename(SlotName);
+		PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Filename));
+
+		/* Opened per write: several save objects can point at one slot (reload, benchmark) */
+		TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*Filename, bAppend));
+		if (!Handle)
+		{
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("SettingsJournal::WriteJournalFile -- cannot open '%s' for writing"), *Filename);
+			return false;
+		}
+		return Handle->Write(Bytes.GetData(), Bytes.Num()) && Handle->Flush(true);
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommand CmdSettingsJournalFaultTest(
+		TEXT("Modulus.Settings.Journal.FaultTest"),
+		TEXT("Truncates settings journal and snapshot files at random offsets and checks recovery. Usage: Modulus.Settings.Journal.FaultTest [Trials=200] [Seed]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumTrials = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+			const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : static_cast<int32>(FPlatformTime::Cycles());
+			FMCore_SettingsJournal::RunFaultInjectionTest(NumTrials, Seed);
+		}));
+#endif
+}
+
+// ============================================================================
+// FILES
+// ============================================================================
+
+bool FMCore_SettingsJournal::IsEnabled()
+{
+	/* Desktop platforms use the generic save system: one .sav file per slot in the same directory */
+#if PLATFORM_DESKTOP
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	return CoreSettings && CoreSettings->bUseSettingsJournal;
+#else
+	return false;
+#endif
+}
+
+FString FMCore_SettingsJournal::GetJournalFilename(const FString& SlotName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".journal");
+}
+
+FString FMCore_SettingsJournal::GetAlternateSlotName(const FString& SlotName)
+{
+	return SlotName + TEXT("_Alt");
+}
+
+bool FMCore_SettingsJournal::AppendRecords(const FString& SlotName, uint64 BaseSequence,
+	TConstArrayView<FMCore_SettingsJournalRecord> Records)
+{
+	if (Records.IsEmpty()) { return true; }
+
+	/* Whole batch in one write, so a crash tears at most the last record */
+	const bool bNeedsHeader = IFileManager::Get().FileSize(*GetJournalFilename(SlotName)) <= 0;
+	TArray<uint8> Bytes;
+	if (bNeedsHeader)
+	{
+		AppendJournalHeader(Bytes, BaseSequence);
+	}
+	for (const FMCore_SettingsJournalRecord& Record : Records)
+	{
+		AppendRecord(Bytes, Record);
+	}
+	return WriteJournalFile(SlotName, Bytes, !bNeedsHeader);
+}
+
+bool FMCore_SettingsJournal::Reset(const FString& SlotName, uint64 BaseSequence)
+{
+	TArray<uint8> Bytes;
+	AppendJournalHeader(Bytes, BaseSequence);
+	return WriteJournalFile(SlotName, Bytes, false);
+}
+
+void FMCore_SettingsJournal::Delete(const FString& SlotName)
+{
+	IFileManager::Get().Delete(*GetJournalFilename(SlotName), false, false, true);
+}
+
+void FMCore_SettingsJournal::ReadFile(const FString& SlotName, TArray<uint8>& OutBytes)
+{
+	if (!FFileHelper::LoadFileToArray(OutBytes, *GetJournalFilename(SlotName), FILEREAD_Silent))
+	{
+		OutBytes.Reset();
+	}
+}
+
+// ============================================================================
+// FORMAT
+// ============================================================================
+
+FMCore_SettingsJournal::EReadResult FMCore_SettingsJournal::ParseRecords(TConstArrayView<uint8> Bytes,
+	uint64& OutBaseSequence, TArray<FMCore_SettingsJournalRecord>& OutRecords)
+{
+	OutBaseSequence = 0;
+	OutRecords.Reset();
+	if (Bytes.IsEmpty()) { return EReadResult::Empty; }
+
+	int32 Offset = 0;
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint64 BaseSequence = 0;
+	uint32 HeaderCrc = 0;
+	if (!ReadPod(Bytes, Offset, Magic) || !ReadPod(Bytes, Offset, Version) || !ReadPod(Bytes, Offset, BaseSequence)
+		|| !ReadPod(Bytes, Offset, HeaderCrc)
+		|| Magic != JournalMagic || Version != FormatVersion
+		|| HeaderCrc != FCrc::MemCrc32(Bytes.GetData(), JournalHeaderSize - sizeof(uint32)))
+	{
+		return EReadResult::TornTail;
+	}
+	OutBaseSequence = BaseSequence;
+
+	while (Offset < Bytes.Num())
+	{
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+		if (!ReadPod(Bytes, Offset, Magic) || !ReadPod(Bytes, Offset, PayloadSize) || !ReadPod(Bytes, Offset, PayloadCrc)
+			|| Magic != RecordMagic || PayloadSize > MaxRecordPayloadSize
+			|| Offset + static_cast<int32>(PayloadSize) > Bytes.Num())
+		{
+			return EReadResult::TornTail;
+		}
+
+		const TConstArrayView<uint8> Payload = Bytes.Slice(Offset, PayloadSize);
+		if (FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != PayloadCrc)
+		{
+			return EReadResult::TornTail;
+		}
+		Offset += PayloadSize;
+
+		FMemoryReaderView Reader(Payload);
+		FMCore_SettingsJournalRecord& Record = OutRecords.AddDefaulted_GetRef();
+		SerializeRecordPayload(Reader, Record);
+		if (Reader.IsError() || Record.Type > EMCore_SettingsJournalRecordType::QualityPreset)
+		{
+			OutRecords.Pop();
+			return EReadResult::TornTail;
+		}
+	}
+
+	return OutRecords.IsEmpty() ? EReadResult::Empty : EReadResult::Clean;
+}
+
+void FMCore_SettingsJournal::FrameSnapshot(TArray<uint8>& InOutBytes, const FMCore_SettingsSnapshotInfo& Info)
+{
+	TArray<uint8> Header;
+	Header.Reserve(SnapshotHeaderSize);
+	AppendPod(Header, SnapshotMagic);
+	AppendPod(Header, FormatVersion);
+	AppendPod(Header, Info.Generation);
+	AppendPod(Header, Info.LastSequence);
+	AppendPod(Header, static_cast<uint32>(InOutBytes.Num()));
+	AppendPod(Header, FCrc::MemCrc32(InOutBytes.GetData(), InOutBytes.Num()));
+	AppendPod(Header, FCrc::MemCrc32(Header.GetData(), Header.Num()));
+
+	InOutBytes.Insert(Header, 0);
+}
+
+FMCore_SettingsJournal::ESnapshotResult FMCore_SettingsJournal::UnframeSnapshot(TArray<uint8>& InOutBytes,
+	FMCore_SettingsSnapshotInfo& OutInfo)
+{
+	OutInfo = FMCore_SettingsSnapshotInfo();
+
+	int32 Offset = 0;
+	uint32 Magic = 0;
+	if (!ReadPod(InOutBytes, Offset, Magic)) { return ESnapshotResult::Corrupt; }
+	if (Magic == SaveGameFileTag) { return ESnapshotResult::Legacy; }
+	if (Magic != SnapshotMagic) { return ESnapshotResult::Corrupt; }
+
+	uint32 Version = 0;
+	uint32 PayloadSize = 0;
+	uint32 PayloadCrc = 0;
+	uint32 HeaderCrc = 0;
+	FMCore_SettingsSnapshotInfo Info;
+	if (!ReadPod(InOutBytes, Offset, Version) || !ReadPod(InOutBytes, Offset, Info.Generation)
+		|| !ReadPod(InOutBytes, Offset, Info.LastSequence) || !ReadPod(InOutBytes, Offset, PayloadSize)
+		|| !ReadPod(InOutBytes, Offset, PayloadCrc) || !ReadPod(InOutBytes, Offset, HeaderCrc))
+	{
+		return ESnapshotResult::Corrupt;
+	}
+
+	if (Version != FormatVersion
+		|| HeaderCrc != FCrc::MemCrc32(InOutBytes.GetData(), SnapshotHeaderSize - sizeof(uint32))
+		|| static_cast<int32>(PayloadSize) != InOutBytes.Num() - SnapshotHeaderSize
+		|| PayloadCrc != FCrc::MemCrc32(InOutBytes.GetData() + SnapshotHeaderSize, PayloadSize))
+	{
+		return ESnapshotResult::Corrupt;
+	}
+
+	InOutBytes.RemoveAt(0, SnapshotHeaderSize, EAllowShrinking::No);
+	OutInfo = Info;
+	return ESnapshotResult::Valid;
+}
+
+// ============================================================================
+// FAULT INJECTION
+// ============================================================================
+
+void FMCore_SettingsJournal::RunFaultInjectionTest(int32 NumTrials, int32 Seed)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings || !IsEnabled())
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsJournal::RunFaultInjectionTest -- journal disabled (bUseSettingsJournal off or unsupported platform), nothing to test"));
+		return;
+	}
+
+	const FString SlotName = TEXT("MCore_JournalFaultTest");
+	const FString AlternateSlotName = GetAlternateSlotName(SlotName);
+	constexpr int32 NumKeys = 4;
+
+	/* Stay under the compaction threshold so the journal holds every append */
+	const int32 NumAppends = FMath::Clamp(CoreSettings->SettingsJournalCompactionThreshold - 1, NumKeys, 12);
+
+	auto KeyName = [](int32 Index) { return FString::Printf(TEXT("FaultTest_%d"), Index); };
+	auto Capture = [&KeyName](const UMCore_PlayerSettingsSave* Save)
+	{
+		TArray<float> State;
+		State.Init(-1.0f, NumKeys);
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			Save->GetFloatSetting(KeyName(Index), State[Index]);
+		}
+		return State;
+	};
+
+	FRandomStream Random(Seed);
+	int32 NumJournalCuts = 0;
+	int32 NumSnapshotCuts = 0;
+	int32 NumFailures = 0;
+
+	for (int32 Trial = 0; Trial < NumTrials; ++Trial)
+	{
+		UMCore_PlayerSettingsSave::DeletePlayerSettings(SlotName);
+
+		/* Two snapshots (primary, then alternate), then journal-only commits on top */
+		UMCore_PlayerSettingsSave* Save = UMCore_PlayerSettingsSave::LoadPlayerSettings(SlotName);
+		for (int32 Index = 0; Index < NumKeys; ++Index) { Save->SetFloatSetting(KeyName(Index), 1.0f); }
+		Save->SaveSettings();
+		for (int32 Index = 0; Index < NumKeys; ++Index) { Save->SetFloatSetting(KeyName(Index), 2.0f); }
+		Save->SaveSettings();
+
+		TArray<TArray<float>> States;
+		States.Add(Capture(Save));
+		for (int32 Step = 0; Step < NumAppends; ++Step)
+		{
+			Save->SetFloatSetting(KeyName(Step % NumKeys), 3.0f + Step);
+			Save->PersistSettingValues();
+			States.Add(Capture(Save));
+		}
+
+		const bool bCutJournal = Random.RandRange(0, 1) == 0;
+		TArray<uint8> Bytes;
+		if (bCutJournal)
+		{
+			ReadFile(SlotName, Bytes);
+		}
+		else
+		{
+			UGameplayStatics::LoadDataFromSlot(Bytes, AlternateSlotName, 0);
+		}
+
+		if (Bytes.IsEmpty())
+		{
+			++NumFailures;
+			UE_LOG(LogModulusSettings, Error,
+				TEXT("SettingsJournal::RunFaultInjectionTest -- trial %d: %s was not written"),
+				Trial, bCutJournal ? TEXT("journal") : TEXT("newest snapshot"));
+			continue;
+		}
+
+		const int32 CutAt = Random.RandHelper(Bytes.Num());
+		Bytes.SetNum(CutAt);
+		if (bCutJournal)
+		{
+			FFileHelper::SaveArrayToFile(Bytes, *GetJournalFilename(SlotName));
+		}
+		else if (Bytes.IsEmpty())
+		{
+			UGameplayStatics::DeleteGameInSlot(AlternateSlotName, 0);
+		}
+		else
+		{
+			UGameplayStatics::SaveDataToSlot(Bytes, AlternateSlotName, 0);
+		}
+
+		/* A cut journal may end anywhere in the history; a cut snapshot must lose nothing the journal kept */
+		const TArray<float> Recovered = Capture(UMCore_PlayerSettingsSave::LoadPlayerSettings(SlotName));
+		const bool bPassed = bCutJournal ? States.Contains(Recovered) : Recovered == States.Last();
+		(bCutJournal ? NumJournalCuts : NumSnapshotCuts)++;
+
+		if (!bPassed)
+		{
+			++NumFailures;
+			UE_LOG(LogModulusSettings, Error,
+				TEXT("SettingsJournal::RunFaultInjectionTest -- trial %d: %s cut at %d recovered [%.0f, %.0f, %.0f, %.0f]"),
+				Trial, bCutJournal ? TEXT("journal") : TEXT("newest snapshot"), CutAt,
+				Recovered[0], Recovered[1], Recovered[2], Recovered[3]);
+		}
+	}
+
+	UMCore_PlayerSettingsSave::DeletePlayerSettings(SlotName);
+
+	UE_LOG(LogModulusSettings, Display,
+		TEXT("SettingsJournal::RunFaultInjectionTest -- seed %d: %d trial(s), %d journal cut(s), %d snapshot cut(s), %d failure(s)"),
+		Seed, NumTrials, NumJournalCuts, NumSnapshotCuts, NumFailures);
+}
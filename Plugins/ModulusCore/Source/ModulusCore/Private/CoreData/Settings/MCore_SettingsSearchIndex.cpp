@@ -0,0 +1,368 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Settings/MCore_SettingsSearchIndex.h"
+
+#include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+
+#include "Algo/Sort.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "String/Find.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	/* Relative weight of a match by the field it was found in */
+	float GetFieldWeight(uint8 Field)
+	{
+		static constexpr float Weights[] = { 1.0f, 0.8f, 0.5f, 0.3f };
+		return Weights[Field];
+	}
+
+	/* Lowercase token vs lowercase term. Each rule still matches if Token is shortened. */
+	float ScoreTerm(FStringView Term, FStringView Token)
+	{
+		const int32 TokenLength = Token.Len();
+		const int32 TermLength = Term.Len();
+		if (TokenLength == 0 || TokenLength > TermLength) { return 0.0f; }
+
+		const float Coverage = static_cast<float>(TokenLength) / TermLength;
+
+		if (Term.StartsWith(Token, ESearchCase::CaseSensitive))
+		{
+			return TokenLength == TermLength ? 1.0f : 0.7f + 0.2f * Coverage;
+		}
+
+		if (UE::String::FindFirst(Term, Token, ESearchCase::CaseSensitive) != INDEX_NONE)
+		{
+			return 0.5f;
+		}
+
+		/* Fuzzy: in-order subsequence anchored on the first character */
+		if (Term[0] != Token[0]) { return 0.0f; }
+
+		int32 TokenIndex = 1;
+		for (int32 TermIndex = 1; TermIndex < TermLength && TokenIndex < TokenLength; ++TermIndex)
+		{
+			if (Term[TermIndex] == Token[TokenIndex]) { ++TokenIndex; }
+		}
+		return TokenIndex == TokenLength ? 0.2f + 0.2f * Coverage : 0.0f;
+	}
+
+	FString GetCurrentLanguageName()
+	{
+		return FInternationalization::Get().GetCurrentLanguage()->GetName();
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommand CmdSettingsSearchBenchmark(
+		TEXT("Modulus.Settings.Search.Benchmark"),
+		TEXT("Times settings search over a synthetic registry. Usage: Modulus.Settings.Search.Benchmark [NumDefinitions=10000] [Repeats=20]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumDefinitions = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+			const int32 NumRepeats = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20;
+			FMCore_SettingsSearchIndex::RunSyntheticBenchmark(NumDefinitions, NumRepeats);
+		}));
+#endif
+}
+
+// ============================================================================
+// INDEX BUILD
+// ============================================================================
+
+TSharedRef<const FMCore_SettingsSearchIndex> FMCore_SettingsSearchIndex::Build(
+	TConstArrayView<const UMCore_DA_SettingDefinition*> Definitions,
+	FCategoryNameResolver GetCategoryName,
+	FCategoryParentResolver GetCategoryParent)
+{
+	TSharedRef<FMCore_SettingsSearchIndex> Index = MakeShared<FMCore_SettingsSearchIndex>();
+	Index->Language = GetCurrentLanguageName();
+	Index->Entries.Reserve(Definitions.Num());
+	Index->Terms.Reserve(Definitions.Num() * 8);
+	Index->CharPool.Reserve(Definitions.Num() * 64);
+
+	/* Category names repeat across every row of a page; resolve each tag once */
+	TMap<FGameplayTag, FText> CategoryPaths;
+
+	for (const UMCore_DA_SettingDefinition* Definition : Definitions)
+	{
+		if (!Definition) { continue; }
+
+		FText* CategoryPath = CategoryPaths.Find(Definition->CategoryTag);
+		if (!CategoryPath)
+		{
+			const FGameplayTag ParentTag = Definition->CategoryTag.IsValid()
+				? GetCategoryParent(Definition->CategoryTag)
+				: FGameplayTag();
+			const FText LeafName = Definition->CategoryTag.IsValid() ? GetCategoryName(Definition->CategoryTag) : FText::GetEmpty();
+			CategoryPath = &CategoryPaths.Add(Definition->CategoryTag, ParentTag.IsValid()
+				? FText::Format(NSLOCTEXT("ModulusCore", "SettingsSearchCategoryPath", "{0} / {1}"), GetCategoryName(ParentTag), LeafName)
+				: LeafName);
+		}
+
+		FEntry& Entry = Index->Entries.AddDefaulted_GetRef();
+		Entry.Definition = Definition;
+		Entry.CategoryPath = *CategoryPath;
+		Entry.FirstTerm = Index->Terms.Num();
+
+		Index->AddTerms(Definition->DisplayName.ToString(), EField::DisplayName);
+		for (const FText& Keyword : Definition->SearchKeywords)
+		{
+			Index->AddTerms(Keyword.ToString(), EField::Keyword);
+		}
+		Index->AddTerms(CategoryPath->ToString(), EField::Category);
+		Index->AddTerms(Definition->Description.ToString(), EField::Description);
+
+		Entry.NumTerms = Index->Terms.Num() - Entry.FirstTerm;
+	}
+
+	return Index;
+}
+
+void FMCore_SettingsSearchIndex::AddTerms(const FString& Source, EField Field)
+{
+	int32 TermStart = INDEX_NONE;
+	for (int32 Index = 0; Index <= Source.Len(); ++Index)
+	{
+		const TCHAR Char = Index < Source.Len() ? Source[Index] : TEXT('\0');
+		if (Char != TEXT('\0') && FChar::IsAlnum(Char))
+		{
+			if (TermStart == INDEX_NONE) { TermStart = CharPool.Num(); }
+			CharPool.Add(FChar::ToLower(Char));
+		}
+		else if (TermStart != INDEX_NONE)
+		{
+			Terms.Add({ TermStart, CharPool.Num() - TermStart, Field });
+			TermStart = INDEX_NONE;
+		}
+	}
+}
+
+bool FMCore_SettingsSearchIndex::IsCurrentLanguage() const
+{
+	return Language == GetCurrentLanguageName();
+}
+
+// ============================================================================
+// SCORING
+// ============================================================================
+
+float FMCore_SettingsSearchIndex::ScoreToken(const FEntry& Entry, FStringView Token) const
+{
+	float Best = 0.0f;
+	for (int32 TermIndex = Entry.FirstTerm; TermIndex < Entry.FirstTerm + Entry.NumTerms; ++TermIndex)
+	{
+		const FTerm& Term = Terms[TermIndex];
+		const float Weight = GetFieldWeight(static_cast<uint8>(Term.Field));
+		if (Weight <= Best) { continue; }
+
+		const float Score = ScoreTerm(FStringView(CharPool.GetData() + Term.Offset, Term.Length), Token) * Weight;
+		Best = FMath::Max(Best, Score);
+	}
+	return Best;
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+void FMCore_SettingsSearchQuery::SetIndex(const TSharedPtr<const FMCore_SettingsSearchIndex>& InIndex)
+{
+	if (Index == InIndex) { return; }
+
+	Index = InIndex;
+	Reset();
+
+	Normalized.Reserve(128);
+	PreviousNormalized.Reserve(128);
+	Tokens.Reserve(16);
+	Hits.Reserve(Index ? Index->Num() : 0);
+}
+
+void FMCore_SettingsSearchQuery::Reset()
+{
+	Normalized.Reset();
+	PreviousNormalized.Reset();
+	Tokens.Reset();
+	Hits.Reset();
+}
+
+void FMCore_SettingsSearchQuery::Normalize(FStringView Text)
+{
+	Normalized.Reset();
+	Tokens.Reset();
+
+	for (const TCHAR Char : Text)
+	{
+		if (FChar::IsAlnum(Char))
+		{
+			if (Tokens.IsEmpty() || Normalized.Last() == TEXT(' '))
+			{
+				Tokens.Add({ Normalized.Num(), 0 });
+			}
+			Normalized.Add(FChar::ToLower(Char));
+			++Tokens.Last().Length;
+		}
+		else if (Normalized.Num() > 0 && Normalized.Last() != TEXT(' '))
+		{
+			/* Separators collapse to one space so a typed-ahead query stays a prefix of the next */
+			Normalized.Add(TEXT(' '));
+		}
+	}
+}
+
+float FMCore_SettingsSearchQuery::ScoreEntry(int32 Entry) const
+{
+	const FMCore_SettingsSearchIndex::FEntry& IndexEntry = Index->Entries[Entry];
+
+	/* Every token has to match something; the entry scores the sum of its best matches */
+	float Total = 0.0f;
+	for (const FTokenRange& Token : Tokens)
+	{
+		const float TokenScore = Index->ScoreToken(IndexEntry, FStringView(Normalized.GetData() + Token.Start, Token.Length));
+		if (TokenScore <= 0.0f) { return 0.0f; }
+		Total += TokenScore;
+	}
+	return Total;
+}
+
+TConstArrayView<FMCore_SettingSearchHit> FMCore_SettingsSearchQuery::Update(FStringView Text)
+{
+	if (!Index)
+	{
+		Hits.Reset();
+		return Hits;
+	}
+
+	Normalize(Text);
+
+	if (Tokens.IsEmpty())
+	{
+		Hits.Reset();
+		PreviousNormalized.Reset();
+		return Hits;
+	}
+
+	/* Typed ahead: anything that matches now also matched before, so only re-score the previous hits */
+	const bool bNarrow = PreviousNormalized.Num() > 0
+		&& Normalized.Num() >= PreviousNormalized.Num()
+		&& FMemory::Memcmp(Normalized.GetData(), PreviousNormalized.GetData(), PreviousNormalized.Num() * sizeof(TCHAR)) == 0;
+
+	if (bNarrow)
+	{
+		int32 NumKept = 0;
+		for (int32 HitIndex = 0; HitIndex < Hits.Num(); ++HitIndex)
+		{
+			const int32 Entry = Hits[HitIndex].Entry;
+			const float Score = ScoreEntry(Entry);
+			if (Score > 0.0f) { Hits[NumKept++] = { Entry, Score }; }
+		}
+		Hits.SetNum(NumKept, EAllowShrinking::No);
+	}
+	else
+	{
+		Hits.Reset();
+		for (int32 Entry = 0; Entry < Index->Num(); ++Entry)
+		{
+			const float Score = ScoreEntry(Entry);
+			if (Score > 0.0f) { Hits.Add({ Entry, Score }); }
+		}
+	}
+
+	Algo::Sort(Hits, [](const FMCore_SettingSearchHit& A, const FMCore_SettingSearchHit& B)
+	{
+		return A.Score != B.Score ? A.Score > B.Score : A.Entry < B.Entry;
+	});
+
+	PreviousNormalized.Reset();
+	PreviousNormalized.Append(Normalized);
+	return Hits;
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+void FMCore_SettingsSearchIndex::RunSyntheticBenchmark(int32 NumDefinitions, int32 NumRepeats)
+{
+	NumDefinitions = FMath::Max(NumDefinitions, 1);
+	NumRepeats = FMath::Max(NumRepeats, 1);
+
+	static const TCHAR* const Subjects[] = {
+		TEXT("Shadow"), TEXT("Texture"), TEXT("Master"), TEXT("Music"), TEXT("Camera"), TEXT("Mouse"),
+		TEXT("Foliage"), TEXT("Reflection"), TEXT("Subtitle"), TEXT("Resolution"), TEXT("Motion"), TEXT("Dialogue") };
+	static const TCHAR* const Aspects[] = {
+		TEXT("Quality"), TEXT("Volume"), TEXT("Sensitivity"), TEXT("Distance"), TEXT("Scale"), TEXT("Size"),
+		TEXT("Detail"), TEXT("Blur"), TEXT("Smoothing"), TEXT("Mode"), TEXT("Limit"), TEXT("Contrast") };
+	static const TCHAR* const Keywords[] = {
+		TEXT("fps"), TEXT("vsync"), TEXT("hdr"), TEXT("dlss"), TEXT("aa"), TEXT("fov"), TEXT("invert"), TEXT("colorblind") };
+	static const TCHAR* const Queries[] = {
+		TEXT("shadow quality"), TEXT("mstr vol"), TEXT("sensitivity"), TEXT("fps"), TEXT("res scale 4"), TEXT("zzzz") };
+
+	/* Transient definitions; nothing below can run a GC pass, so raw pointers are safe for the duration */
+	const double BuildSetupStart = FPlatformTime::Seconds();
+	TArray<const UMCore_DA_SettingDefinition*> Definitions;
+	Definitions.Reserve(NumDefinitions);
+	for (int32 Index = 0; Index < NumDefinitions; ++Index)
+	{
+		UMCore_DA_SettingDefinition* Definition = NewObject<UMCore_DA_SettingDefinition>(GetTransientPackage());
+		const TCHAR* Subject = Subjects[Index % UE_ARRAY_COUNT(Subjects)];
+		const TCHAR* Aspect = Aspects[(Index / UE_ARRAY_COUNT(Subjects)) % UE_ARRAY_COUNT(Aspects)];
+		Definition->DisplayName = FText::FromString(FString::Printf(TEXT("%s %s %d"), Subject, Aspect, Index));
+		Definition->Description = FText::FromString(FString::Printf(
+			TEXT("Adjusts the %s %s used while playing. Higher values cost more performance."), Subject, Aspect));
+		Definition->SearchKeywords.Add(FText::FromString(Keywords[Index % UE_ARRAY_COUNT(Keywords)]));
+		Definitions.Add(Definition);
+	}
+	const double SetupSeconds = FPlatformTime::Seconds() - BuildSetupStart;
+
+	const double BuildStart = FPlatformTime::Seconds();
+	const TSharedRef<const FMCore_SettingsSearchIndex> Index = Build(Definitions,
+		[](const FGameplayTag&) { return FText::FromString(TEXT("Synthetic")); },
+		[](const FGameplayTag&) { return FGameplayTag(); });
+	const double BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+
+	UE_LOG(LogModulusSettings, Display,
+		TEXT("SettingsSearchIndex::RunSyntheticBenchmark -- %d definitions (setup %.1f ms), index %d terms / %d chars built in %.2f ms"),
+		NumDefinitions, SetupSeconds * 1000.0, Index->Terms.Num(), Index->CharPool.Num(), BuildMs);
+	UE_LOG(LogModulusSettings, Display, TEXT("  %-16s %6s %10s %10s %10s"),
+		TEXT("Query"), TEXT("Hits"), TEXT("First us"), TEXT("Avg us"), TEXT("Max us"));
+
+	FMCore_SettingsSearchQuery Query;
+	Query.SetIndex(Index);
+
+	for (const TCHAR* QueryText : Queries)
+	{
+		const FStringView FullText(QueryText);
+		double FirstKeySeconds = 0.0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		int32 NumKeystrokes = 0;
+
+		for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+		{
+			Query.Reset();
+
+			/* Type it one character at a time, the way a search field sees it */
+			for (int32 Length = 1; Length <= FullText.Len(); ++Length)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				Query.Update(FullText.Left(Length));
+				const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+				if (Length == 1) { FirstKeySeconds += Seconds; }
+				TotalSeconds += Seconds;
+				MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+				++NumKeystrokes;
+			}
+		}
+
+		UE_LOG(LogModulusSettings, Display, TEXT("  %-16s %6d %10.1f %10.1f %10.1f"),
+			QueryText, Query.GetHits().Num(),
+			FirstKeySeconds * 1e6 / NumRepeats, TotalSeconds * 1e6 / NumKeystrokes, MaxSeconds * 1e6);
+	}
+}
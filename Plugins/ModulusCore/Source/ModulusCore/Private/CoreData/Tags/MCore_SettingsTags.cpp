@@ -106,6 +106,7 @@ namespace MCore_SettingsTags
     UE_DEFINE_GAMEPLAY_TAG(MCore_Settings_Event_ConfirmationRequired, "MCore.Settings.Event.ConfirmationRequired");
     UE_DEFINE_GAMEPLAY_TAG(MCore_Settings_Event_GamepadIconSetChanged, "MCore.Settings.Event.GamepadIconSetChanged");
     UE_DEFINE_GAMEPLAY_TAG(MCore_Settings_Event_ExternalValueChange, "MCore.Settings.Event.ExternalValueChange");
+    UE_DEFINE_GAMEPLAY_TAG(MCore_Settings_Event_SettingsChanged, "MCore.Settings.Event.SettingsChanged");
 
     // ========================================================================
     // UTILITY FUNCTIONS
@@ -0,0 +1,66 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Types/Settings/MCore_DA_QualityGovernorRules.h"
+
+#include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+TArray<FName> UMCore_DA_QualityGovernorRules::GetScalabilityGroupOptions()
+{
+	return UMCore_GameSettingsLibrary::GetScalabilityGroupNames();
+}
+
+#if WITH_EDITOR
+EDataValidationResult UMCore_DA_QualityGovernorRules::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	if (UpgradeBelowMs >= DowngradeAboveMs)
+	{
+		Context.AddWarning((FText::FromString(
+			FString::Printf(TEXT("%s: UpgradeBelowMs (%.2f) must be below DowngradeAboveMs (%.2f)"),
+				*GetName(), UpgradeBelowMs, DowngradeAboveMs))));
+		Result = EDataValidationResult::Invalid;
+	}
+
+	if (Groups.Num() == 0)
+	{
+		Context.AddWarning((FText::FromString(
+			FString::Printf(TEXT("%s: Groups array is zero"), *GetName()))));
+		Result = EDataValidationResult::Invalid;
+	}
+
+	/* Check for unknown and duplicate group names */
+	const TArray<FName> KnownGroups = GetScalabilityGroupOptions();
+	TSet<FName> SeenGroups;
+
+	for (int32 idx = 0; idx < Groups.Num(); ++idx)
+	{
+		const FName GroupName = Groups[idx].ScalabilityGroup;
+
+		if (!KnownGroups.Contains(GroupName))
+		{
+			Context.AddWarning((FText::FromString(
+				FString::Printf(TEXT("%s: '%s' at index %d is not a ScalabilityQuality group"),
+					*GetName(), *GroupName.ToString(), idx))));
+			Result = EDataValidationResult::Invalid;
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		SeenGroups.Add(GroupName, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			Context.AddWarning((FText::FromString(
+				FString::Printf(TEXT("%s: '%s' is listed more than once (index %d)"),
+					*GetName(), *GroupName.ToString(), idx))));
+			Result = EDataValidationResult::Invalid;
+		}
+	}
+
+	return Result;
+}
+#endif
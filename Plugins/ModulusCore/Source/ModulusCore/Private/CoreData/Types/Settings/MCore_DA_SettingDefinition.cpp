@@ -93,6 +93,18 @@ EDataValidationResult UMCore_DA_SettingDefinition::IsDataValid(FDataValidationCo
 		break;
 	}
 
+	for (int32 idx = 0; idx < Dependencies.Num(); ++idx)
+	{
+		const FGameplayTag& Source = Dependencies[idx].SourceSetting;
+		if (!Source.IsValid() || Source == SettingTag)
+		{
+			Context.AddError(FText::FromString(
+				FString::Printf(TEXT("%s: Dependencies[%d] needs a SourceSetting other than this setting"),
+					*GetName(), idx)));
+			Result = EDataValidationResult::Invalid;
+		}
+	}
+
 	return Result;
 }
 #endif
@@ -0,0 +1,211 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreData/Types/Settings/MCore_DA_SettingsRegistry.h"
+
+#include "CoreData/Types/Settings/MCore_DA_SettingsCollection.h"
+
+#include "Algo/StableSort.h"
+#include "Misc/Crc.h"
+
+// ============================================================================
+// LOOKUPS
+// ============================================================================
+
+int32 UMCore_DA_SettingsRegistry::FindOrdinalByTag(const FGameplayTag& SettingTag) const
+{
+	const int32* Found = TagToOrdinal.Find(SettingTag);
+	return Found ? *Found : INDEX_NONE;
+}
+
+const FMCore_BakedSettingCategory* UMCore_DA_SettingsRegistry::FindCategory(const FGameplayTag& CategoryTag) const
+{
+	const int32* Found = CategoryToIndex.Find(CategoryTag);
+	return Found ? &Categories[*Found] : nullptr;
+}
+
+uint32 UMCore_DA_SettingsRegistry::ComputeContentHash() const
+{
+	/* Canonical text form: fixed field order, object refs by path, floats at fixed precision */
+	TStringBuilder<4096> Text;
+
+	for (const TSoftObjectPtr<UMCore_DA_SettingsCollection>& Collection : SourceCollections)
+	{
+		Text.Appendf(TEXT("C|%s\n"), *Collection.ToString());
+	}
+
+	for (const FMCore_BakedSettingEntry& Entry : Settings)
+	{
+		Text.Appendf(TEXT("S|%s|%s|%s|%s|%d|%d|%.6f|%d|%d|%.6f|%.6f|%.6f|%d|%s|%s|%s|%s|%d|%d\n"),
+			*GetPathNameSafe(Entry.Definition),
+			*Entry.SettingTag.ToString(), *Entry.CategoryTag.ToString(), *Entry.SaveKey,
+			static_cast<int32>(Entry.SettingType), Entry.SortOrder,
+			Entry.DefaultValue, Entry.DefaultDropdownIndex, Entry.bDefaultToggleValue ? 1 : 0,
+			Entry.MinValue, Entry.MaxValue, Entry.StepSize, Entry.NumSelectableOptions,
+			*Entry.NamedSetter.ToString(), *Entry.ConsoleVariable.ToString(),
+			*Entry.SoundClass.ToString(), *Entry.PushedSoundMix.ToString(),
+			static_cast<int32>(Entry.ColorVisionRole), Entry.bRequiresConfirmation ? 1 : 0);
+	}
+
+	for (const FMCore_BakedSettingCategory& Category : Categories)
+	{
+		Text.Appendf(TEXT("K|%s|%s|%s|%d|"),
+			*Category.CategoryTag.ToString(), *Category.ParentTag.ToString(),
+			*Category.DisplayName.ToString(), Category.MinSortOrder);
+		for (const int32 Ordinal : Category.SettingOrdinals)
+		{
+			Text.Appendf(TEXT("%d,"), Ordinal);
+		}
+		Text.AppendChar(TEXT('\n'));
+	}
+
+	for (const FMCore_BakedCategoryGroup& Group : CategoryGroups)
+	{
+		Text.Appendf(TEXT("G|%s|"), *Group.ParentTag.ToString());
+		for (const int32 CategoryIndex : Group.CategoryIndices)
+		{
+			Text.Appendf(TEXT("%d,"), CategoryIndex);
+		}
+		Text.AppendChar(TEXT('\n'));
+	}
+
+	return FCrc::StrCrc32(Text.ToString());
+}
+
+void UMCore_DA_SettingsRegistry::PostLoad()
+{
+	Super::PostLoad();
+	BuildLookups();
+}
+
+void UMCore_DA_SettingsRegistry::BuildLookups()
+{
+	TagToOrdinal.Reset();
+	TagToOrdinal.Reserve(Settings.Num());
+	for (int32 Ordinal = 0; Ordinal < Settings.Num(); ++Ordinal)
+	{
+		TagToOrdinal.Add(Settings[Ordinal].SettingTag, Ordinal);
+	}
+
+	CategoryToIndex.Reset();
+	CategoryToIndex.Reserve(Categories.Num());
+	for (int32 CategoryIndex = 0; CategoryIndex < Categories.Num(); ++CategoryIndex)
+	{
+		CategoryToIndex.Add(Categories[CategoryIndex].CategoryTag, CategoryIndex);
+	}
+}
+
+// ============================================================================
+// BAKE (EDITOR ONLY)
+// ============================================================================
+
+#if WITH_EDITOR
+void UMCore_DA_SettingsRegistry::BakeFrom(TConstArrayView<UMCore_DA_SettingsCollection*> Collections)
+{
+	SourceCollections.Reset();
+	Settings.Reset();
+	Categories.Reset();
+	CategoryGroups.Reset();
+
+	/* Ordinals: same walk as the subsystem's live ordinal table so saves bind identically */
+	TMap<FString, int32> SaveKeyToOrdinal;
+	for (UMCore_DA_SettingsCollection* Collection : Collections)
+	{
+		if (!Collection) { continue; }
+		SourceCollections.Add(Collection);
+
+		for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+		{
+			if (!Setting || !Setting->SettingTag.IsValid()) { continue; }
+
+			FString SaveKey = Setting->GetSaveKey();
+			if (SaveKeyToOrdinal.Contains(SaveKey)) { continue; }
+			SaveKeyToOrdinal.Add(SaveKey, Settings.Num());
+
+			FMCore_BakedSettingEntry& Entry = Settings.AddDefaulted_GetRef();
+			Entry.Definition = Setting;
+			Entry.SettingTag = Setting->SettingTag;
+			Entry.CategoryTag = Setting->CategoryTag;
+			Entry.SaveKey = MoveTemp(SaveKey);
+			Entry.SettingType = Setting->SettingType;
+			Entry.SortOrder = Setting->SortOrder;
+			Entry.DefaultValue = Setting->DefaultValue;
+			Entry.DefaultDropdownIndex = Setting->DefaultDropdownIndex;
+			Entry.bDefaultToggleValue = Setting->DefaultToggleValue;
+			Entry.MinValue = Setting->MinValue;
+			Entry.MaxValue = Setting->MaxValue;
+			Entry.StepSize = Setting->StepSize;
+			Entry.NumSelectableOptions = Setting->NumSelectableOptions > 0
+				? FMath::Min(Setting->NumSelectableOptions, Setting->DropdownOptions.Num())
+				: Setting->DropdownOptions.Num();
+			Entry.NamedSetter = Setting->NamedSetter;
+			Entry.ConsoleVariable = Setting->ConsoleVariable;
+			Entry.SoundClass = Setting->SoundClass.ToSoftObjectPath();
+			Entry.PushedSoundMix = Setting->PushedSoundMix.ToSoftObjectPath();
+			Entry.ColorVisionRole = Setting->ColorVisionRole;
+			Entry.bRequiresConfirmation = Setting->bRequiresConfirmation;
+		}
+	}
+
+	/* Category buckets, rows stably sorted by SortOrder so ties keep ordinal order */
+	TMap<FGameplayTag, int32> CategoryIndexByTag;
+	for (int32 Ordinal = 0; Ordinal < Settings.Num(); ++Ordinal)
+	{
+		const FMCore_BakedSettingEntry& Entry = Settings[Ordinal];
+		if (!Entry.CategoryTag.IsValid()) { continue; }
+
+		int32* ExistingIndex = CategoryIndexByTag.Find(Entry.CategoryTag);
+		if (!ExistingIndex)
+		{
+			ExistingIndex = &CategoryIndexByTag.Add(Entry.CategoryTag, Categories.Num());
+			FMCore_BakedSettingCategory& NewCategory = Categories.AddDefaulted_GetRef();
+			NewCategory.CategoryTag = Entry.CategoryTag;
+			NewCategory.ParentTag = Entry.CategoryTag.RequestDirectParent();
+			NewCategory.MinSortOrder = Entry.SortOrder;
+
+			for (const UMCore_DA_SettingsCollection* Collection : Collections)
+			{
+				if (!Collection) { continue; }
+				if (const FText* Name = Collection->CategoryDisplayName.Find(Entry.CategoryTag))
+				{
+					NewCategory.DisplayName = *Name;
+					break;
+				}
+			}
+		}
+
+		FMCore_BakedSettingCategory& Category = Categories[*ExistingIndex];
+		Category.MinSortOrder = FMath::Min(Category.MinSortOrder, Entry.SortOrder);
+		Category.SettingOrdinals.Add(Ordinal);
+	}
+
+	for (FMCore_BakedSettingCategory& Category : Categories)
+	{
+		Algo::StableSortBy(Category.SettingOrdinals, [this](int32 Ordinal) { return Settings[Ordinal].SortOrder; });
+	}
+
+	/* Tag name breaks MinSortOrder ties so the order never depends on hashing */
+	Algo::StableSort(Categories, [](const FMCore_BakedSettingCategory& A, const FMCore_BakedSettingCategory& B)
+	{
+		if (A.MinSortOrder != B.MinSortOrder) { return A.MinSortOrder < B.MinSortOrder; }
+		return A.CategoryTag.GetTagName().Compare(B.CategoryTag.GetTagName()) < 0;
+	});
+
+	for (int32 CategoryIndex = 0; CategoryIndex < Categories.Num(); ++CategoryIndex)
+	{
+		const FGameplayTag& ParentTag = Categories[CategoryIndex].ParentTag;
+		if (!ParentTag.IsValid()) { continue; }
+
+		FMCore_BakedCategoryGroup* Group = CategoryGroups.FindByPredicate(
+			[&ParentTag](const FMCore_BakedCategoryGroup& Existing) { return Existing.ParentTag == ParentTag; });
+		if (!Group)
+		{
+			Group = &CategoryGroups.AddDefaulted_GetRef();
+			Group->ParentTag = ParentTag;
+		}
+		Group->CategoryIndices.Add(CategoryIndex);
+	}
+
+	BuildLookups();
+	ContentHash = ComputeContentHash();
+}
+#endif
@@ -2,15 +2,287 @@
 
 #include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
 
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
 #include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Settings/MCore_SettingsJournal.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
 
+#include "Async/Async.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/UserInterfaceSettings.h"
 #include "Engine/Engine.h"
 #include "GameFramework/GameUserSettings.h"
 
+namespace
+{
+	/* Game thread only, like every other access to the save. Shared across save objects
+	   on purpose: a widget holding a version from a replaced save must never see it reused.
+	   Only live saves allocate; class defaults and archetypes keep version 0. */
+	uint64 GMCore_LastSettingValueVersion = 0;
+
+	uint64 AllocateSettingValueVersion()
+	{
+		return ++GMCore_LastSettingValueVersion;
+	}
+}
+
 UMCore_PlayerSettingsSave::UMCore_PlayerSettingsSave()
 {
+	if (HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject)) { return; }
+
+	/* Distinct from any version a widget read off a previous save object */
+	KeyedValuesVersion = AllocateSettingValueVersion();
+	QualityPresetVersion = AllocateSettingValueVersion();
+}
+
+// ============================================================================
+// ORDINAL STORAGE
+// ============================================================================
+
+void UMCore_PlayerSettingsSave::BindOrdinals(const TSharedPtr<const FMCore_SettingOrdinalTable>& Table)
+{
+	if (BoundOrdinals == Table) { return; }
+
+	/* Dirty bits do not survive the rebind; keep unpersisted values pending by key */
+	if (BoundOrdinals)
+	{
+		for (TConstSetBitIterator<> It(DirtyValues); It; ++It)
+		{
+			PendingKeyedWrites.Add(BoundOrdinals->SaveKeys[It.GetIndex()], BoundOrdinals->Types[It.GetIndex()]);
+		}
+	}
+
+	FoldDenseValuesIntoMaps();
+	BoundOrdinals = Table;
+
+	const int32 Num = BoundOrdinals ? BoundOrdinals->Num() : 0;
+	FloatValues.Init(0.f, Num);
+	IntValues.Init(0, Num);
+	BoolValues.Init(false, Num);
+	StoredValues.Init(false, Num);
+	DirtyValues.Init(false, Num);
+	ValueVersions.Init(AllocateSettingValueVersion(), Num);
+	KeyedValuesVersion = AllocateSettingValueVersion();
+
+	DrainMapsIntoDenseValues();
+
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("PlayerSettingsSave::BindOrdinals -- bound %d ordinal(s), %d unregistered key(s) kept in keyed storage"),
+		Num, FloatSettings.Num() + IntSettings.Num() + BoolSettings.Num());
+}
+
+int32 UMCore_PlayerSettingsSave::FindDenseOrdinal(const FString& Key, EMCore_SettingType ExpectedType) const
+{
+	if (!BoundOrdinals) { return INDEX_NONE; }
+
+	const int32 Ordinal = BoundOrdinals->FindOrdinal(Key);
+	return (Ordinal != INDEX_NONE && BoundOrdinals->Types[Ordinal] == ExpectedType) ? Ordinal : INDEX_NONE;
+}
+
+int32 UMCore_PlayerSettingsSave::FindDenseOrdinal(const UMCore_DA_SettingDefinition* Setting,
+	EMCore_SettingType ExpectedType) const
+{
+	if (!BoundOrdinals || !Setting) { return INDEX_NONE; }
+
+	const int32 Ordinal = BoundOrdinals->FindOrdinal(Setting);
+	return (Ordinal != INDEX_NONE && BoundOrdinals->Types[Ordinal] == ExpectedType) ? Ordinal : INDEX_NONE;
+}
+
+uint64 UMCore_PlayerSettingsSave::GetValueVersion(const UMCore_DA_SettingDefinition* Setting) const
+{
+	if (!Setting) { return 0; }
+
+	const int32 Ordinal = FindDenseOrdinal(Setting, Setting->SettingType);
+	return Ordinal != INDEX_NONE ? ValueVersions[Ordinal] : KeyedValuesVersion;
+}
+
+void UMCore_PlayerSettingsSave::MarkDenseValueWritten(int32 Ordinal, bool bChanged)
+{
+	if (bChanged || !StoredValues[Ordinal])
+	{
+		ValueVersions[Ordinal] = AllocateSettingValueVersion();
+	}
+	StoredValues[Ordinal] = true;
+	DirtyValues[Ordinal] = true;
+}
+
+void UMCore_PlayerSettingsSave::FoldDenseValuesIntoMaps()
+{
+	if (!BoundOrdinals) { return; }
+
+	for (TConstSetBitIterator<> It(StoredValues); It; ++It)
+	{
+		const int32 Ordinal = It.GetIndex();
+		const FString& Key = BoundOrdinals->SaveKeys[Ordinal];
+		switch (BoundOrdinals->Types[Ordinal])
+		{
+		case EMCore_SettingType::Slider:   FloatSettings.Add(Key, FloatValues[Ordinal]); break;
+		case EMCore_SettingType::Dropdown: IntSettings.Add(Key, IntValues[Ordinal]); break;
+		case EMCore_SettingType::Toggle:   BoolSettings.Add(Key, BoolValues[Ordinal]); break;
+		default: break;
+		}
+	}
+}
+
+void UMCore_PlayerSettingsSave::DrainMapsIntoDenseValues()
+{
+	if (!BoundOrdinals) { return; }
+
+	for (int32 Ordinal = 0; Ordinal < BoundOrdinals->Num(); ++Ordinal)
+	{
+		const FString& Key = BoundOrdinals->SaveKeys[Ordinal];
+		switch (BoundOrdinals->Types[Ordinal])
+		{
+		case EMCore_SettingType::Slider:
+			StoredValues[Ordinal] = FloatSettings.RemoveAndCopyValue(Key, FloatValues[Ordinal]);
+			break;
+		case EMCore_SettingType::Dropdown:
+			StoredValues[Ordinal] = IntSettings.RemoveAndCopyValue(Key, IntValues[Ordinal]);
+			break;
+		case EMCore_SettingType::Toggle:
+		{
+			bool Value = false;
+			StoredValues[Ordinal] = BoolSettings.RemoveAndCopyValue(Key, Value);
+			BoolValues[Ordinal] = Value;
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+bool UMCore_PlayerSettingsSave::GetFloatValue(const UMCore_DA_SettingDefinition* Setting, float& OutValue) const
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Slider);
+	if (Ordinal == INDEX_NONE) { return Setting && GetFloatSetting(Setting->GetSaveKey(), OutValue); }
+
+	if (!StoredValues[Ordinal]) { return false; }
+	OutValue = FloatValues[Ordinal];
+	return true;
+}
+
+void UMCore_PlayerSettingsSave::SetFloatValue(const UMCore_DA_SettingDefinition* Setting, float Value)
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Slider);
+	if (Ordinal == INDEX_NONE)
+	{
+		if (Setting)
+		{
+			FloatSettings.Add(Setting->GetSaveKey(), Value);
+			PendingKeyedWrites.Add(Setting->GetSaveKey(), EMCore_SettingType::Slider);
+			KeyedValuesVersion = AllocateSettingValueVersion();
+		}
+		return;
+	}
+
+	const bool bChanged = FloatValues[Ordinal] != Value;
+	FloatValues[Ordinal] = Value;
+	MarkDenseValueWritten(Ordinal, bChanged);
+}
+
+bool UMCore_PlayerSettingsSave::GetIntValue(const UMCore_DA_SettingDefinition* Setting, int32& OutValue) const
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Dropdown);
+	if (Ordinal == INDEX_NONE) { return Setting && GetIntSetting(Setting->GetSaveKey(), OutValue); }
+
+	if (!StoredValues[Ordinal]) { return false; }
+	OutValue = IntValues[Ordinal];
+	return true;
+}
+
+void UMCore_PlayerSettingsSave::SetIntValue(const UMCore_DA_SettingDefinition* Setting, int32 Value)
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Dropdown);
+	if (Ordinal == INDEX_NONE)
+	{
+		if (Setting)
+		{
+			IntSettings.Add(Setting->GetSaveKey(), Value);
+			PendingKeyedWrites.Add(Setting->GetSaveKey(), EMCore_SettingType::Dropdown);
+			KeyedValuesVersion = AllocateSettingValueVersion();
+		}
+		return;
+	}
+
+	const bool bChanged = IntValues[Ordinal] != Value;
+	IntValues[Ordinal] = Value;
+	MarkDenseValueWritten(Ordinal, bChanged);
+}
+
+bool UMCore_PlayerSettingsSave::GetBoolValue(const UMCore_DA_SettingDefinition* Setting, bool& OutValue) const
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Toggle);
+	if (Ordinal == INDEX_NONE) { return Setting && GetBoolSetting(Setting->GetSaveKey(), OutValue); }
+
+	if (!StoredValues[Ordinal]) { return false; }
+	OutValue = BoolValues[Ordinal];
+	return true;
+}
+
+void UMCore_PlayerSettingsSave::SetBoolValue(const UMCore_DA_SettingDefinition* Setting, bool Value)
+{
+	const int32 Ordinal = FindDenseOrdinal(Setting, EMCore_SettingType::Toggle);
+	if (Ordinal == INDEX_NONE)
+	{
+		if (Setting)
+		{
+			BoolSettings.Add(Setting->GetSaveKey(), Value);
+			PendingKeyedWrites.Add(Setting->GetSaveKey(), EMCore_SettingType::Toggle);
+			KeyedValuesVersion = AllocateSettingValueVersion();
+		}
+		return;
+	}
+
+	const bool bChanged = BoolValues[Ordinal] != Value;
+	BoolValues[Ordinal] = Value;
+	MarkDenseValueWritten(Ordinal, bChanged);
+}
+
+void UMCore_PlayerSettingsSave::CopySettingValuesFrom(const UMCore_PlayerSettingsSave* Source)
+{
+	if (!Source || Source == this) { return; }
+
+	/* Source may itself be bound; fold a copy so it stays untouched. */
+	TMap<FString, float> SourceFloats = Source->FloatSettings;
+	TMap<FString, int32> SourceInts = Source->IntSettings;
+	TMap<FString, bool> SourceBools = Source->BoolSettings;
+	if (const FMCore_SettingOrdinalTable* SourceTable = Source->BoundOrdinals.Get())
+	{
+		for (TConstSetBitIterator<> It(Source->StoredValues); It; ++It)
+		{
+			const int32 Ordinal = It.GetIndex();
+			const FString& Key = SourceTable->SaveKeys[Ordinal];
+			switch (SourceTable->Types[Ordinal])
+			{
+			case EMCore_SettingType::Slider:   SourceFloats.Add(Key, Source->FloatValues[Ordinal]); break;
+			case EMCore_SettingType::Dropdown: SourceInts.Add(Key, Source->IntValues[Ordinal]); break;
+			case EMCore_SettingType::Toggle:   SourceBools.Add(Key, Source->BoolValues[Ordinal]); break;
+			default: break;
+			}
+		}
+	}
+
+	FloatSettings = MoveTemp(SourceFloats);
+	IntSettings = MoveTemp(SourceInts);
+	BoolSettings = MoveTemp(SourceBools);
+
+	if (BoundOrdinals)
+	{
+		StoredValues.Init(false, BoundOrdinals->Num());
+		DirtyValues.Init(false, BoundOrdinals->Num());
+		ValueVersions.Init(AllocateSettingValueVersion(), BoundOrdinals->Num());
+		DrainMapsIntoDenseValues();
+	}
+	KeyedValuesVersion = AllocateSettingValueVersion();
+
+	/* Keys absent from Source were dropped, and the journal only records writes */
+	bRequiresFullSave = true;
+}
+
+int32 UMCore_PlayerSettingsSave::GetStoredSettingCount() const
+{
+	return StoredValues.CountSetBits() + FloatSettings.Num() + IntSettings.Num() + BoolSettings.Num();
 }
 
 // ============================================================================
@@ -19,6 +291,14 @@ UMCore_PlayerSettingsSave::UMCore_PlayerSettingsSave()
 
 bool UMCore_PlayerSettingsSave::GetFloatSetting(const FString& Key, float& OutValue) const
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Slider);
+	if (Ordinal != INDEX_NONE)
+	{
+		if (!StoredValues[Ordinal]) { return false; }
+		OutValue = FloatValues[Ordinal];
+		return true;
+	}
+
 	if (const float* FoundSetting = FloatSettings.Find(Key))
 	{
 		OutValue = *FoundSetting;
@@ -29,11 +309,30 @@ bool UMCore_PlayerSettingsSave::GetFloatSetting(const FString& Key, float& OutVa
 
 void UMCore_PlayerSettingsSave::SetFloatSetting(const FString& Key, float Value)
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Slider);
+	if (Ordinal != INDEX_NONE)
+	{
+		const bool bChanged = FloatValues[Ordinal] != Value;
+		FloatValues[Ordinal] = Value;
+		MarkDenseValueWritten(Ordinal, bChanged);
+		return;
+	}
+
 	FloatSettings.Add(Key, Value);
+	PendingKeyedWrites.Add(Key, EMCore_SettingType::Slider);
+	KeyedValuesVersion = AllocateSettingValueVersion();
 }
 
 bool UMCore_PlayerSettingsSave::GetIntSetting(const FString& Key, int32& OutValue) const
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Dropdown);
+	if (Ordinal != INDEX_NONE)
+	{
+		if (!StoredValues[Ordinal]) { return false; }
+		OutValue = IntValues[Ordinal];
+		return true;
+	}
+
 	if (const int32* FoundSetting = IntSettings.Find(Key))
 	{
 		OutValue = *FoundSetting;
@@ -44,11 +343,30 @@ bool UMCore_PlayerSettingsSave::GetIntSetting(const FString& Key, int32& OutValu
 
 void UMCore_PlayerSettingsSave::SetIntSetting(const FString& Key, int32 Value)
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Dropdown);
+	if (Ordinal != INDEX_NONE)
+	{
+		const bool bChanged = IntValues[Ordinal] != Value;
+		IntValues[Ordinal] = Value;
+		MarkDenseValueWritten(Ordinal, bChanged);
+		return;
+	}
+
 	IntSettings.Add(Key, Value);
+	PendingKeyedWrites.Add(Key, EMCore_SettingType::Dropdown);
+	KeyedValuesVersion = AllocateSettingValueVersion();
 }
 
 bool UMCore_PlayerSettingsSave::GetBoolSetting(const FString& Key, bool& OutValue) const
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Toggle);
+	if (Ordinal != INDEX_NONE)
+	{
+		if (!StoredValues[Ordinal]) { return false; }
+		OutValue = BoolValues[Ordinal];
+		return true;
+	}
+
 	if (const bool* FoundSetting = BoolSettings.Find(Key))
 	{
 		OutValue = *FoundSetting;
@@ -59,7 +377,18 @@ bool UMCore_PlayerSettingsSave::GetBoolSetting(const FString& Key, bool& OutValu
 
 void UMCore_PlayerSettingsSave::SetBoolSetting(const FString& Key, bool Value)
 {
+	const int32 Ordinal = FindDenseOrdinal(Key, EMCore_SettingType::Toggle);
+	if (Ordinal != INDEX_NONE)
+	{
+		const bool bChanged = BoolValues[Ordinal] != Value;
+		BoolValues[Ordinal] = Value;
+		MarkDenseValueWritten(Ordinal, bChanged);
+		return;
+	}
+
 	BoolSettings.Add(Key, Value);
+	PendingKeyedWrites.Add(Key, EMCore_SettingType::Toggle);
+	KeyedValuesVersion = AllocateSettingValueVersion();
 }
 
 // ============================================================================
@@ -68,34 +397,239 @@ void UMCore_PlayerSettingsSave::SetBoolSetting(const FString& Key, bool Value)
 
 void UMCore_PlayerSettingsSave::SaveSettings()
 {
-	UGameplayStatics::SaveGameToSlot(this, CachedSlotName, 0);
-	UE_LOG(LogModulusSettings, Log, TEXT("PlayerSettingsSave::SaveSettings -- saved to slot '%s'"), *CachedSlotName);
+	/* Serialization only sees the keyed maps: fold dense values in for the write,
+	   then drain them back out so runtime lookups stay on the arrays. */
+	TArray<uint8> SaveBytes;
+	FoldDenseValuesIntoMaps();
+	const bool bSerialized = UGameplayStatics::SaveGameToMemory(this, SaveBytes);
+	DrainMapsIntoDenseValues();
+
+	if (!bSerialized)
+	{
+		UE_LOG(LogModulusSettings, Error,
+			TEXT("PlayerSettingsSave::SaveSettings -- failed to serialize settings for slot '%s'"), *CachedSlotName);
+		return;
+	}
+
+	/* Overwrite the older snapshot; if this write tears, the newer one still loads */
+	const int32 TargetSlot = SnapshotSlot == 0 ? 1 : 0;
+	const FString TargetSlotName = TargetSlot == 0
+		? CachedSlotName
+		: FMCore_SettingsJournal::GetAlternateSlotName(CachedSlotName);
+
+	FMCore_SettingsSnapshotInfo Info;
+	Info.Generation = SnapshotGeneration + 1;
+	Info.LastSequence = LastJournalSequence;
+	FMCore_SettingsJournal::FrameSnapshot(SaveBytes, Info);
+
+	if (!UGameplayStatics::SaveDataToSlot(SaveBytes, TargetSlotName, 0))
+	{
+		UE_LOG(LogModulusSettings, Error,
+			TEXT("PlayerSettingsSave::SaveSettings -- failed to write slot '%s'; previous snapshot and journal kept"),
+			*TargetSlotName);
+		return;
+	}
+
+	SnapshotSlot = TargetSlot;
+	SnapshotGeneration = Info.Generation;
+
+	/* Everything journaled so far is in the snapshot now */
+	if (FMCore_SettingsJournal::IsEnabled())
+	{
+		FMCore_SettingsJournal::Reset(CachedSlotName, LastJournalSequence);
+	}
+	else
+	{
+		FMCore_SettingsJournal::Delete(CachedSlotName);
+	}
+	JournalBaseSequence = LastJournalSequence;
+	NumJournalRecords = 0;
+
+	ClearPendingPersist();
+	bRequiresFullSave = false;
+
+	UE_LOG(LogModulusSettings, Log, TEXT("PlayerSettingsSave::SaveSettings -- saved to slot '%s' (generation %llu)"),
+		*TargetSlotName, SnapshotGeneration);
 }
 
-UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSave::LoadPlayerSettings(const FString& SlotName)
+void UMCore_PlayerSettingsSave::PersistSettingValues()
 {
-	UMCore_PlayerSettingsSave* Settings = nullptr;
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	/* The journal needs a snapshot underneath it */
+	if (!CoreSettings || !FMCore_SettingsJournal::IsEnabled() || bRequiresFullSave || SnapshotSlot == INDEX_NONE)
+	{
+		SaveSettings();
+		return;
+	}
+
+	TArray<FMCore_SettingsJournalRecord> Records;
+	CollectPendingJournalRecords(Records);
+	if (Records.IsEmpty()) { return; }
+
+	if (!FMCore_SettingsJournal::AppendRecords(CachedSlotName, JournalBaseSequence, Records))
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("PlayerSettingsSave::PersistSettingValues -- journal for slot '%s' not writable, falling back to a full save"),
+			*CachedSlotName);
+		SaveSettings();
+		return;
+	}
+
+	NumJournalRecords += Records.Num();
+	ClearPendingPersist();
 
-	bool bExistingSave{false};
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("PlayerSettingsSave::PersistSettingValues -- journaled %d value(s) for slot '%s' (%d since last snapshot)"),
+		Records.Num(), *CachedSlotName, NumJournalRecords);
+
+	if (NumJournalRecords >= CoreSettings->SettingsJournalCompactionThreshold)
+	{
+		SaveSettings();
+	}
+}
+
+void UMCore_PlayerSettingsSave::CollectPendingJournalRecords(TArray<FMCore_SettingsJournalRecord>& OutRecords)
+{
+	auto AddRecord = [this, &OutRecords](const FString& Key, EMCore_SettingType Type)
+	{
+		FMCore_SettingsJournalRecord Record;
+		Record.Key = Key;
+
+		bool bFound{false};
+		switch (Type)
+		{
+		case EMCore_SettingType::Slider:
+			Record.Type = EMCore_SettingsJournalRecordType::Float;
+			bFound = GetFloatSetting(Key, Record.FloatValue);
+			break;
+		case EMCore_SettingType::Dropdown:
+			Record.Type = EMCore_SettingsJournalRecordType::Int;
+			bFound = GetIntSetting(Key, Record.IntValue);
+			break;
+		case EMCore_SettingType::Toggle:
+			Record.Type = EMCore_SettingsJournalRecordType::Bool;
+			bFound = GetBoolSetting(Key, Record.bBoolValue);
+			break;
+		default:
+			break;
+		}
+
+		if (bFound)
+		{
+			Record.Sequence = ++LastJournalSequence;
+			OutRecords.Add(MoveTemp(Record));
+		}
+	};
+
+	if (BoundOrdinals)
+	{
+		for (TConstSetBitIterator<> It(DirtyValues); It; ++It)
+		{
+			AddRecord(BoundOrdinals->SaveKeys[It.GetIndex()], BoundOrdinals->Types[It.GetIndex()]);
+		}
+	}
+
+	for (const TPair<FString, EMCore_SettingType>& Pending : PendingKeyedWrites)
+	{
+		AddRecord(Pending.Key, Pending.Value);
+	}
+
+	if (bQualityPresetPendingPersist)
+	{
+		FMCore_SettingsJournalRecord& Record = OutRecords.AddDefaulted_GetRef();
+		Record.Sequence = ++LastJournalSequence;
+		Record.Type = EMCore_SettingsJournalRecordType::QualityPreset;
+		Record.IntValue = LastSelectedQualityPreset;
+	}
+}
+
+void UMCore_PlayerSettingsSave::ClearPendingPersist()
+{
+	if (DirtyValues.Num() > 0) { DirtyValues.SetRange(0, DirtyValues.Num(), false); }
+	PendingKeyedWrites.Reset();
+	bQualityPresetPendingPersist = false;
+}
+
+void UMCore_PlayerSettingsSave::DeletePlayerSettings(const FString& SlotName)
+{
+	UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+	UGameplayStatics::DeleteGameInSlot(FMCore_SettingsJournal::GetAlternateSlotName(SlotName), 0);
+	FMCore_SettingsJournal::Delete(SlotName);
+}
+
+void UMCore_PlayerSettingsSave::ReadPersistedData(const FString& SlotName, TArray<uint8>& OutPrimary,
+	TArray<uint8>& OutAlternate, TArray<uint8>& OutJournal)
+{
+	OutPrimary.Reset();
+	OutAlternate.Reset();
 
 	if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
 	{
-		if (USaveGame* LoadedSave = UGameplayStatics::LoadGameFromSlot(SlotName, 0))
+		UGameplayStatics::LoadDataFromSlot(OutPrimary, SlotName, 0);
+	}
+
+	const FString AlternateSlotName = FMCore_SettingsJournal::GetAlternateSlotName(SlotName);
+	if (UGameplayStatics::DoesSaveGameExist(AlternateSlotName, 0))
+	{
+		UGameplayStatics::LoadDataFromSlot(OutAlternate, AlternateSlotName, 0);
+	}
+
+	FMCore_SettingsJournal::ReadFile(SlotName, OutJournal);
+}
+
+UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSave::LoadFromPersistedData(const FString& SlotName,
+	TArray<uint8>& PrimaryBytes, TArray<uint8>& AlternateBytes, const TArray<uint8>& JournalBytes,
+	bool bCompactTornJournal)
+{
+	struct FSnapshotCandidate
+	{
+		int32 Slot;
+		FMCore_SettingsSnapshotInfo Info;
+		TArray<uint8>* Bytes;
+	};
+
+	/* Verify both snapshots, then deserialize the newest one that passes */
+	TArray<FSnapshotCandidate, TInlineAllocator<2>> Candidates;
+	TArray<uint8>* SlotBytes[] = { &PrimaryBytes, &AlternateBytes };
+	for (int32 Slot = 0; Slot < UE_ARRAY_COUNT(SlotBytes); ++Slot)
+	{
+		if (SlotBytes[Slot]->IsEmpty()) { continue; }
+
+		FMCore_SettingsSnapshotInfo Info;
+		if (FMCore_SettingsJournal::UnframeSnapshot(*SlotBytes[Slot], Info) == FMCore_SettingsJournal::ESnapshotResult::Corrupt)
 		{
-			Settings = Cast<UMCore_PlayerSettingsSave>(LoadedSave);
-			if (!Settings)
-			{
-				UE_LOG(LogModulusSettings, Warning,
-					TEXT("PlayerSettingsSave::LoadPlayerSettings -- save existed in slot '%s' but cast to UMCore_PlayerSettingsSave failed"),
-					*SlotName);
-			}
-			else
-			{
-				bExistingSave = true;
-			}
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("PlayerSettingsSave::LoadPlayerSettings -- snapshot %d for slot '%s' failed verification, ignoring it"),
+				Slot, *SlotName);
+			continue;
 		}
+		Candidates.Add({ Slot, Info, SlotBytes[Slot] });
 	}
+	Candidates.Sort([](const FSnapshotCandidate& A, const FSnapshotCandidate& B)
+	{
+		return A.Info.Generation > B.Info.Generation;
+	});
 
+	UMCore_PlayerSettingsSave* Settings = nullptr;
+	FMCore_SettingsSnapshotInfo LoadedInfo;
+	int32 LoadedSlot = INDEX_NONE;
+
+	for (const FSnapshotCandidate& Candidate : Candidates)
+	{
+		Settings = Cast<UMCore_PlayerSettingsSave>(UGameplayStatics::LoadGameFromMemory(*Candidate.Bytes));
+		if (Settings)
+		{
+			LoadedInfo = Candidate.Info;
+			LoadedSlot = Candidate.Slot;
+			break;
+		}
+
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("PlayerSettingsSave::LoadPlayerSettings -- save existed in slot '%s' but cast to UMCore_PlayerSettingsSave failed"),
+			*SlotName);
+	}
+
+	const bool bExistingSave = Settings != nullptr;
 	if (!Settings)
 	{
 		Settings = Cast<UMCore_PlayerSettingsSave>(
@@ -107,58 +641,120 @@ UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSave::LoadPlayerSettings(const F
 	else
 	{
 		UE_LOG(LogModulusSettings, Log,
-			TEXT("PlayerSettingsSave::LoadPlayerSettings -- loaded existing settings from slot '%s'"),
-			*SlotName);
+			TEXT("PlayerSettingsSave::LoadPlayerSettings -- loaded existing settings from slot '%s' (generation %llu)"),
+			*SlotName, LoadedInfo.Generation);
 	}
 
 	Settings->CachedSlotName = SlotName;
-	Settings->ValidateSettings();
+	Settings->SnapshotSlot = LoadedSlot;
+	Settings->SnapshotGeneration = LoadedInfo.Generation;
+	Settings->LastJournalSequence = LoadedInfo.LastSequence;
+	Settings->JournalBaseSequence = LoadedInfo.LastSequence;
+
+	/* Replay what was committed after the snapshot; records up to its LastSequence are already in it */
+	uint64 JournalBaseSequence{0};
+	TArray<FMCore_SettingsJournalRecord> Records;
+	const FMCore_SettingsJournal::EReadResult JournalResult =
+		FMCore_SettingsJournal::ParseRecords(JournalBytes, JournalBaseSequence, Records);
+
+	int32 NumReplayed{0};
+	for (const FMCore_SettingsJournalRecord& Record : Records)
+	{
+		if (Record.Sequence <= Settings->LastJournalSequence) { continue; }
 
-	UE_LOG(LogModulusSettings, Log,
-		TEXT("PlayerSettingsSave::LoadPlayerSettings -- loaded from slot '%s' (existing=%s)"),
-		*SlotName, bExistingSave ? TEXT("true") : TEXT("false"));
-	return Settings;
-}
+		switch (Record.Type)
+		{
+		case EMCore_SettingsJournalRecordType::Float:
+			Settings->FloatSettings.Add(Record.Key, Record.FloatValue);
+			break;
+		case EMCore_SettingsJournalRecordType::Int:
+			Settings->IntSettings.Add(Record.Key, Record.IntValue);
+			break;
+		case EMCore_SettingsJournalRecordType::Bool:
+			Settings->BoolSettings.Add(Record.Key, Record.bBoolValue);
+			break;
+		case EMCore_SettingsJournalRecordType::QualityPreset:
+			Settings->LastSelectedQualityPreset = Record.IntValue;
+			Settings->bQualityPresetInitialized = true;
+			break;
+		}
+		Settings->LastJournalSequence = Record.Sequence;
+		++NumReplayed;
+	}
 
-void UMCore_PlayerSettingsSave::LoadPlayerSettingsAsync(const FString& SlotName, FOnPlayerSettingsLoaded OnLoaded)
-{
-	if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+	if (JournalResult != FMCore_SettingsJournal::EReadResult::Empty)
 	{
-		UMCore_PlayerSettingsSave* NewSettings = Cast<UMCore_PlayerSettingsSave>(
-			UGameplayStatics::CreateSaveGameObject(UMCore_PlayerSettingsSave::StaticClass()));
-		NewSettings->CachedSlotName = SlotName;
-		OnLoaded.ExecuteIfBound(NewSettings);
-		return;
+		Settings->JournalBaseSequence = JournalBaseSequence;
+		Settings->NumJournalRecords = Records.Num();
 	}
 
-	FAsyncLoadGameFromSlotDelegate AsyncLoadGameDelegate;
-	AsyncLoadGameDelegate.BindLambda([OnLoaded, SlotName](const FString& LoadedSlot, const int32 UserIndex, USaveGame* LoadedSave)
+	if (NumReplayed > 0 && JournalBaseSequence > LoadedInfo.LastSequence)
 	{
-		UMCore_PlayerSettingsSave* Settings = nullptr;
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("PlayerSettingsSave::LoadPlayerSettings -- journal for slot '%s' follows a snapshot that did not load; values saved between the two are lost"),
+			*SlotName);
+	}
 
-		if (LoadedSave)
+	Settings->ValidateSettings();
+
+	/* Appending after a torn record would hide every later one; start a clean journal now */
+	if (JournalResult == FMCore_SettingsJournal::EReadResult::TornTail)
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("PlayerSettingsSave::LoadPlayerSettings -- journal for slot '%s' was torn after %d record(s)%s"),
+			*SlotName, Records.Num(), bCompactTornJournal ? TEXT(", compacting") : TEXT(", left for the owning save"));
+		if (bCompactTornJournal)
 		{
-			Settings = Cast<UMCore_PlayerSettingsSave>(LoadedSave);
-			if (!Settings)
-			{
-				UE_LOG(LogModulusSettings, Warning,
-					TEXT("PlayerSettingsSave::LoadPlayerSettingsAsync -- save existed in slot '%s' but cast to UMCore_PlayerSettingsSave failed"),
-					*SlotName);
-			}
+			Settings->SaveSettings();
 		}
-
-		if (!Settings)
+		else
 		{
-			Settings = Cast<UMCore_PlayerSettingsSave>(
-				UGameplayStatics::CreateSaveGameObject(UMCore_PlayerSettingsSave::StaticClass()));
+			/* Never written from, but keep it from appending after the torn record if it ever is */
+			Settings->bRequiresFullSave = true;
 		}
+	}
 
-		Settings->CachedSlotName = SlotName;
-		Settings->ValidateSettings();
-		OnLoaded.ExecuteIfBound(Settings);
-	});
+	UE_LOG(LogModulusSettings, Log,
+		TEXT("PlayerSettingsSave::LoadPlayerSettings -- loaded from slot '%s' (existing=%s, %d journal value(s) replayed)"),
+		*SlotName, bExistingSave ? TEXT("true") : TEXT("false"), NumReplayed);
+	return Settings;
+}
+
+UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSave::LoadPlayerSettings(const FString& SlotName)
+{
+	TArray<uint8> PrimaryBytes;
+	TArray<uint8> AlternateBytes;
+	TArray<uint8> JournalBytes;
+	ReadPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes);
+	return LoadFromPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes);
+}
+
+UMCore_PlayerSettingsSave* UMCore_PlayerSettingsSave::ReadPlayerSettings(const FString& SlotName)
+{
+	TArray<uint8> PrimaryBytes;
+	TArray<uint8> AlternateBytes;
+	TArray<uint8> JournalBytes;
+	ReadPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes);
+	return LoadFromPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes, false);
+}
 
-	UGameplayStatics::AsyncLoadGameFromSlot(SlotName, 0, AsyncLoadGameDelegate);
+void UMCore_PlayerSettingsSave::LoadPlayerSettingsAsync(const FString& SlotName, FOnPlayerSettingsLoaded OnLoaded)
+{
+	/* File reads on a worker; verification, replay and object construction back on the game thread */
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [SlotName, OnLoaded]()
+	{
+		TArray<uint8> PrimaryBytes;
+		TArray<uint8> AlternateBytes;
+		TArray<uint8> JournalBytes;
+		ReadPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes);
+
+		AsyncTask(ENamedThreads::GameThread,
+			[SlotName, OnLoaded, PrimaryBytes = MoveTemp(PrimaryBytes), AlternateBytes = MoveTemp(AlternateBytes),
+				JournalBytes = MoveTemp(JournalBytes)]() mutable
+		{
+			OnLoaded.ExecuteIfBound(LoadFromPersistedData(SlotName, PrimaryBytes, AlternateBytes, JournalBytes));
+		});
+	});
 }
 
 // ============================================================================
@@ -205,6 +801,11 @@ void UMCore_PlayerSettingsSave::SetLastSelectedCategory(const FGameplayTag& Cate
 
 void UMCore_PlayerSettingsSave::SetLastSelectedQualityPreset(int32 NewValue)
 {
+	if (LastSelectedQualityPreset != NewValue)
+	{
+		QualityPresetVersion = AllocateSettingValueVersion();
+		bQualityPresetPendingPersist = true;
+	}
 	LastSelectedQualityPreset = NewValue;
 }
 
@@ -225,6 +826,8 @@ void UMCore_PlayerSettingsSave::ValidateSettings()
 				if (Single >= 0 && Single <= 3)
 				{
 					LastSelectedQualityPreset = Single;
+					QualityPresetVersion = AllocateSettingValueVersion();
+					bQualityPresetPendingPersist = true;
 				}
 				/* else: stays -1 (genuinely Custom or beyond exposed range) */
 			}
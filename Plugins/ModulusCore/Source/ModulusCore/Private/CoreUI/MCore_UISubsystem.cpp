@@ -7,12 +7,126 @@
 #include "CoreData/Tags/MCore_UILayerTags.h"
 #include "CoreUI/Widgets/MCore_GameMenuHub.h"
 #include "CoreUI/Widgets/MCore_PrimaryGameLayout.h"
+#include "CoreUI/Widgets/Primitives/MCore_ActivatableBase.h"
 #include "CoreData/Assets/UI/Themes/MCore_PDA_UITheme_Base.h"
+#include "CoreData/Libraries/MCore_ThemeLibrary.h"
+#include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
 #include "CoreEvents/MCore_LocalEventSubsystem.h"
 #include "CoreData/Types/Events/MCore_EventData.h"
 #include "CoreData/Tags/MCore_SettingsTags.h"
 #include "GameplayTagContainer.h"
 #include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "Blueprint/WidgetTree.h"
+#include "CommonTextBlock.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+#if !UE_BUILD_SHIPPING
+	UMCore_UISubsystem* FindFirstUISubsystem(const UWorld* World)
+	{
+		const ULocalPlayer* LocalPlayer = World ? World->GetFirstLocalPlayerFromController() : nullptr;
+		return LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_UISubsystem>() : nullptr;
+	}
+
+	/* Activation, layer position, focus target and per-widget visibility/enabled state, in tree order */
+	FString CaptureWidgetPoolState(const UMCore_UISubsystem& UISubsystem, UCommonActivatableWidget& Widget, FGameplayTag LayerTag)
+	{
+		TStringBuilder<1024> State;
+		State.Appendf(TEXT("Activated=%d Top=%d Visibility=%d Focus=%s"),
+			Widget.IsActivated() ? 1 : 0,
+			UISubsystem.GetActiveWidgetInLayer(LayerTag) == &Widget ? 1 : 0,
+			static_cast<int32>(Widget.GetVisibility()),
+			*GetNameSafe(Widget.GetDesiredFocusTarget()));
+
+		if (Widget.WidgetTree)
+		{
+			Widget.WidgetTree->ForEachWidget([&State](UWidget* Child)
+			{
+				State.Appendf(TEXT(" %s:%d:%d"), *Child->GetName(),
+					static_cast<int32>(Child->GetVisibility()), Child->GetIsEnabled() ? 1 : 0);
+			});
+		}
+		return FString(State);
+	}
+
+	FAutoConsoleCommandWithWorld CmdWidgetPoolStats(
+		TEXT("Modulus.UI.WidgetPool.Stats"),
+		TEXT("Logs the screen widget pool counters of the first local player."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const UMCore_UISubsystem* UISubsystem = FindFirstUISubsystem(World))
+			{
+				const FMCore_WidgetPoolStats Stats = UISubsystem->GetWidgetPoolStats();
+				UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::WidgetPool -- hits=%d misses=%d evictions=%d pooled=%d"),
+					Stats.Hits, Stats.Misses, Stats.Evictions, Stats.PooledInstances);
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs CmdMenuHubWarmUp(
+		TEXT("Modulus.UI.MenuHub.WarmUp"),
+		TEXT("Warms the first local player's menu hub and its pages into the widget pool. Usage: Modulus.UI.MenuHub.WarmUp [FrameBudgetMs]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UMCore_UISubsystem* UISubsystem = FindFirstUISubsystem(World))
+			{
+				UISubsystem->BeginMenuHubWarmUp(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.0f);
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs CmdWidgetPoolVerify(
+		TEXT("Modulus.UI.WidgetPool.Verify"),
+		TEXT("Opens a screen, closes it, reopens it from the widget pool and compares both opens. Usage: Modulus.UI.WidgetPool.Verify <WidgetClassPath> [LayerTag=MCore.UI.Layer.Menu]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UMCore_UISubsystem* UISubsystem = FindFirstUISubsystem(World);
+			UClass* ScreenClass = Args.Num() > 0 ? LoadClass<UCommonActivatableWidget>(nullptr, *Args[0]) : nullptr;
+			if (!UISubsystem || !ScreenClass)
+			{
+				UE_LOG(LogModulusUI, Warning,
+					TEXT("UISubsystem::WidgetPool -- Verify needs a local player and a loadable widget class path"));
+				return;
+			}
+
+			const FGameplayTag LayerTag = Args.Num() > 1
+				? FGameplayTag::RequestGameplayTag(FName(*Args[1]), false)
+				: FGameplayTag(MCore_UILayerTags::MCore_UI_Layer_Menu);
+			UISubsystem->VerifyPooledReopen(ScreenClass, LayerTag);
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs CmdWidgetTrackingStress(
+		TEXT("Modulus.UI.Tracking.Stress"),
+		TEXT("Random open/close/pop sequences on the Menu and Modal layers, checking widget tracking after every step. Usage: Modulus.UI.Tracking.Stress <WidgetClassPath> [Iterations=500] [Seed=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UMCore_UISubsystem* UISubsystem = FindFirstUISubsystem(World);
+			UClass* ScreenClass = Args.Num() > 0 ? LoadClass<UCommonActivatableWidget>(nullptr, *Args[0]) : nullptr;
+			if (!UISubsystem || !ScreenClass)
+			{
+				UE_LOG(LogModulusUI, Warning,
+					TEXT("UISubsystem::Tracking -- Stress needs a local player and a loadable widget class path"));
+				return;
+			}
+
+			const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 500;
+			const int32 Seed = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 0;
+			UISubsystem->RunWidgetTrackingStress(ScreenClass, Iterations, Seed);
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs CmdThemeRestyleBenchmark(
+		TEXT("Modulus.UI.Theme.RestyleBenchmark"),
+		TEXT("Times restyling N text blocks via per-block style resolution vs the resolved style table. Usage: Modulus.UI.Theme.RestyleBenchmark [NumTextBlocks=5000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UMCore_UISubsystem* UISubsystem = FindFirstUISubsystem(World))
+			{
+				UISubsystem->RunRestyleBenchmark(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 5000);
+			}
+		}));
+#endif
+}
 
 // ============================================================================
 // INITIALIZATION
@@ -31,11 +145,12 @@ void UMCore_UISubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	LoadWidgetClasses();
 	CreatePrimaryGameLayout();
 	
-	/* Load theming for widget creation */
+	/* Load theming for widget creation; blocking, since nothing is themed before it */
 	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
 	if (DevSettings && DevSettings->IsValidThemeIndex(DevSettings->DefaultThemeIndex))
 	{
 		SetActiveThemeByIndex(DevSettings->DefaultThemeIndex);
+		FlushPendingThemeLoad();
 		UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::Initialize -- loaded default theme from index %d"),
 			DevSettings->DefaultThemeIndex);
 	}
@@ -57,6 +172,11 @@ void UMCore_UISubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		}
 	}
 
+	if (DevSettings && DevSettings->bWarmUpMenuHub)
+	{
+		BeginMenuHubWarmUp();
+	}
+
 	/* Subscribe to local events for text size changes */
 	if (UMCore_LocalEventSubsystem* LocalEvents = GetLocalPlayer()->GetSubsystem<UMCore_LocalEventSubsystem>())
 	{
@@ -93,9 +213,28 @@ void UMCore_UISubsystem::Deinitialize()
 		PlayerControllerReadyHandle.Reset();
 	}
 	
+	CancelMenuHubWarmUp();
+	if (MenuHubTabSyncTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(MenuHubTabSyncTicker);
+		MenuHubTabSyncTicker.Reset();
+	}
+
+	/* Nothing may open into a layout that is going away */
+	CancelScreenOpenRequests([](const FPendingScreenOpen&) { return true; }, TEXT("cancelled, subsystem deinitializing"));
+	if (MenuHubClassHandle.IsValid())
+	{
+		MenuHubClassHandle->CancelHandle();
+		MenuHubClassHandle.Reset();
+	}
+
 	/* Clear layer stack map and tracked widgets */
 	LayerStackMap.Empty();
 	TrackedWidgets.Empty();
+	TrackedWidgetLayers.Empty();
+	TrackedScreenIndex.Empty();
+	DirtyTrackedLayers.Empty();
+	WidgetPool.Empty();
 
 	/* Clean up PrimaryGameLayout */
 	if (IsValid(PrimaryGameLayout))
@@ -105,8 +244,11 @@ void UMCore_UISubsystem::Deinitialize()
 	}
 	
 	RegisteredMenuScreens.Empty();
+	CancelPendingThemeLoad();
 	CachedActiveTheme = nullptr;
 	ActiveThemeIndex = INDEX_NONE;
+	UpdateThemePreloads();
+	InvalidateResolvedStyles();
 	
 	Super::Deinitialize();
 }
@@ -131,13 +273,17 @@ void UMCore_UISubsystem::LoadWidgetClasses()
 		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::LoadWidgetClasses -- using default PrimaryGameLayoutClass"));
 	}
 	
-	/* Load MenuHubClass */
+	/* Stream MenuHubClass; it is not needed until the first OpenMenuHub */
 	if (DevSettings && !DevSettings->MenuHubClass.IsNull())
 	{
-		MenuHubClass = DevSettings->MenuHubClass.LoadSynchronous();
+		MenuHubClass = DevSettings->MenuHubClass.Get();
+		if (!MenuHubClass)
+		{
+			MenuHubClassHandle = StreamableManager.RequestAsyncLoad(DevSettings->MenuHubClass.ToSoftObjectPath(),
+				FStreamableDelegate::CreateUObject(this, &ThisClass::HandleMenuHubClassLoaded));
+		}
 	}
-
-	if (!MenuHubClass)
+	else
 	{
 		UE_LOG(LogModulusUI, Error,
 			TEXT("UISubsystem::LoadWidgetClasses -- MenuHubClass is nullptr, check class exists"));
@@ -152,7 +298,36 @@ void UMCore_UISubsystem::LoadWidgetClasses()
 	
 	UE_LOG(LogModulusUI, Verbose, 
 		TEXT("UISubsystem::LoadWidgetClasses -- widget classes loaded, MenuHub: %s"),
-		MenuHubClass ? TEXT("OK") : TEXT("FAIL"));
+		MenuHubClass ? TEXT("OK") : TEXT("STREAMING"));
+}
+
+void UMCore_UISubsystem::HandleMenuHubClassLoaded()
+{
+	MenuHubClassHandle.Reset();
+	if (MenuHubClass) { return; }
+
+	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+	MenuHubClass = DevSettings ? DevSettings->MenuHubClass.Get() : nullptr;
+	if (!MenuHubClass)
+	{
+		UE_LOG(LogModulusUI, Error,
+			TEXT("UISubsystem::HandleMenuHubClassLoaded -- MenuHubClass failed to load, check class exists"));
+		MenuHubClass = UMCore_GameMenuHub::StaticClass();
+	}
+}
+
+TSubclassOf<UMCore_GameMenuHub> UMCore_UISubsystem::ResolveMenuHubClass()
+{
+	if (MenuHubClass) { return MenuHubClass; }
+
+	/* Opened before the stream finished: take the hitch rather than fail */
+	UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::ResolveMenuHubClass -- MenuHubClass still streaming, loading synchronously"));
+	if (MenuHubClassHandle.IsValid())
+	{
+		MenuHubClassHandle->WaitUntilComplete();
+	}
+	HandleMenuHubClassLoaded();
+	return MenuHubClass;
 }
 
 // ============================================================================
@@ -231,6 +406,9 @@ void UMCore_UISubsystem::OnPrimaryGameLayoutCreated_Implementation(UMCore_Primar
 void UMCore_UISubsystem::BuildLayerStackMap()
 {
 	LayerStackMap.Empty();
+
+	/* Pooled instances were pushed into the previous layout's stacks */
+	WidgetPool.Empty();
 	
 	if (!IsValid(PrimaryGameLayout))
 	{
@@ -310,22 +488,34 @@ UCommonActivatableWidget* UMCore_UISubsystem::PushWidgetToLayer(
 		return nullptr;
 	}
 	
+	/* Drop entries closed outside CloseScreen first so their OnWidgetRemoved fires before this push.
+	   Only layers that saw a tracked widget deactivate can hold any. */
+	if (DirtyTrackedLayers.Contains(LayerTag))
+	{
+		CompactTrackedWidgets(LayerTag);
+	}
+
 	UCommonActivatableWidget* NewWidget = nullptr;
 
-	if (LayerTag == MCore_UILayerTags::MCore_UI_Layer_Modal)
-	{
-		/* Modal widgets are single-use: explicit creation with PlayerController as Outer,
-		   then instance-based push so the stack does not manage the widget's lifetime. */
-		const ULocalPlayer* LocalPlayer = GetLocalPlayer();
-		APlayerController* PC = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+	const bool bPoolingEnabled = DevSettings && DevSettings->bEnableWidgetPooling;
+	const bool bModulusWidget = WidgetClass->IsChildOf(UMCore_ActivatableBase::StaticClass());
 
-		if (!PC)
+	if (CanPoolWidgetClass(WidgetClass))
+	{
+		/* Pooled widgets are owned by the subsystem and pushed as instances; the stack only displays them */
+		NewWidget = AcquirePooledWidget(WidgetClass, LayerTag);
+		if (NewWidget)
 		{
-			UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::PushWidgetToLayer -- no PlayerController for modal creation"));
-			return nullptr;
+			ThisStack->AddWidgetInstance(*NewWidget);
 		}
-
-		NewWidget = CreateWidget<UCommonActivatableWidget>(PC, WidgetClass);
+	}
+	else if (LayerTag == MCore_UILayerTags::MCore_UI_Layer_Modal || (bPoolingEnabled && bModulusWidget))
+	{
+		/* Modal widgets and widgets opted out of pooling are single-use: explicit creation with
+		   PlayerController as Outer, then instance-based push so the stack does not manage
+		   (or reuse) the widget's lifetime. */
+		NewWidget = CreateLayerWidget(WidgetClass);
 		if (NewWidget)
 		{
 			ThisStack->AddWidgetInstance(*NewWidget);
@@ -339,7 +529,7 @@ UCommonActivatableWidget* UMCore_UISubsystem::PushWidgetToLayer(
 
 	if (NewWidget)
 	{
-		TrackedWidgets.FindOrAdd(LayerTag).Add(NewWidget);
+		TrackWidget(NewWidget, LayerTag);
 		OnWidgetPushed.Broadcast(NewWidget, LayerTag);
 
 		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::PushWidgetToLayer -- pushed '%s' to layer '%s'"),
@@ -354,6 +544,20 @@ UCommonActivatableWidget* UMCore_UISubsystem::PushWidgetToLayer(
 	return NewWidget;
 }
 
+UCommonActivatableWidget* UMCore_UISubsystem::CreateLayerWidget(TSubclassOf<UCommonActivatableWidget> WidgetClass)
+{
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	APlayerController* PC = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+
+	if (!PC)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::CreateLayerWidget -- no PlayerController for widget creation"));
+		return nullptr;
+	}
+
+	return CreateWidget<UCommonActivatableWidget>(PC, WidgetClass);
+}
+
 UCommonActivatableWidget* UMCore_UISubsystem::OpenScreen(
 	TSubclassOf<UCommonActivatableWidget> ScreenClass,
 	FGameplayTag LayerTag,
@@ -368,31 +572,43 @@ UCommonActivatableWidget* UMCore_UISubsystem::OpenScreen(
 
 	if (!bAllowDuplicates)
 	{
-		CompactTrackedWidgets(LayerTag);
+		/* Newest tracked instance of exactly ScreenClass on this layer. Each miss untracks
+		   the entry it looked at, so this ends after at most one pass over the layer. */
+		const FTrackedScreenKey ScreenKey(LayerTag, ScreenClass.Get());
+		while (const TWeakObjectPtr<UCommonActivatableWidget>* Existing = TrackedScreenIndex.Find(ScreenKey))
+		{
+			const TWeakObjectPtr<UCommonActivatableWidget> Visited = *Existing;
+			UCommonActivatableWidget* Widget = Visited.Get();
+
+			// TODO: Temporary diagnostic — remove after modal lifecycle audit
+			const bool bOpen = IsWidgetOpen(Widget, LayerTag);
+			UE_LOG(LogModulusUI, Log, TEXT("OpenScreen -- Found tracked: %s IsValid=%s IsOpen=%s"),
+				*GetNameSafe(Widget),
+				Widget ? TEXT("Y") : TEXT("N"),
+				bOpen ? TEXT("Y") : TEXT("N"));
+
+			/* Covered by another screen on the stack still counts: it is open, just not on top */
+			if (bOpen)
+			{
+				return Widget;
+			}
 
-		TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
+			if (Widget)
+			{
+				/* Stale entry: tracked but no longer open */
+				UntrackWidget(Widget, LayerTag);
+			}
+			else
+			{
+				/* Garbage collected without NotifyWidgetDestroyed; drops it and reindexes the layer */
+				CompactTrackedWidgets(LayerTag);
+			}
 
-		if (Widgets)
-		{
-			for (int32 i = Widgets->Num() - 1; i >= 0; --i)
+			/* Never look at the same entry twice, even if the indices disagree */
+			const TWeakObjectPtr<UCommonActivatableWidget>* StillIndexed = TrackedScreenIndex.Find(ScreenKey);
+			if (StillIndexed && *StillIndexed == Visited)
 			{
-				TWeakObjectPtr<UCommonActivatableWidget>& Weak = (*Widgets)[i];
-
-				// TODO: Temporary diagnostic — remove after modal lifecycle audit
-				UE_LOG(LogModulusUI, Log, TEXT("OpenScreen -- Found tracked: %s IsValid=%s IsActivated=%s"),
-					*GetNameSafe(Weak.Get()),
-					Weak.IsValid() ? TEXT("Y") : TEXT("N"),
-					(Weak.IsValid() && Weak->IsActivated()) ? TEXT("Y") : TEXT("N"));
-
-				if (Weak->GetClass() == ScreenClass)
-				{
-					if (Weak->IsActivated())
-					{
-						return Weak.Get();
-					}
-					/* Stale entry: tracked but no longer activated */
-					UntrackWidget(Weak.Get(), LayerTag);
-				}
+				TrackedScreenIndex.Remove(ScreenKey);
 			}
 		}
 	}
@@ -400,27 +616,216 @@ UCommonActivatableWidget* UMCore_UISubsystem::OpenScreen(
 	return PushWidgetToLayer(ScreenClass, LayerTag);
 }
 
+int32 UMCore_UISubsystem::OpenScreenAsync(
+	TSoftClassPtr<UCommonActivatableWidget> ScreenClass,
+	FGameplayTag LayerTag,
+	const FOnScreenOpened& OnOpened,
+	TSubclassOf<UCommonActivatableWidget> PlaceholderClass,
+	bool bAllowDuplicates)
+{
+	if (ScreenClass.IsNull() || !HasPrimaryGameLayout() || !GetLayerStack(LayerTag))
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::OpenScreenAsync -- cannot open '%s' on layer '%s'"),
+			*ScreenClass.ToString(), *LayerTag.ToString());
+		OnOpened.ExecuteIfBound(nullptr);
+		return INDEX_NONE;
+	}
+
+	/* Already in memory: nothing to stream, open now */
+	if (UClass* LoadedClass = ScreenClass.Get())
+	{
+		OnOpened.ExecuteIfBound(OpenScreen(LoadedClass, LayerTag, bAllowDuplicates));
+		return INDEX_NONE;
+	}
+
+	const int32 RequestId = NextScreenOpenRequestId++;
+
+	FPendingScreenOpen& Request = PendingScreenOpens.AddDefaulted_GetRef();
+	Request.RequestId = RequestId;
+	Request.LayerTag = LayerTag;
+	Request.ScreenClass = ScreenClass;
+	Request.OnOpened = OnOpened;
+	Request.bAllowDuplicates = bAllowDuplicates;
+
+	if (PlaceholderClass)
+	{
+		/* Pushing may re-enter and grow PendingScreenOpens; do not hold Request across it */
+		UCommonActivatableWidget* Placeholder = OpenScreen(PlaceholderClass, LayerTag, true);
+		if (FPendingScreenOpen* Pending = PendingScreenOpens.FindByPredicate(
+			[RequestId](const FPendingScreenOpen& Candidate) { return Candidate.RequestId == RequestId; }))
+		{
+			Pending->Placeholder = Placeholder;
+			Pending->bHasPlaceholder = Placeholder != nullptr;
+		}
+	}
+
+	TSharedPtr<FStreamableHandle> LoadHandle = StreamableManager.RequestAsyncLoad(
+		ScreenClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::HandleScreenClassLoaded, RequestId),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	/* The delegate can run inside RequestAsyncLoad; only keep the handle if still pending */
+	if (FPendingScreenOpen* Pending = PendingScreenOpens.FindByPredicate(
+		[RequestId](const FPendingScreenOpen& Candidate) { return Candidate.RequestId == RequestId; }))
+	{
+		Pending->LoadHandle = MoveTemp(LoadHandle);
+
+		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::OpenScreenAsync -- streaming '%s' for layer '%s' (request %d)"),
+			*ScreenClass.ToString(), *LayerTag.ToString(), RequestId);
+		return RequestId;
+	}
+	return INDEX_NONE;
+}
+
+void UMCore_UISubsystem::HandleScreenClassLoaded(int32 RequestId)
+{
+	const int32 Index = PendingScreenOpens.IndexOfByPredicate(
+		[RequestId](const FPendingScreenOpen& Candidate) { return Candidate.RequestId == RequestId; });
+	if (Index == INDEX_NONE) { return; }
+
+	FPendingScreenOpen Request = MoveTemp(PendingScreenOpens[Index]);
+	PendingScreenOpens.RemoveAt(Index);
+
+	/* The player backed out of the placeholder while the class streamed */
+	if (Request.bHasPlaceholder && !IsWidgetOpen(Request.Placeholder.Get(), Request.LayerTag))
+	{
+		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::HandleScreenClassLoaded -- request %d cancelled, placeholder closed"),
+			RequestId);
+		ClosePlaceholder(Request);
+		Request.OnOpened.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	UCommonActivatableWidget* Screen = nullptr;
+	if (UClass* LoadedClass = Request.ScreenClass.Get())
+	{
+		Screen = OpenScreen(LoadedClass, Request.LayerTag, Request.bAllowDuplicates);
+	}
+	else
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::HandleScreenClassLoaded -- failed to load '%s' (request %d)"),
+			*Request.ScreenClass.ToString(), RequestId);
+	}
+
+	/* Closed after the push so the layer never shows what was underneath in between */
+	ClosePlaceholder(Request);
+	Request.OnOpened.ExecuteIfBound(Screen);
+}
+
+bool UMCore_UISubsystem::CancelOpenScreenAsync(int32 RequestId)
+{
+	return CancelScreenOpenRequests([RequestId](const FPendingScreenOpen& Request)
+	{
+		return Request.RequestId == RequestId;
+	}, TEXT("cancelled by caller")) > 0;
+}
+
+bool UMCore_UISubsystem::IsOpenScreenAsyncPending(int32 RequestId) const
+{
+	return PendingScreenOpens.ContainsByPredicate([RequestId](const FPendingScreenOpen& Request)
+	{
+		return Request.RequestId == RequestId;
+	});
+}
+
+int32 UMCore_UISubsystem::CancelScreenOpenRequests(
+	TFunctionRef<bool(const FPendingScreenOpen&)> Predicate,
+	const TCHAR* Reason)
+{
+	TArray<FPendingScreenOpen> Cancelled;
+	for (int32 Index = PendingScreenOpens.Num() - 1; Index >= 0; --Index)
+	{
+		if (Predicate(PendingScreenOpens[Index]))
+		{
+			Cancelled.Add(MoveTemp(PendingScreenOpens[Index]));
+			PendingScreenOpens.RemoveAt(Index);
+		}
+	}
+
+	/* Callbacks run after the list is consistent; they may open or cancel other screens */
+	for (FPendingScreenOpen& Request : Cancelled)
+	{
+		if (Request.LoadHandle.IsValid())
+		{
+			Request.LoadHandle->CancelHandle();
+		}
+		ClosePlaceholder(Request);
+
+		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::CancelScreenOpenRequests -- request %d for '%s' %s"),
+			Request.RequestId, *Request.ScreenClass.ToString(), Reason);
+		Request.OnOpened.ExecuteIfBound(nullptr);
+	}
+	return Cancelled.Num();
+}
+
+void UMCore_UISubsystem::ClosePlaceholder(FPendingScreenOpen& Request)
+{
+	UCommonActivatableWidget* Placeholder = Request.Placeholder.Get();
+	Request.Placeholder.Reset();
+
+	if (Placeholder && IsWidgetOpen(Placeholder, Request.LayerTag))
+	{
+		CloseScreen(Placeholder);
+	}
+}
+
+int32 UMCore_UISubsystem::ClearLayer(FGameplayTag LayerTag)
+{
+	CancelScreenOpenRequests([LayerTag](const FPendingScreenOpen& Request)
+	{
+		return Request.LayerTag == LayerTag;
+	}, TEXT("cancelled, layer cleared"));
+
+	CompactTrackedWidgets(LayerTag);
+
+	const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
+	if (!Widgets) { return 0; }
+
+	/* CloseScreen untracks; iterate a copy */
+	const TArray<TWeakObjectPtr<UCommonActivatableWidget>> ToClose = *Widgets;
+	int32 NumClosed{0};
+	for (int32 Index = ToClose.Num() - 1; Index >= 0; --Index)
+	{
+		if (UCommonActivatableWidget* Widget = ToClose[Index].Get())
+		{
+			CloseScreen(Widget);
+			++NumClosed;
+		}
+	}
+
+	UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::ClearLayer -- closed %d screen(s) on layer '%s'"),
+		NumClosed, *LayerTag.ToString());
+	return NumClosed;
+}
+
 void UMCore_UISubsystem::CloseScreen(UCommonActivatableWidget* Screen)
 {
 	if (!Screen) { return; }
 
-	bool bWasTracked{false};
-	for (auto& Pair : TrackedWidgets)
+	/* Closing an async open's placeholder cancels the open */
+	bool bClosesPlaceholder{false};
+	for (FPendingScreenOpen& Request : PendingScreenOpens)
 	{
-		const bool bFound = Pair.Value.ContainsByPredicate([Screen](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
+		if (Request.Placeholder.Get() == Screen)
 		{
-			return WeakWidget.Get() == Screen;
-		});
+			Request.Placeholder.Reset();
+			bClosesPlaceholder = true;
+		}
+	}
 
-		if (bFound)
+	if (bClosesPlaceholder)
+	{
+		CancelScreenOpenRequests([](const FPendingScreenOpen& Request)
 		{
-			UntrackWidget(Screen, Pair.Key);
-			bWasTracked = true;
-			break;
-		}
+			return Request.bHasPlaceholder && !Request.Placeholder.IsValid();
+		}, TEXT("cancelled, placeholder closed"));
 	}
 
-	if (!bWasTracked)
+	if (const FGameplayTag* TrackedLayer = TrackedWidgetLayers.Find(Screen))
+	{
+		UntrackWidget(Screen, FGameplayTag(*TrackedLayer));
+	}
+	else
 	{
 		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::CloseScreen -- widget '%s' was not tracked"),
 			*GetNameSafe(Screen));
@@ -445,15 +850,8 @@ bool UMCore_UISubsystem::RemoveWidgetFromLayer(UCommonActivatableWidget* Widget,
 {
 	if (!Widget) { return false; }
 
-	const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
-	if (!Widgets) { return false; }
-
-	const bool bFound = Widgets->ContainsByPredicate([Widget](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
-	{
-		return WeakWidget.Get() == Widget;
-	});
-
-	if (!bFound) { return false; }
+	const FGameplayTag* TrackedLayer = TrackedWidgetLayers.Find(Widget);
+	if (!TrackedLayer || *TrackedLayer != LayerTag) { return false; }
 
 	CloseScreen(Widget);
 	return true;
@@ -470,10 +868,11 @@ int32 UMCore_UISubsystem::GetWidgetCountInLayer(FGameplayTag LayerTag) const
 	const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
 	if (!Widgets) { return 0; }
 
+	const TSet<const UCommonActivatableWidget*> StackWidgets = GetStackWidgetSet(LayerTag);
 	int32 Count{0};
 	for (const TWeakObjectPtr<UCommonActivatableWidget>& Weak : *Widgets)
 	{
-		if (Weak.IsValid()) { Count++; }
+		if (IsWidgetOpen(Weak.Get(), StackWidgets)) { Count++; }
 	}
 	return Count;
 }
@@ -489,108 +888,665 @@ bool UMCore_UISubsystem::IsLayerActive(FGameplayTag LayerTag) const
 
 void UMCore_UISubsystem::CompactTrackedWidgets(FGameplayTag LayerTag)
 {
+	DirtyTrackedLayers.Remove(LayerTag);
+
 	TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
-	if (!Widgets) { return; }
+	if (!Widgets || Widgets->IsEmpty()) { return; }
+
+	/* One pass against a snapshot of the stack; per-widget UntrackWidget would rescan the layer
+	 * for every entry it drops. Pooled widgets are never destroyed, so closing one never
+	 * reaches NotifyWidgetDestroyed. */
+	const TSet<const UCommonActivatableWidget*> StackWidgets = GetStackWidgetSet(LayerTag);
+	TArray<UCommonActivatableWidget*, TInlineAllocator<4>> Closed;
+	const int32 RemovedCount = Widgets->RemoveAll(
+		[this, &StackWidgets, &Closed](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
+		{
+			UCommonActivatableWidget* Widget = WeakWidget.Get();
+			if (Widget && IsWidgetOpen(Widget, StackWidgets)) { return false; }
 
-	Widgets->RemoveAllSwap([](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
-	{
-		return !WeakWidget.IsValid();
-	});
-}
+			TrackedWidgetLayers.Remove(WeakWidget);
+			if (Widget)
+			{
+				Widget->OnDeactivated().RemoveAll(this);
+				Closed.Add(Widget);
+			}
+			return true;
+		});
+	if (RemovedCount == 0) { return; }
 
-void UMCore_UISubsystem::UntrackWidget(UCommonActivatableWidget* Widget, FGameplayTag LayerTag)
-{
-	TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag);
-	if (!Widgets) { return; }
+	/* A collected widget's class is unknown, so its index entry cannot be looked up directly */
+	RebuildTrackedScreenIndex(LayerTag);
 
-	const int32 Removed = Widgets->RemoveAllSwap([Widget](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
-	{
-		return WeakWidget.Get() == Widget;
-	});
+#if DO_GUARD_SLOW
+	ensure(VerifyWidgetTracking());
+#endif
 
-	if (Removed > 0)
+	for (UCommonActivatableWidget* Widget : Closed)
 	{
 		OnWidgetRemoved.Broadcast(Widget, LayerTag);
 	}
 }
 
-void UMCore_UISubsystem::NotifyWidgetDestroyed(UCommonActivatableWidget* Widget)
+bool UMCore_UISubsystem::IsWidgetOpen(const UCommonActivatableWidget* Widget, FGameplayTag LayerTag) const
 {
-	if (!Widget) { return; }
+	if (!IsValid(Widget)) { return false; }
+	if (Widget->IsActivated()) { return true; }
 
-	for (auto& Pair : TrackedWidgets)
-	{
-		const int32 Removed = Pair.Value.RemoveAllSwap([Widget](const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget)
-		{
-			return WeakWidget.Get() == Widget;
-		});
+	/* A screen covered by another on its stack is deactivated but still open */
+	const UCommonActivatableWidgetStack* Stack = LayerStackMap.FindRef(LayerTag);
+	return Stack && Stack->GetWidgetList().Contains(Widget);
+}
+
+bool UMCore_UISubsystem::IsWidgetOpen(const UCommonActivatableWidget* Widget,
+	const TSet<const UCommonActivatableWidget*>& StackWidgets)
+{
+	return IsValid(Widget) && (Widget->IsActivated() || StackWidgets.Contains(Widget));
+}
 
-		if (Removed > 0)
+TSet<const UCommonActivatableWidget*> UMCore_UISubsystem::GetStackWidgetSet(FGameplayTag LayerTag) const
+{
+	TSet<const UCommonActivatableWidget*> StackWidgets;
+	if (const UCommonActivatableWidgetStack* Stack = LayerStackMap.FindRef(LayerTag))
+	{
+		for (const UCommonActivatableWidget* Widget : Stack->GetWidgetList())
 		{
-			OnWidgetRemoved.Broadcast(Widget, Pair.Key);
+			StackWidgets.Add(Widget);
 		}
 	}
+	return StackWidgets;
 }
 
-// ============================================================================
-// MENU HUB
-// ============================================================================
-
-UMCore_GameMenuHub* UMCore_UISubsystem::OpenMenuHub()
+void UMCore_UISubsystem::TrackWidget(UCommonActivatableWidget* Widget, FGameplayTag LayerTag)
 {
-	if (!MenuHubClass)
+	/* A reused pooled instance must not be tracked twice */
+	if (const FGameplayTag* TrackedLayer = TrackedWidgetLayers.Find(Widget))
 	{
-		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::OpenMenuHub -- MenuHubClass not loaded"));
-		return nullptr;
+		UntrackWidget(Widget, FGameplayTag(*TrackedLayer));
 	}
 
-	UCommonActivatableWidget* Screen = OpenScreen(MenuHubClass, MCore_UILayerTags::MCore_UI_Layer_GameMenu);
-	UMCore_GameMenuHub* Hub = Cast<UMCore_GameMenuHub>(Screen);
+	TrackedWidgets.FindOrAdd(LayerTag).Add(Widget);
+	TrackedWidgetLayers.Add(Widget, LayerTag);
+	TrackedScreenIndex.Add(FTrackedScreenKey(LayerTag, Widget->GetClass()), Widget);
 
-	if (Hub)
-	{
-		Hub->RebuildTabBar();
-	}
+	/* Back actions and stack-driven removals close screens without going through CloseScreen */
+	Widget->OnDeactivated().AddUObject(this, &ThisClass::HandleTrackedWidgetDeactivated, LayerTag);
 
-	return Hub;
+#if DO_GUARD_SLOW
+	ensure(VerifyWidgetTracking());
+#endif
 }
 
-void UMCore_UISubsystem::CloseMenuHub()
+void UMCore_UISubsystem::UntrackWidget(UCommonActivatableWidget* Widget, FGameplayTag LayerTag)
 {
-	if (UMCore_GameMenuHub* Hub = FindTrackedMenuHub())
+	const FGameplayTag* TrackedLayer = TrackedWidgetLayers.Find(Widget);
+	if (!TrackedLayer || *TrackedLayer != LayerTag) { return; }
+
+	TrackedWidgetLayers.Remove(Widget);
+	Widget->OnDeactivated().RemoveAll(this);
+
+	/* Ordered removal keeps push order, which OpenScreen and ClearLayer rely on */
+	if (TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag))
 	{
-		CloseScreen(Hub);
+		Widgets->RemoveSingle(Widget);
 	}
+	RefreshTrackedScreenIndex(LayerTag, Widget->GetClass());
+
+#if DO_GUARD_SLOW
+	ensure(VerifyWidgetTracking());
+#endif
+
+	OnWidgetRemoved.Broadcast(Widget, LayerTag);
 }
 
-UMCore_GameMenuHub* UMCore_UISubsystem::FindTrackedMenuHub() const
+void UMCore_UISubsystem::RefreshTrackedScreenIndex(FGameplayTag LayerTag, const UClass* WidgetClass)
 {
-	const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets =
-		TrackedWidgets.Find(MCore_UILayerTags::MCore_UI_Layer_GameMenu);
-	if (!Widgets) { return nullptr; }
+	const FTrackedScreenKey ScreenKey(LayerTag, WidgetClass);
 
-	for (const TWeakObjectPtr<UCommonActivatableWidget>& Weak : *Widgets)
+	if (const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag))
 	{
-		if (UMCore_GameMenuHub* Hub = Cast<UMCore_GameMenuHub>(Weak.Get()))
+		for (int32 Index = Widgets->Num() - 1; Index >= 0; --Index)
 		{
-			return Hub;
+			const UCommonActivatableWidget* Widget = (*Widgets)[Index].Get();
+			if (Widget && Widget->GetClass() == WidgetClass)
+			{
+				TrackedScreenIndex.Add(ScreenKey, (*Widgets)[Index]);
+				return;
+			}
 		}
 	}
-	return nullptr;
+	TrackedScreenIndex.Remove(ScreenKey);
 }
 
-/**
- * @param TabID              Unique tag identifying this tab. Duplicates are rejected with a warning.
- * @param ScreenWidgetClass  Widget class to instantiate as the tab's page content. Must be non-null.
- * @param Priority           Sort order (lower values appear first). Default: 100.
- */
-void UMCore_UISubsystem::RegisterMenuScreen(FGameplayTag TabID,
-	TSubclassOf<UCommonActivatableWidget> ScreenWidgetClass,
-	int32 Priority, UTexture2D* TabIcon)
+void UMCore_UISubsystem::RebuildTrackedScreenIndex(FGameplayTag LayerTag)
 {
-	if (!ScreenWidgetClass)
+	for (auto It = TrackedScreenIndex.CreateIterator(); It; ++It)
 	{
-		UE_LOG(LogModulusUI, Warning, 
+		if (It.Key().Key == LayerTag) { It.RemoveCurrent(); }
+	}
+
+	/* Push order, so the newest instance of each class ends up indexed */
+	if (const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(LayerTag))
+	{
+		for (const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget : *Widgets)
+		{
+			if (const UCommonActivatableWidget* Widget = WeakWidget.Get())
+			{
+				TrackedScreenIndex.Add(FTrackedScreenKey(LayerTag, Widget->GetClass()), WeakWidget);
+			}
+		}
+	}
+}
+
+void UMCore_UISubsystem::HandleTrackedWidgetDeactivated(FGameplayTag LayerTag)
+{
+	/* The widget may still be on the stack mid-transition; the next push on the layer compacts it */
+	DirtyTrackedLayers.Add(LayerTag);
+}
+
+void UMCore_UISubsystem::NotifyWidgetDestroyed(UCommonActivatableWidget* Widget)
+{
+	if (!Widget) { return; }
+
+	if (const FGameplayTag* TrackedLayer = TrackedWidgetLayers.Find(Widget))
+	{
+		UntrackWidget(Widget, FGameplayTag(*TrackedLayer));
+	}
+}
+
+// ============================================================================
+// WIDGET POOL
+// ============================================================================
+
+bool UMCore_UISubsystem::CanPoolWidgetClass(TSubclassOf<UCommonActivatableWidget> WidgetClass) const
+{
+	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+	if (!WidgetClass || !DevSettings || !DevSettings->bEnableWidgetPooling) { return false; }
+
+	/* Only Modulus widgets have the reset hook a reused instance needs */
+	const UMCore_ActivatableBase* Defaults = Cast<UMCore_ActivatableBase>(WidgetClass->GetDefaultObject());
+	return Defaults && Defaults->bAllowPooling;
+}
+
+int32 UMCore_UISubsystem::GetWidgetPoolCap(FGameplayTag LayerTag) const
+{
+	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+	if (!DevSettings) { return 0; }
+
+	if (const int32* LayerCap = DevSettings->WidgetPoolLayerCaps.Find(LayerTag))
+	{
+		return FMath::Max(*LayerCap, 0);
+	}
+	return FMath::Max(DevSettings->MaxPooledWidgetsPerClass, 0);
+}
+
+UCommonActivatableWidget* UMCore_UISubsystem::AcquirePooledWidget(
+	TSubclassOf<UCommonActivatableWidget> WidgetClass,
+	FGameplayTag LayerTag)
+{
+	FMCore_WidgetPoolBucket& Bucket = FindOrAddPoolBucket(WidgetClass, LayerTag);
+	TrimPoolBucket(Bucket, GetWidgetPoolCap(LayerTag));
+
+	for (const FMCore_PooledWidget& Entry : Bucket.Instances)
+	{
+		if (IsPooledWidgetIdle(Entry, LayerTag))
+		{
+			++WidgetPoolStats.Hits;
+			Entry.Widget->ResetForReuse();
+
+			UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::AcquirePooledWidget -- reusing '%s' on layer '%s'"),
+				*GetNameSafe(Entry.Widget), *LayerTag.ToString());
+			return Entry.Widget;
+		}
+	}
+
+	++WidgetPoolStats.Misses;
+	return AddPooledInstance(Bucket);
+}
+
+UMCore_ActivatableBase* UMCore_UISubsystem::PrewarmPooledWidget(
+	TSubclassOf<UCommonActivatableWidget> WidgetClass,
+	FGameplayTag LayerTag)
+{
+	FMCore_WidgetPoolBucket& Bucket = FindOrAddPoolBucket(WidgetClass, LayerTag);
+	TrimPoolBucket(Bucket, GetWidgetPoolCap(LayerTag));
+
+	for (const FMCore_PooledWidget& Entry : Bucket.Instances)
+	{
+		if (IsPooledWidgetIdle(Entry, LayerTag))
+		{
+			return Entry.Widget;
+		}
+	}
+	return AddPooledInstance(Bucket);
+}
+
+FMCore_WidgetPoolBucket& UMCore_UISubsystem::FindOrAddPoolBucket(
+	TSubclassOf<UCommonActivatableWidget> WidgetClass,
+	FGameplayTag LayerTag)
+{
+	if (FMCore_WidgetPoolBucket* Bucket = WidgetPool.FindByPredicate([&WidgetClass, LayerTag](const FMCore_WidgetPoolBucket& Candidate)
+	{
+		return Candidate.WidgetClass == WidgetClass && Candidate.LayerTag == LayerTag;
+	}))
+	{
+		return *Bucket;
+	}
+
+	FMCore_WidgetPoolBucket& Bucket = WidgetPool.AddDefaulted_GetRef();
+	Bucket.LayerTag = LayerTag;
+	Bucket.WidgetClass = WidgetClass;
+	return Bucket;
+}
+
+UMCore_ActivatableBase* UMCore_UISubsystem::AddPooledInstance(FMCore_WidgetPoolBucket& Bucket)
+{
+	UMCore_ActivatableBase* NewWidget = Cast<UMCore_ActivatableBase>(CreateLayerWidget(Bucket.WidgetClass));
+	if (NewWidget)
+	{
+		FMCore_PooledWidget& Entry = Bucket.Instances.AddDefaulted_GetRef();
+		Entry.Widget = NewWidget;
+		Entry.CachedSlateWidget = NewWidget->TakeWidget();
+	}
+	return NewWidget;
+}
+
+void UMCore_UISubsystem::TrimPoolBucket(FMCore_WidgetPoolBucket& Bucket, int32 MaxIdle)
+{
+	int32 NumIdle{0};
+	WidgetPoolStats.Evictions += Bucket.Instances.RemoveAll([this, &Bucket, MaxIdle, &NumIdle](const FMCore_PooledWidget& Entry)
+	{
+		if (!IsValid(Entry.Widget)) { return true; }
+		if (!IsPooledWidgetIdle(Entry, Bucket.LayerTag)) { return false; }
+		return ++NumIdle > MaxIdle;
+	});
+}
+
+bool UMCore_UISubsystem::IsPooledWidgetIdle(const FMCore_PooledWidget& Entry, FGameplayTag LayerTag) const
+{
+	return IsValid(Entry.Widget) && !IsWidgetOpen(Entry.Widget, LayerTag);
+}
+
+FMCore_WidgetPoolStats UMCore_UISubsystem::GetWidgetPoolStats() const
+{
+	FMCore_WidgetPoolStats Stats = WidgetPoolStats;
+	Stats.PooledInstances = 0;
+	for (const FMCore_WidgetPoolBucket& Bucket : WidgetPool)
+	{
+		Stats.PooledInstances += Bucket.Instances.Num();
+	}
+	return Stats;
+}
+
+void UMCore_UISubsystem::ResetWidgetPoolStats()
+{
+	WidgetPoolStats = FMCore_WidgetPoolStats();
+}
+
+void UMCore_UISubsystem::TrimWidgetPool()
+{
+	for (FMCore_WidgetPoolBucket& Bucket : WidgetPool)
+	{
+		TrimPoolBucket(Bucket, 0);
+	}
+
+	WidgetPool.RemoveAll([](const FMCore_WidgetPoolBucket& Bucket)
+	{
+		return Bucket.Instances.IsEmpty();
+	});
+}
+
+#if !UE_BUILD_SHIPPING
+void UMCore_UISubsystem::VerifyPooledReopen(TSubclassOf<UCommonActivatableWidget> ScreenClass, FGameplayTag LayerTag)
+{
+	if (!CanPoolWidgetClass(ScreenClass))
+	{
+		UE_LOG(LogModulusUI, Warning,
+			TEXT("UISubsystem::VerifyPooledReopen -- '%s' is not poolable (pooling off, not a UMCore_ActivatableBase, or bAllowPooling cleared)"),
+			*GetNameSafe(ScreenClass));
+		return;
+	}
+
+	/* Start from a fresh instance, not one an earlier open left in the pool */
+	for (FMCore_WidgetPoolBucket& Bucket : WidgetPool)
+	{
+		if (Bucket.WidgetClass == ScreenClass && Bucket.LayerTag == LayerTag)
+		{
+			TrimPoolBucket(Bucket, 0);
+		}
+	}
+
+	UCommonActivatableWidget* FreshWidget = OpenScreen(ScreenClass, LayerTag, true);
+	if (!FreshWidget)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::VerifyPooledReopen -- could not open '%s' on layer '%s'"),
+			*GetNameSafe(ScreenClass), *LayerTag.ToString());
+		return;
+	}
+
+	const FString FreshState = CaptureWidgetPoolState(*this, *FreshWidget, LayerTag);
+	CloseScreen(FreshWidget);
+
+	/* The stack releases a closed widget once its transition finishes; reopen after that */
+	TWeakObjectPtr<UMCore_UISubsystem> WeakThis(this);
+	TWeakObjectPtr<UCommonActivatableWidget> WeakFresh(FreshWidget);
+	int32 FramesLeft{300};
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis, WeakFresh, ScreenClass, LayerTag, FreshState, FramesLeft](float) mutable -> bool
+	{
+		UMCore_UISubsystem* Self = WeakThis.Get();
+		if (!Self || !WeakFresh.IsValid())
+		{
+			UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::VerifyPooledReopen -- aborted, subsystem or widget went away"));
+			return false;
+		}
+
+		const UCommonActivatableWidgetStack* Stack = Self->LayerStackMap.FindRef(LayerTag);
+		if (Stack && Stack->GetWidgetList().Contains(WeakFresh.Get()) && --FramesLeft > 0)
+		{
+			return true;
+		}
+
+		const int32 HitsBefore = Self->WidgetPoolStats.Hits;
+		UCommonActivatableWidget* ReopenedWidget = Self->OpenScreen(ScreenClass, LayerTag, true);
+		if (!ReopenedWidget)
+		{
+			UE_LOG(LogModulusUI, Error, TEXT("UISubsystem::VerifyPooledReopen -- FAILED, reopen of '%s' returned nothing"),
+				*GetNameSafe(ScreenClass));
+			return false;
+		}
+
+		const FString ReopenedState = CaptureWidgetPoolState(*Self, *ReopenedWidget, LayerTag);
+		const bool bReused = ReopenedWidget == WeakFresh.Get() && Self->WidgetPoolStats.Hits == HitsBefore + 1;
+		Self->CloseScreen(ReopenedWidget);
+
+		if (!bReused)
+		{
+			UE_LOG(LogModulusUI, Error,
+				TEXT("UISubsystem::VerifyPooledReopen -- FAILED, '%s' was not reopened from the pool"),
+				*GetNameSafe(ScreenClass));
+		}
+		else if (ReopenedState != FreshState)
+		{
+			UE_LOG(LogModulusUI, Error,
+				TEXT("UISubsystem::VerifyPooledReopen -- FAILED, reopened '%s' differs from fresh\n  fresh:    %s\n  reopened: %s"),
+				*GetNameSafe(ScreenClass), *FreshState, *ReopenedState);
+		}
+		else
+		{
+			UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::VerifyPooledReopen -- passed for '%s' on layer '%s'"),
+				*GetNameSafe(ScreenClass), *LayerTag.ToString());
+		}
+		return false;
+	}));
+}
+
+bool UMCore_UISubsystem::VerifyWidgetTracking() const
+{
+	int32 NumTracked{0};
+	for (const auto& Pair : TrackedWidgets)
+	{
+		TSet<const UCommonActivatableWidget*> SeenOnLayer;
+		for (const TWeakObjectPtr<UCommonActivatableWidget>& WeakWidget : Pair.Value)
+		{
+			++NumTracked;
+
+			const FGameplayTag* IndexedLayer = TrackedWidgetLayers.Find(WeakWidget);
+			if (!IndexedLayer || *IndexedLayer != Pair.Key)
+			{
+				UE_LOG(LogModulusUI, Error,
+					TEXT("UISubsystem::VerifyWidgetTracking -- '%s' on layer '%s' is indexed under '%s'"),
+					*GetNameSafe(WeakWidget.Get()), *Pair.Key.ToString(),
+					IndexedLayer ? *IndexedLayer->ToString() : TEXT("nothing"));
+				return false;
+			}
+
+			const UCommonActivatableWidget* Widget = WeakWidget.Get();
+			if (!Widget) { continue; }
+
+			bool bAlreadySeen{false};
+			SeenOnLayer.Add(Widget, &bAlreadySeen);
+			if (bAlreadySeen)
+			{
+				UE_LOG(LogModulusUI, Error, TEXT("UISubsystem::VerifyWidgetTracking -- '%s' tracked twice on layer '%s'"),
+					*GetNameSafe(Widget), *Pair.Key.ToString());
+				return false;
+			}
+
+			const TWeakObjectPtr<UCommonActivatableWidget>* Newest =
+				TrackedScreenIndex.Find(FTrackedScreenKey(Pair.Key, Widget->GetClass()));
+			if (!Newest || !Newest->IsValid())
+			{
+				UE_LOG(LogModulusUI, Error,
+					TEXT("UISubsystem::VerifyWidgetTracking -- no screen index entry for '%s' on layer '%s'"),
+					*GetNameSafe(Widget), *Pair.Key.ToString());
+				return false;
+			}
+		}
+	}
+
+	if (NumTracked != TrackedWidgetLayers.Num())
+	{
+		UE_LOG(LogModulusUI, Error,
+			TEXT("UISubsystem::VerifyWidgetTracking -- %d tracked entries but %d widget->layer entries"),
+			NumTracked, TrackedWidgetLayers.Num());
+		return false;
+	}
+
+	/* The newest instance of each class on a layer is the one OpenScreen must find */
+	for (const auto& Pair : TrackedScreenIndex)
+	{
+		const UCommonActivatableWidget* Indexed = Pair.Value.Get();
+		const UClass* IndexedClass = Pair.Key.Value.ResolveObjectPtr();
+		const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets = TrackedWidgets.Find(Pair.Key.Key);
+		const int32 NewestIndex = Widgets ? Widgets->FindLastByPredicate(
+			[IndexedClass](const TWeakObjectPtr<UCommonActivatableWidget>& Candidate)
+			{
+				return Candidate.IsValid() && Candidate->GetClass() == IndexedClass;
+			}) : INDEX_NONE;
+
+		if (!Indexed || NewestIndex == INDEX_NONE || (*Widgets)[NewestIndex].Get() != Indexed)
+		{
+			UE_LOG(LogModulusUI, Error,
+				TEXT("UISubsystem::VerifyWidgetTracking -- screen index for '%s' on layer '%s' holds '%s', not the newest tracked instance"),
+				*GetNameSafe(IndexedClass), *Pair.Key.Key.ToString(), *GetNameSafe(Indexed));
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UMCore_UISubsystem::RunWidgetTrackingStress(TSubclassOf<UCommonActivatableWidget> ScreenClass,
+	int32 Iterations, int32 Seed)
+{
+	if (!ScreenClass || !HasPrimaryGameLayout())
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::RunWidgetTrackingStress -- needs a screen class and a PrimaryGameLayout"));
+		return false;
+	}
+
+	const FGameplayTag Layers[] = { MCore_UILayerTags::MCore_UI_Layer_Menu, MCore_UILayerTags::MCore_UI_Layer_Modal };
+	const TCHAR* OpNames[] = { TEXT("open"), TEXT("open duplicate"), TEXT("close"), TEXT("pop"), TEXT("deactivate") };
+
+	FRandomStream Random(Seed);
+	TArray<TWeakObjectPtr<UCommonActivatableWidget>> Opened;
+	int32 StepsRun{0};
+	bool bPassed = VerifyWidgetTracking();
+
+	for (; bPassed && StepsRun < Iterations; ++StepsRun)
+	{
+		const FGameplayTag LayerTag = Layers[Random.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(Layers)) - 1)];
+		const int32 Op = Random.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(OpNames)) - 1);
+
+		Opened.RemoveAll([](const TWeakObjectPtr<UCommonActivatableWidget>& Weak) { return !Weak.IsValid(); });
+		UCommonActivatableWidget* Target = Opened.IsEmpty() ? nullptr : Opened[Random.RandRange(0, Opened.Num() - 1)].Get();
+
+		switch (Op)
+		{
+		case 0:
+		case 1:
+			if (UCommonActivatableWidget* Widget = OpenScreen(ScreenClass, LayerTag, Op == 1))
+			{
+				Opened.AddUnique(Widget);
+			}
+			break;
+
+		case 2:
+			if (Target) { CloseScreen(Target); }
+			break;
+
+		case 3:
+			/* Only pop what this run opened */
+			if (Opened.Contains(GetActiveWidgetInLayer(LayerTag))) { PopLayer(LayerTag); }
+			break;
+
+		case 4:
+			/* Closed behind the subsystem's back, as a Back action does; compaction must catch it */
+			if (Target) { Target->DeactivateWidget(); }
+			break;
+		}
+
+		bPassed = VerifyWidgetTracking();
+		if (!bPassed)
+		{
+			UE_LOG(LogModulusUI, Error, TEXT("UISubsystem::RunWidgetTrackingStress -- FAILED at step %d (%s on '%s'), seed %d"),
+				StepsRun, OpNames[Op], *LayerTag.ToString(), Seed);
+		}
+	}
+
+	for (const TWeakObjectPtr<UCommonActivatableWidget>& Weak : Opened)
+	{
+		if (UCommonActivatableWidget* Widget = Weak.Get())
+		{
+			if (TrackedWidgetLayers.Contains(Widget)) { CloseScreen(Widget); }
+		}
+	}
+	bPassed = bPassed && VerifyWidgetTracking();
+
+	if (bPassed)
+	{
+		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::RunWidgetTrackingStress -- passed %d steps with '%s', seed %d"),
+			StepsRun, *GetNameSafe(ScreenClass), Seed);
+	}
+	return bPassed;
+}
+
+void UMCore_UISubsystem::RunRestyleBenchmark(int32 NumTextBlocks)
+{
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	if (!CachedActiveTheme || !LocalPlayer || NumTextBlocks <= 0)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::RunRestyleBenchmark -- needs an active theme and a positive block count"));
+		return;
+	}
+
+	TArray<TObjectPtr<UCommonTextBlock>> TextBlocks;
+	TextBlocks.Reserve(NumTextBlocks);
+	for (int32 Index = 0; Index < NumTextBlocks; ++Index)
+	{
+		TextBlocks.Add(NewObject<UCommonTextBlock>(GetTransientPackage()));
+	}
+
+	constexpr int32 NumRoles = static_cast<int32>(EMCore_ThemeTextRole::MAX);
+
+	/* Before: the pre-table path, which reads the text size setting for every block */
+	double StartSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumTextBlocks; ++Index)
+	{
+		UMCore_ThemeLibrary::ApplyTextStyleFromSettings(LocalPlayer, TextBlocks[Index],
+			CachedActiveTheme->GetTextStyles(static_cast<EMCore_ThemeTextRole>(Index % NumRoles)));
+	}
+	const double PerBlockMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	/* One table rebuild, as after a theme or text size change */
+	StartSeconds = FPlatformTime::Seconds();
+	InvalidateResolvedStyles();
+	GetResolvedStyles();
+	const double RebuildMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	/* After: a table lookup per block */
+	StartSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumTextBlocks; ++Index)
+	{
+		UMCore_ThemeLibrary::ApplyThemeTextStyle(LocalPlayer, TextBlocks[Index], CachedActiveTheme,
+			static_cast<EMCore_ThemeTextRole>(Index % NumRoles));
+	}
+	const double TableMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	for (UCommonTextBlock* TextBlock : TextBlocks)
+	{
+		TextBlock->MarkAsGarbage();
+	}
+
+	UE_LOG(LogModulusUI, Log,
+		TEXT("UISubsystem::RunRestyleBenchmark -- %d text blocks: per-block resolve %.3f ms, table rebuild %.3f ms, table lookup %.3f ms (%.2fx)"),
+		NumTextBlocks, PerBlockMs, RebuildMs, TableMs, TableMs > 0.0 ? PerBlockMs / TableMs : 0.0);
+}
+#endif
+
+// ============================================================================
+// MENU HUB
+// ============================================================================
+
+UMCore_GameMenuHub* UMCore_UISubsystem::OpenMenuHub()
+{
+	/* Whatever the warm-up built stays pooled; EnsureTabBarBuilt finishes the rest */
+	CancelMenuHubWarmUp();
+
+	const TSubclassOf<UMCore_GameMenuHub> HubClass = ResolveMenuHubClass();
+	if (!HubClass)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::OpenMenuHub -- MenuHubClass not loaded"));
+		return nullptr;
+	}
+
+	UCommonActivatableWidget* Screen = OpenScreen(HubClass, MCore_UILayerTags::MCore_UI_Layer_GameMenu);
+	UMCore_GameMenuHub* Hub = Cast<UMCore_GameMenuHub>(Screen);
+
+	if (Hub)
+	{
+		Hub->EnsureTabBarBuilt();
+	}
+
+	return Hub;
+}
+
+void UMCore_UISubsystem::CloseMenuHub()
+{
+	if (UMCore_GameMenuHub* Hub = FindTrackedMenuHub())
+	{
+		CloseScreen(Hub);
+	}
+}
+
+UMCore_GameMenuHub* UMCore_UISubsystem::FindTrackedMenuHub() const
+{
+	const TArray<TWeakObjectPtr<UCommonActivatableWidget>>* Widgets =
+		TrackedWidgets.Find(MCore_UILayerTags::MCore_UI_Layer_GameMenu);
+	if (!Widgets) { return nullptr; }
+
+	for (const TWeakObjectPtr<UCommonActivatableWidget>& Weak : *Widgets)
+	{
+		if (UMCore_GameMenuHub* Hub = Cast<UMCore_GameMenuHub>(Weak.Get()))
+		{
+			return Hub;
+		}
+	}
+	return nullptr;
+}
+
+/**
+ * @param TabID              Unique tag identifying this tab. Duplicates are rejected with a warning.
+ * @param ScreenWidgetClass  Widget class to instantiate as the tab's page content. Must be non-null.
+ * @param Priority           Sort order (lower values appear first). Default: 100.
+ */
+void UMCore_UISubsystem::RegisterMenuScreen(FGameplayTag TabID,
+	TSubclassOf<UCommonActivatableWidget> ScreenWidgetClass,
+	int32 Priority, UTexture2D* TabIcon)
+{
+	if (!ScreenWidgetClass)
+	{
+		UE_LOG(LogModulusUI, Warning, 
 			TEXT("UISubsystem::RegisterMenuScreen -- invalid ScreenClass provided"));
 		return;
 	}
@@ -636,11 +1592,7 @@ void UMCore_UISubsystem::RegisterMenuScreen(FGameplayTag TabID,
 		TEXT("UISubsystem::RegisterMenuScreen -- %s registered at priority %d (Total: %d)"),
 		*NewTab.GetDisplayName().ToString(), Priority, RegisteredMenuScreens.Num());
 
-	/* If MenuHub is active, rebuild tab bar */
-	if (UMCore_GameMenuHub* Hub = FindTrackedMenuHub())
-	{
-		Hub->RebuildTabBar();
-	}
+	QueueMenuHubTabSync();
 }
 
 bool UMCore_UISubsystem::UnregisterMenuScreen(FGameplayTag TabID)
@@ -663,10 +1615,7 @@ bool UMCore_UISubsystem::UnregisterMenuScreen(FGameplayTag TabID)
 			TEXT("UISubsystem::UnregisterMenuScreen -- '%s' unregistered (Remaining: %d)"),
 			*TabID.ToString(), RegisteredMenuScreens.Num());
 
-		if (UMCore_GameMenuHub* Hub = FindTrackedMenuHub())
-		{
-			Hub->RebuildTabBar();
-		}
+		QueueMenuHubTabSync();
 		return true;
 	}
 
@@ -684,6 +1633,127 @@ void UMCore_UISubsystem::RebuildMenuHubTabBar()
 	}
 }
 
+void UMCore_UISubsystem::QueueMenuHubTabSync()
+{
+	/* A closed hub syncs itself in OpenMenuHub */
+	if (MenuHubTabSyncTicker.IsValid() || !FindTrackedMenuHub()) { return; }
+
+	MenuHubTabSyncTicker = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::FlushMenuHubTabSync));
+}
+
+bool UMCore_UISubsystem::FlushMenuHubTabSync(float DeltaTime)
+{
+	MenuHubTabSyncTicker.Reset();
+
+	if (UMCore_GameMenuHub* Hub = FindTrackedMenuHub())
+	{
+		Hub->SyncTabsWithRegisteredScreens();
+	}
+	return false;
+}
+
+bool UMCore_UISubsystem::BeginMenuHubWarmUp(float FrameBudgetMs)
+{
+	const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+	if (!DevSettings || !DevSettings->bEnableWidgetPooling || GetWidgetPoolCap(MCore_UILayerTags::MCore_UI_Layer_GameMenu) <= 0)
+	{
+		UE_LOG(LogModulusUI, Warning,
+			TEXT("UISubsystem::BeginMenuHubWarmUp -- widget pooling is off for the GameMenu layer, nothing could be kept warm"));
+		return false;
+	}
+
+	const float BudgetMs = FrameBudgetMs > 0.0f ? FrameBudgetMs : DevSettings->MenuHubWarmUpBudgetMs;
+	MenuHubWarmUpBudgetSeconds = FMath::Max(BudgetMs, 0.1f) / 1000.0;
+
+	/* A running warm-up just takes the new budget */
+	if (IsMenuHubWarmUpInProgress()) { return true; }
+
+	MenuHubWarmUpProgress = 0.0f;
+	WarmMenuHub.Reset();
+	MenuHubWarmUpTicker = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::TickMenuHubWarmUp));
+
+	UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::BeginMenuHubWarmUp -- warming menu hub at %.2f ms per frame"), BudgetMs);
+	return true;
+}
+
+void UMCore_UISubsystem::CancelMenuHubWarmUp()
+{
+	if (!MenuHubWarmUpTicker.IsValid()) { return; }
+
+	FTSTicker::GetCoreTicker().RemoveTicker(MenuHubWarmUpTicker);
+	MenuHubWarmUpTicker.Reset();
+	WarmMenuHub.Reset();
+
+	UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::CancelMenuHubWarmUp -- stopped at %.0f%%"), MenuHubWarmUpProgress * 100.0f);
+}
+
+bool UMCore_UISubsystem::TickMenuHubWarmUp(float DeltaTime)
+{
+	/* The hub class may still be streaming, and widgets need a PlayerController to own them */
+	if (!MenuHubClass && MenuHubClassHandle.IsValid() && MenuHubClassHandle->IsLoadingInProgress()) { return true; }
+
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	if (!LocalPlayer || !LocalPlayer->GetPlayerController(GetWorld())) { return true; }
+
+	UMCore_GameMenuHub* Hub = WarmMenuHub.Get();
+	if (!Hub)
+	{
+		if (FindTrackedMenuHub())
+		{
+			MenuHubWarmUpProgress = 1.0f;
+			FinishMenuHubWarmUp(TEXT("hub already open"));
+			return false;
+		}
+
+		const TSubclassOf<UMCore_GameMenuHub> HubClass = ResolveMenuHubClass();
+		if (!CanPoolWidgetClass(HubClass))
+		{
+			UE_LOG(LogModulusUI, Warning,
+				TEXT("UISubsystem::TickMenuHubWarmUp -- '%s' cannot be pooled (bAllowPooling cleared?)"), *GetNameSafe(HubClass));
+			FinishMenuHubWarmUp(TEXT("failed"));
+			return false;
+		}
+
+		Hub = Cast<UMCore_GameMenuHub>(PrewarmPooledWidget(HubClass, MCore_UILayerTags::MCore_UI_Layer_GameMenu));
+		if (!Hub)
+		{
+			FinishMenuHubWarmUp(TEXT("failed"));
+			return false;
+		}
+		WarmMenuHub = Hub;
+
+		/* Constructing the hub is this frame's slice; pages start next frame */
+		MenuHubWarmUpProgress = 1.0f / (1.0f + FMath::Max(Hub->GetNumTabsPlanned(), GetRegisteredMenuScreens().Num()));
+		OnMenuHubWarmUpProgress.Broadcast(MenuHubWarmUpProgress, false);
+		return true;
+	}
+
+	const bool bDone = Hub->WarmUpTabs(MenuHubWarmUpBudgetSeconds);
+	MenuHubWarmUpProgress = bDone ? 1.0f
+		: static_cast<float>(1 + Hub->GetNumTabsBuilt()) / static_cast<float>(1 + Hub->GetNumTabsPlanned());
+
+	if (bDone)
+	{
+		FinishMenuHubWarmUp(TEXT("done"));
+		return false;
+	}
+
+	OnMenuHubWarmUpProgress.Broadcast(MenuHubWarmUpProgress, false);
+	return true;
+}
+
+void UMCore_UISubsystem::FinishMenuHubWarmUp(const TCHAR* Outcome)
+{
+	MenuHubWarmUpTicker.Reset();
+	WarmMenuHub.Reset();
+
+	UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::TickMenuHubWarmUp -- menu hub warm-up %s (%.0f%%)"),
+		Outcome, MenuHubWarmUpProgress * 100.0f);
+	OnMenuHubWarmUpProgress.Broadcast(MenuHubWarmUpProgress, true);
+}
+
 // ============================================================================
 // THEME
 // ============================================================================
@@ -709,7 +1779,14 @@ bool UMCore_UISubsystem::SetActiveThemeByIndex(int32 ThemeIndex)
 		return false;
 	}
 
-	if (ThemeIndex == ActiveThemeIndex) { return true; }
+	if (ThemeIndex == ActiveThemeIndex)
+	{
+		/* Switched back before the pending theme arrived */
+		CancelPendingThemeLoad();
+		return true;
+	}
+
+	if (ThemeIndex == PendingThemeIndex) { return true; }
 
 	const FMCore_ThemeEntry& ThemeEntry = Settings->AvailableThemes[ThemeIndex];
 	if (ThemeEntry.ThemeAsset.IsNull())
@@ -718,24 +1795,224 @@ bool UMCore_UISubsystem::SetActiveThemeByIndex(int32 ThemeIndex)
 		return false;
 	}
 
-	CachedActiveTheme = ThemeEntry.ThemeAsset.LoadSynchronous();
+	CancelPendingThemeLoad();
+
+	/* Preloaded themes are already resident: switch this frame. One still preloading is
+	 * picked up by the request below, which joins the in-flight load. */
+	const TSharedPtr<FStreamableHandle>* PreloadHandle = ThemePreloadHandles.Find(ThemeIndex);
+	const bool bPreloadInFlight = PreloadHandle && PreloadHandle->IsValid() && (*PreloadHandle)->IsLoadingInProgress();
+	if (UMCore_PDA_UITheme_Base* ResidentTheme = bPreloadInFlight ? nullptr : ThemeEntry.ThemeAsset.Get())
+	{
+		ApplyLoadedTheme(ThemeIndex, ResidentTheme);
+		return true;
+	}
+
+	/* The current theme stays applied until the new one and its fonts and brushes are in */
+	PendingThemeIndex = ThemeIndex;
+	TSharedPtr<FStreamableHandle> LoadHandle = StreamableManager.RequestAsyncLoad(
+		ThemeEntry.ThemeAsset.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::HandleThemeLoaded, ThemeIndex),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	/* The delegate can run inside RequestAsyncLoad; only keep the handle if still pending */
+	if (PendingThemeIndex == ThemeIndex)
+	{
+		PendingThemeHandle = MoveTemp(LoadHandle);
+
+		UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::SetActiveThemeByIndex -- streaming theme '%s' (index %d)"),
+			*ThemeEntry.DisplayName.ToString(), ThemeIndex);
+	}
+	return true;
+}
+
+void UMCore_UISubsystem::HandleThemeLoaded(int32 ThemeIndex)
+{
+	/* Superseded by a newer request, or cancelled */
+	if (ThemeIndex != PendingThemeIndex) { return; }
+
+	PendingThemeIndex = INDEX_NONE;
+	const TSharedPtr<FStreamableHandle> LoadHandle = MoveTemp(PendingThemeHandle);
+
+	const UMCore_CoreSettings* Settings = UMCore_CoreSettings::Get();
+	UMCore_PDA_UITheme_Base* LoadedTheme = Settings && Settings->IsValidThemeIndex(ThemeIndex)
+		? Settings->AvailableThemes[ThemeIndex].ThemeAsset.Get()
+		: nullptr;
+
+	if (!LoadedTheme)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("UISubsystem::HandleThemeLoaded -- theme at index %d failed to load, keeping '%s'"),
+			ThemeIndex, *GetNameSafe(CachedActiveTheme));
+		return;
+	}
+
+	ApplyLoadedTheme(ThemeIndex, LoadedTheme);
+
+	/* CachedActiveTheme holds the theme from here on */
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->ReleaseHandle();
+	}
+}
+
+void UMCore_UISubsystem::ApplyLoadedTheme(int32 ThemeIndex, UMCore_PDA_UITheme_Base* Theme)
+{
+	CachedActiveTheme = Theme;
 	ActiveThemeIndex = ThemeIndex;
+	InvalidateResolvedStyles();
 	OnThemeChanged.Broadcast(CachedActiveTheme);
 
-	UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::SetActiveThemeByIndex -- theme changed to '%s' (index %d)"),
-		*ThemeEntry.DisplayName.ToString(), ThemeIndex);
+	const UMCore_CoreSettings* Settings = UMCore_CoreSettings::Get();
+	UE_LOG(LogModulusUI, Log, TEXT("UISubsystem::ApplyLoadedTheme -- theme changed to '%s' (index %d)"),
+		Settings ? *Settings->AvailableThemes[ThemeIndex].DisplayName.ToString() : *GetNameSafe(Theme), ThemeIndex);
 
-	return true;
+	UpdateThemePreloads();
+}
+
+void UMCore_UISubsystem::FlushPendingThemeLoad()
+{
+	const int32 ThemeIndex = PendingThemeIndex;
+	if (ThemeIndex == INDEX_NONE) { return; }
+
+	if (PendingThemeHandle.IsValid())
+	{
+		PendingThemeHandle->WaitUntilComplete();
+	}
+
+	/* No-op if waiting already ran the completion delegate */
+	HandleThemeLoaded(ThemeIndex);
+}
+
+void UMCore_UISubsystem::CancelPendingThemeLoad()
+{
+	if (PendingThemeHandle.IsValid())
+	{
+		PendingThemeHandle->CancelHandle();
+		PendingThemeHandle.Reset();
+	}
+	PendingThemeIndex = INDEX_NONE;
+}
+
+void UMCore_UISubsystem::UpdateThemePreloads()
+{
+	const UMCore_CoreSettings* Settings = UMCore_CoreSettings::Get();
+
+	TArray<int32, TInlineAllocator<2>> WantedIndices;
+	if (Settings && Settings->bPreloadAdjacentThemes && Settings->IsValidThemeIndex(ActiveThemeIndex))
+	{
+		const int32 NumThemes = Settings->AvailableThemes.Num();
+		for (const int32 Offset : { -1, 1 })
+		{
+			const int32 Index = (ActiveThemeIndex + Offset + NumThemes) % NumThemes;
+			if (Index != ActiveThemeIndex && !Settings->AvailableThemes[Index].ThemeAsset.IsNull())
+			{
+				WantedIndices.AddUnique(Index);
+			}
+		}
+	}
+
+	/* Dropping the handle lets GC reclaim themes that are neither active nor adjacent */
+	for (auto It = ThemePreloadHandles.CreateIterator(); It; ++It)
+	{
+		if (WantedIndices.Contains(It.Key())) { continue; }
+
+		if (const TSharedPtr<FStreamableHandle>& Handle = It.Value())
+		{
+			if (Handle->IsLoadingInProgress()) { Handle->CancelHandle(); }
+			else { Handle->ReleaseHandle(); }
+		}
+		It.RemoveCurrent();
+	}
+
+	for (const int32 Index : WantedIndices)
+	{
+		if (ThemePreloadHandles.Contains(Index)) { continue; }
+
+		ThemePreloadHandles.Add(Index, StreamableManager.RequestAsyncLoad(
+			Settings->AvailableThemes[Index].ThemeAsset.ToSoftObjectPath(),
+			FStreamableDelegate(),
+			FStreamableManager::DefaultAsyncLoadPriority));
+
+		UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::UpdateThemePreloads -- preloading theme index %d"), Index);
+	}
 }
 
 void UMCore_UISubsystem::NotifyTextSizeChanged()
 {
+	InvalidateResolvedStyles();
 	if (CachedActiveTheme)
 	{
 		OnThemeChanged.Broadcast(CachedActiveTheme);
 	}
 }
 
+TSubclassOf<UCommonTextStyle> UMCore_UISubsystem::GetResolvedTextStyle(EMCore_ThemeTextRole Role) const
+{
+	if (Role >= EMCore_ThemeTextRole::MAX) { return nullptr; }
+	return GetResolvedStyles().TextStyles[static_cast<int32>(Role)];
+}
+
+int32 UMCore_UISubsystem::GetResolvedTextSizeIndex() const
+{
+	const FMCore_ResolvedThemeStyles& Styles = GetResolvedStyles();
+	return Styles.IsResolved() ? Styles.TextSizeIndex : ReadTextSizeIndex();
+}
+
+const FSliderStyle* UMCore_UISubsystem::GetResolvedSliderStyle() const
+{
+	const FMCore_ResolvedThemeStyles& Styles = GetResolvedStyles();
+	return Styles.SliderStyle.GetPtrOrNull();
+}
+
+const FMCore_ResolvedThemeStyles& UMCore_UISubsystem::GetResolvedStyles() const
+{
+	if (ResolvedStyles.IsResolved() && ResolvedStyles.Theme == CachedActiveTheme)
+	{
+		return ResolvedStyles;
+	}
+
+	ResolvedStyles = FMCore_ResolvedThemeStyles();
+	if (!CachedActiveTheme) { return ResolvedStyles; }
+
+	ResolvedStyles.Theme = CachedActiveTheme;
+	ResolvedStyles.TextSizeIndex = ReadTextSizeIndex();
+
+	/* Same index fallback as ApplyTextStyleFromTheme: out-of-range sizes use the first entry */
+	for (int32 RoleIndex = 0; RoleIndex < static_cast<int32>(EMCore_ThemeTextRole::MAX); ++RoleIndex)
+	{
+		const TArray<TSubclassOf<UCommonTextStyle>>& Styles =
+			CachedActiveTheme->GetTextStyles(static_cast<EMCore_ThemeTextRole>(RoleIndex));
+		if (Styles.IsEmpty()) { continue; }
+
+		ResolvedStyles.TextStyles[RoleIndex] = Styles.IsValidIndex(ResolvedStyles.TextSizeIndex)
+			? Styles[ResolvedStyles.TextSizeIndex]
+			: Styles[0];
+	}
+
+	/* BuildSliderStyle replaces every brush and the bar thickness, so the base style does not matter */
+	if (CachedActiveTheme->SliderStyle)
+	{
+		ResolvedStyles.SliderStyle = UMCore_ThemeLibrary::BuildSliderStyle(
+			CachedActiveTheme->SliderStyle, FSliderStyle::GetDefault());
+	}
+
+	UE_LOG(LogModulusUI, Verbose, TEXT("UISubsystem::GetResolvedStyles -- resolved '%s' at text size index %d"),
+		*CachedActiveTheme->GetName(), ResolvedStyles.TextSizeIndex);
+	return ResolvedStyles;
+}
+
+void UMCore_UISubsystem::InvalidateResolvedStyles()
+{
+	ResolvedStyles = FMCore_ResolvedThemeStyles();
+}
+
+int32 UMCore_UISubsystem::ReadTextSizeIndex() const
+{
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	const UMCore_PlayerSettingsSubsystem* SettingsSubsystem =
+		LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>() : nullptr;
+	return SettingsSubsystem ? SettingsSubsystem->GetActiveTextSizeIndex() : 0;
+}
+
 void UMCore_UISubsystem::HandleLocalEvent(const FMCore_EventData& EventData)
 {
 	// TODO: Replace with tag-filtered subscription on LocalEventSubsystem once Event System Phase 2
@@ -748,5 +2025,17 @@ void UMCore_UISubsystem::HandleLocalEvent(const FMCore_EventData& EventData)
 	if (EventData.EventTag == MCore_SettingsTags::MCore_Settings_Accessibility_UITextSize)
 	{
 		NotifyTextSizeChanged();
+		return;
+	}
+
+	/* Batched commits, undo and scalability restores skip the per-tag event; only restyle
+	 * if the size the table was resolved for is actually stale */
+	if (EventData.EventTag == MCore_SettingsTags::MCore_Settings_Event_SettingsChanged
+		|| EventData.EventTag == MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange)
+	{
+		if (ResolvedStyles.IsResolved() && ResolvedStyles.TextSizeIndex != ReadTextSizeIndex())
+		{
+			NotifyTextSizeChanged();
+		}
 	}
 }
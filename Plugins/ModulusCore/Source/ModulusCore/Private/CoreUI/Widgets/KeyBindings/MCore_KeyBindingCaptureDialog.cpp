@@ -15,6 +15,9 @@ UMCore_KeyBindingCaptureDialog::UMCore_KeyBindingCaptureDialog(const FObjectInit
 	: Super(ObjectInitializer)
 {
 	bShouldFocusOnActivation = true;
+
+	/* Bound to the row being captured and mid-capture input state; always a fresh instance */
+	bAllowPooling = false;
 }
 
 // ============================================================================
@@ -133,14 +136,14 @@ void UMCore_KeyBindingCaptureDialog::ApplyTheme_Implementation(UMCore_PDA_UIThem
 
 	ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
 
-	UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-		LocalPlayer, Txt_ActionName, NewTheme->HeadingTextStyle);
+	UMCore_ThemeLibrary::ApplyThemeTextStyle(
+		LocalPlayer, Txt_ActionName, NewTheme, EMCore_ThemeTextRole::Heading);
 
-	UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-		LocalPlayer, Txt_SlotContext, NewTheme->LabelTextStyle);
+	UMCore_ThemeLibrary::ApplyThemeTextStyle(
+		LocalPlayer, Txt_SlotContext, NewTheme, EMCore_ThemeTextRole::Label);
 
-	UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-		LocalPlayer, Txt_PromptOrError, NewTheme->DescriptionTextStyle);
+	UMCore_ThemeLibrary::ApplyThemeTextStyle(
+		LocalPlayer, Txt_PromptOrError, NewTheme, EMCore_ThemeTextRole::Description);
 
 	K2_OnThemeApplied(NewTheme);
 }
@@ -0,0 +1,112 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingListView.h"
+
+#include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingRow.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsListView.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsSectionHeader.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Logging/LogModulusUI.h"
+
+#include "InputAction.h"
+
+// ============================================================================
+// ROWS
+// ============================================================================
+
+void UMCore_KeyBindingListView::ResetRows()
+{
+	Rows.Reset();
+	NumActionRows = 0;
+}
+
+void UMCore_KeyBindingListView::AddCategory(const FText& CategoryDisplayName,
+	TConstArrayView<UInputAction*> Actions)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (CoreSettings && CoreSettings->SettingsSectionHeaderWidgetClass && !CategoryDisplayName.IsEmpty())
+	{
+		UMCore_SettingsListItem* Header = NewObject<UMCore_SettingsListItem>(this);
+		Header->SectionName = CategoryDisplayName;
+		Rows.Add(Header);
+	}
+
+	for (UInputAction* Action : Actions)
+	{
+		if (!Action) { continue; }
+
+		UMCore_KeyBindingListItem* Row = NewObject<UMCore_KeyBindingListItem>(this);
+		Row->Action = Action;
+		Rows.Add(Row);
+		++NumActionRows;
+	}
+}
+
+void UMCore_KeyBindingListView::CommitRows()
+{
+	TArray<UObject*> Items;
+	Items.Reserve(Rows.Num());
+	for (UObject* Row : Rows)
+	{
+		Items.Add(Row);
+	}
+	SetListItems(Items);
+}
+
+TArray<UMCore_KeyBindingRow*> UMCore_KeyBindingListView::GetDisplayedRows() const
+{
+	TArray<UMCore_KeyBindingRow*> DisplayedRows;
+	for (UUserWidget* Entry : GetDisplayedEntryWidgets())
+	{
+		if (UMCore_KeyBindingRow* Row = Cast<UMCore_KeyBindingRow>(Entry))
+		{
+			DisplayedRows.Add(Row);
+		}
+	}
+	return DisplayedRows;
+}
+
+// ============================================================================
+// ENTRY GENERATION
+// ============================================================================
+
+TSubclassOf<UMCore_KeyBindingListView> UMCore_KeyBindingListView::GetConfiguredClass()
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings || !CoreSettings->bVirtualizeSettingsLists) { return nullptr; }
+
+	/* Same constraint as UMCore_SettingsListView: the base list needs a default entry class */
+	const TSubclassOf<UMCore_KeyBindingListView> ListClass = CoreSettings->KeyBindingListViewClass;
+	if (!ListClass || !ListClass.GetDefaultObject()->GetEntryWidgetClass())
+	{
+		static bool bWarned = false;
+		if (!bWarned)
+		{
+			bWarned = true;
+			UE_LOG(LogModulusUI, Warning,
+				TEXT("KeyBindingListView::GetConfiguredClass -- bVirtualizeSettingsLists is on but KeyBindingListViewClass is unset or has no EntryWidgetClass, building scroll box pages"));
+		}
+		return nullptr;
+	}
+	return ListClass;
+}
+
+UUserWidget& UMCore_KeyBindingListView::OnGenerateEntryWidgetInternal(UObject* Item,
+	TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	TSubclassOf<UUserWidget> EntryClass = RowClass ? TSubclassOf<UUserWidget>(RowClass) : DesiredEntryClass;
+
+	if (Item && Item->IsA<UMCore_SettingsListItem>())
+	{
+		/* Headers are only created when this class is set */
+		EntryClass = UMCore_CoreSettings::Get()->SettingsSectionHeaderWidgetClass;
+	}
+
+	return GenerateTypedEntry(EntryClass, OwnerTable);
+}
+
+bool UMCore_KeyBindingListView::OnIsSelectableOrNavigableInternal(UObject* FirstSelectedItem)
+{
+	return FirstSelectedItem && FirstSelectedItem->IsA<UMCore_KeyBindingListItem>()
+		&& Super::OnIsSelectableOrNavigableInternal(FirstSelectedItem);
+}
@@ -5,6 +5,7 @@
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingRow.h"
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingButton.h"
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingCaptureDialog.h"
+#include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingListView.h"
 #include "CoreUI/Widgets/Primitives/MCore_TabbedContainer.h"
 #include "CoreUI/Widgets/Primitives/MCore_ButtonBase.h"
 #include "CoreUI/Widgets/Primitives/MCore_ConfirmationDialog.h"
@@ -19,6 +20,8 @@
 
 #include "CommonTextBlock.h"
 #include "EnhancedInputSubsystems.h"
+#include "UserSettings/EnhancedInputUserSettings.h"
+#include "Blueprint/WidgetTree.h"
 #include "Components/ScrollBox.h"
 #include "InputMappingContext.h"
 #include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
@@ -82,6 +85,13 @@ void UMCore_KeyBindingPanel_Base::NativeOnInitialized()
 void UMCore_KeyBindingPanel_Base::NativeDestruct()
 {
 	UnbindThemeDelegate();
+	UnbindUserSettingsDelegate();
+
+	if (ChangedRowRefreshTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ChangedRowRefreshTicker);
+		ChangedRowRefreshTicker.Reset();
+	}
 
 	if (TabbedContainer_Bindings)
 	{
@@ -97,18 +107,9 @@ void UMCore_KeyBindingPanel_Base::NativeDestruct()
 		Btn_ResetCategory->OnButtonClicked.RemoveAll(this);
 	}
 
-	for (UMCore_KeyBindingRow* Row : AllRows)
-	{
-		if (Row)
-		{
-			Row->OnRowRebindCompleted.RemoveAll(this);
-			Row->OnRowCaptureStateChanged.RemoveAll(this);
-			Row->OnRowRebindResult.RemoveAll(this);
-		}
-	}
-	AllRows.Reset();
-
+	UnregisterAllRows();
 	SpawnedHeaders.Reset();
+	BindingSignatures.Reset();
 
 	DismissActiveCaptureDialog();
 	DismissActiveConfirmationDialog();
@@ -157,24 +158,20 @@ void UMCore_KeyBindingPanel_Base::PopulateBindings(APlayerController* OwningPlay
        return;
     }
 
+    /* Never block on a context asset; the panel populates once they are streamed in */
+    if (RequestContextLoad(OwningPlayer)) { return; }
+
     /* Dismiss any active dialogs before rebuilding */
     DismissActiveCaptureDialog();
     DismissActiveConfirmationDialog();
 
     /* Clear previous state */
     TabbedContainer_Bindings->ClearAllTabs();
-    for (UMCore_KeyBindingRow* Row : AllRows)
-    {
-       if (Row)
-       {
-          Row->OnRowRebindCompleted.RemoveAll(this);
-          Row->OnRowCaptureStateChanged.RemoveAll(this);
-          Row->OnRowRebindResult.RemoveAll(this);
-       }
-    }
-    AllRows.Reset();
+    UnregisterAllRows();
     SpawnedHeaders.Reset();
 
+    BindUserSettingsDelegate(OwningPlayer);
+
     const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
     FName FirstTabID{NAME_None};
     int32 ContextCount{0};
@@ -193,7 +190,7 @@ void UMCore_KeyBindingPanel_Base::PopulateBindings(APlayerController* OwningPlay
              {
                 for (const FMCore_KeyBindingContext& Context : CoreSettings->KeyBindingContexts)
                 {
-                   if (UInputMappingContext* IMC = Context.MappingContext.LoadSynchronous())
+                   if (UInputMappingContext* IMC = Context.MappingContext.Get())
                    {
                       UserSettings->RegisterInputMappingContext(IMC);
                    }
@@ -205,11 +202,11 @@ void UMCore_KeyBindingPanel_Base::PopulateBindings(APlayerController* OwningPlay
        /* Tabbed mode: one tab per configured InputMappingContext */
        for (const FMCore_KeyBindingContext& Context : CoreSettings->KeyBindingContexts)
        {
-          UInputMappingContext* IMC = Context.MappingContext.LoadSynchronous();
+          UInputMappingContext* IMC = Context.MappingContext.Get();
           if (!IMC) { continue; }
 
-          UScrollBox* Page = BuildContextPage(OwningPlayer, IMC);
-          if (!Page || Page->GetChildrenCount() == 0) { continue; }
+          UWidget* Page = BuildContextPage(OwningPlayer, IMC);
+          if (!Page) { continue; }
 
           const FName TabID = FName(*IMC->GetName());
           if (TabbedContainer_Bindings->AddTab(TabID, Page))
@@ -231,8 +228,8 @@ void UMCore_KeyBindingPanel_Base::PopulateBindings(APlayerController* OwningPlay
     else
     {
        /* Fallback: single flat page using GetAllRemappableActions */
-       UScrollBox* Page = BuildFallbackPage(OwningPlayer);
-       if (Page && Page->GetChildrenCount() > 0)
+       UWidget* Page = BuildFallbackPage(OwningPlayer);
+       if (Page)
        {
           const FName TabID{TEXT("AllBindings")};
           TabbedContainer_Bindings->AddTab(TabID, Page);
@@ -246,9 +243,19 @@ void UMCore_KeyBindingPanel_Base::PopulateBindings(APlayerController* OwningPlay
        TabbedContainer_Bindings->SelectTab(FirstTabID);
     }
 
+    /* Baseline for RefreshChangedRows: every row was just built from these bindings */
+    CaptureBindingSignatures(BindingSignatures);
+
+    /* Virtualized pages have no rows until the list lays out, so count their items */
+    int32 RowCount = AllRows.Num();
+    for (const UMCore_KeyBindingListView* ListPage : ListPages)
+    {
+       RowCount += ListPage->GetNumActionRows();
+    }
+
     UE_LOG(LogModulusUI, Log,
-       TEXT("KeyBindingPanel_Base::PopulateBindings -- populated %d binding rows across %d context tabs [%s]"),
-       AllRows.Num(), ContextCount, *GetNameSafe(this));
+       TEXT("KeyBindingPanel_Base::PopulateBindings -- populated %d binding rows across %d context tabs%s [%s]"),
+       RowCount, ContextCount, ListPages.IsEmpty() ? TEXT("") : TEXT(" (virtualized)"), *GetNameSafe(this));
 }
 
 void UMCore_KeyBindingPanel_Base::RefreshAllRows()
@@ -257,13 +264,45 @@ void UMCore_KeyBindingPanel_Base::RefreshAllRows()
 	{
 		if (Row) { Row->RefreshDisplay(); }
 	}
+	CaptureBindingSignatures(BindingSignatures);
+}
+
+int32 UMCore_KeyBindingPanel_Base::RefreshChangedRows()
+{
+	TMap<TObjectPtr<const UInputAction>, uint32> Signatures;
+	CaptureBindingSignatures(Signatures);
+
+	/* AllRows only holds live widgets; in virtualized pages that is the entry pool, and
+	 * rows out of view re-read their keys when the list binds them again */
+	int32 RefreshedCount{0};
+	for (UMCore_KeyBindingRow* Row : AllRows)
+	{
+		const UInputAction* Action = Row ? Row->GetInputAction() : nullptr;
+		if (!Action) { continue; }
+
+		const uint32* Previous = BindingSignatures.Find(Action);
+		const uint32* Current = Signatures.Find(Action);
+		const bool bChanged = (Previous && Current) ? (*Previous != *Current) : (Previous != Current);
+		if (bChanged)
+		{
+			Row->RefreshDisplay();
+			++RefreshedCount;
+		}
+	}
+
+	BindingSignatures = MoveTemp(Signatures);
+
+	UE_LOG(LogModulusUI, Verbose,
+		TEXT("KeyBindingPanel_Base::RefreshChangedRows -- refreshed %d of %d rows [%s]"),
+		RefreshedCount, AllRows.Num(), *GetNameSafe(this));
+	return RefreshedCount;
 }
 
 // ============================================================================
 // PANEL BUILD
 // ============================================================================
 
-UScrollBox* UMCore_KeyBindingPanel_Base::BuildContextPage(APlayerController* OwningPlayer,
+UWidget* UMCore_KeyBindingPanel_Base::BuildContextPage(APlayerController* OwningPlayer,
 	const UInputMappingContext* MappingContext)
 {
 	TArray<FPlayerKeyMapping> AllMappings =
@@ -304,54 +343,10 @@ UScrollBox* UMCore_KeyBindingPanel_Base::BuildContextPage(APlayerController* Own
 		SortedCategories.AddUnique(Category.ToString());
 	}
 
-    const bool bShowSecondary = UMCore_CoreSettings::Get()
-       ? UMCore_CoreSettings::Get()->bShowSecondaryBindings
-       : false;
-
-    UScrollBox* ScrollBox = NewObject<UScrollBox>(this);
-
-    for (const FString& CategoryKey : SortedCategories)
-    {
-       const FText CategoryDisplayName = FText::FromString(CategoryKey);
-
-       UCommonTextBlock* Header = CreateThemedCategoryHeader(CategoryDisplayName);
-       if (Header)
-       {
-          ScrollBox->AddChild(Header);
-          OnCategoryHeaderCreated(CategoryDisplayName, Header);
-       }
-
-       for (const FPlayerKeyMapping* Mapping : CategorizedActions[CategoryKey])
-       {
-          UMCore_KeyBindingRow* Row = CreateWidget<UMCore_KeyBindingRow>(
-             this, KeyBindingRowClass);
-          if (!Row) { continue; }
-
-          const UInputAction* Action = Mapping->GetAssociatedInputAction();
-          if (!Action)
-          {
-             UE_LOG(LogModulusUI, Warning,
-                TEXT("KeyBindingPanel_Base::BuildContextPage -- mapping '%s' has no associated InputAction [%s]"),
-                *Mapping->GetMappingName().ToString(), *GetNameSafe(this));
-             continue;
-          }
-
-          Row->InitFromAction(OwningPlayer, const_cast<UInputAction*>(Action), bShowSecondary);
-          Row->OnRowRebindCompleted.AddDynamic(this, &ThisClass::HandleRowRebindCompleted);
-          Row->OnRowCaptureStateChanged.AddDynamic(this, &ThisClass::HandleRowCaptureStateChanged);
-          Row->OnRowRebindResult.AddDynamic(this, &ThisClass::HandleRowRebindResult);
-
-          ScrollBox->AddChild(Row);
-          AllRows.Add(Row);
-
-          OnRowCreated(Row);
-       }
-    }
-
-    return ScrollBox;	
+    return BuildBindingPage(OwningPlayer, SortedCategories, CategorizedActions);
 }
 
-UScrollBox* UMCore_KeyBindingPanel_Base::BuildFallbackPage(APlayerController* OwningPlayer)
+UWidget* UMCore_KeyBindingPanel_Base::BuildFallbackPage(APlayerController* OwningPlayer)
 {
 	TArray<FPlayerKeyMapping> AllMappings =
 		UMCore_InputDisplayLibrary::GetAllRemappableActions(OwningPlayer);
@@ -389,16 +384,58 @@ UScrollBox* UMCore_KeyBindingPanel_Base::BuildFallbackPage(APlayerController* Ow
 	CategorizedActions.GetKeys(SortedCategories);
 	SortedCategories.Sort();
 
-	const bool bShowSecondary = UMCore_CoreSettings::Get()
-		? UMCore_CoreSettings::Get()->bShowSecondaryBindings
-		: false;
+	return BuildBindingPage(OwningPlayer, SortedCategories, CategorizedActions);
+}
+
+UWidget* UMCore_KeyBindingPanel_Base::BuildBindingPage(APlayerController* OwningPlayer,
+	const TArray<FString>& SortedCategories,
+	const TMap<FString, TArray<const FPlayerKeyMapping*>>& CategorizedActions)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	const bool bShowSecondary = CoreSettings ? CoreSettings->bShowSecondaryBindings : false;
+
+	UMCore_KeyBindingListView* ListView = nullptr;
+	UScrollBox* ScrollBox = nullptr;
 
-	UScrollBox* ScrollBox = NewObject<UScrollBox>(this);
+	const TSubclassOf<UMCore_KeyBindingListView> ListViewClass = UMCore_KeyBindingListView::GetConfiguredClass();
+	if (ListViewClass && WidgetTree)
+	{
+		/* Constructed in the widget tree so pooled rows resolve the owning player */
+		ListView = WidgetTree->ConstructWidget<UMCore_KeyBindingListView>(ListViewClass);
+		ListView->SetRowClass(KeyBindingRowClass);
+		ListView->OnEntryWidgetGenerated().AddUObject(this, &ThisClass::HandleListEntryGenerated);
+		ListView->ResetRows();
+	}
+	else
+	{
+		ScrollBox = NewObject<UScrollBox>(this);
+	}
 
+	TArray<UInputAction*> Actions;
 	for (const FString& CategoryKey : SortedCategories)
 	{
 		const FText CategoryDisplayName = FText::FromString(CategoryKey);
 
+		Actions.Reset();
+		for (const FPlayerKeyMapping* Mapping : CategorizedActions[CategoryKey])
+		{
+			const UInputAction* Action = Mapping->GetAssociatedInputAction();
+			if (!Action)
+			{
+				UE_LOG(LogModulusUI, Warning,
+					TEXT("KeyBindingPanel_Base::BuildBindingPage -- mapping '%s' has no associated InputAction [%s]"),
+					*Mapping->GetMappingName().ToString(), *GetNameSafe(this));
+				continue;
+			}
+			Actions.Add(const_cast<UInputAction*>(Action));
+		}
+
+		if (ListView)
+		{
+			ListView->AddCategory(CategoryDisplayName, Actions);
+			continue;
+		}
+
 		UCommonTextBlock* Header = CreateThemedCategoryHeader(CategoryDisplayName);
 		if (Header)
 		{
@@ -406,34 +443,31 @@ UScrollBox* UMCore_KeyBindingPanel_Base::BuildFallbackPage(APlayerController* Ow
 			OnCategoryHeaderCreated(CategoryDisplayName, Header);
 		}
 
-		for (const FPlayerKeyMapping* Mapping : CategorizedActions[CategoryKey])
+		for (UInputAction* Action : Actions)
 		{
 			UMCore_KeyBindingRow* Row = CreateWidget<UMCore_KeyBindingRow>(
 				this, KeyBindingRowClass);
 			if (!Row) { continue; }
 
-			const UInputAction* Action = Mapping->GetAssociatedInputAction();
-			if (!Action)
-			{
-				UE_LOG(LogModulusUI, Warning,
-					TEXT("KeyBindingPanel_Base::BuildFallbackPage -- mapping '%s' has no associated InputAction [%s]"),
-					*Mapping->GetMappingName().ToString(), *GetNameSafe(this));
-				continue;
-			}
-
-			Row->InitFromAction(OwningPlayer, const_cast<UInputAction*>(Action), bShowSecondary);
-			Row->OnRowRebindCompleted.AddDynamic(this, &ThisClass::HandleRowRebindCompleted);
-			Row->OnRowCaptureStateChanged.AddDynamic(this, &ThisClass::HandleRowCaptureStateChanged);
-			Row->OnRowRebindResult.AddDynamic(this, &ThisClass::HandleRowRebindResult);
-
+			Row->InitFromAction(OwningPlayer, Action, bShowSecondary);
 			ScrollBox->AddChild(Row);
-			AllRows.Add(Row);
+			RegisterRow(Row);
+		}
+	}
 
-			OnRowCreated(Row);
+	if (ListView)
+	{
+		ListView->CommitRows();
+		if (ListView->GetNumActionRows() == 0)
+		{
+			ListView->OnEntryWidgetGenerated().RemoveAll(this);
+			return nullptr;
 		}
+		ListPages.Add(ListView);
+		return ListView;
 	}
 
-	return ScrollBox;
+	return ScrollBox->GetChildrenCount() > 0 ? ScrollBox : nullptr;
 }
 
 UCommonTextBlock* UMCore_KeyBindingPanel_Base::CreateThemedCategoryHeader(
@@ -447,13 +481,94 @@ UCommonTextBlock* UMCore_KeyBindingPanel_Base::CreateThemedCategoryHeader(
 
 		if (CachedTheme.IsValid())
 		{
-			UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-				GetOwningLocalPlayer(), Header, CachedTheme->HeadingTextStyle);
+			UMCore_ThemeLibrary::ApplyThemeTextStyle(
+				GetOwningLocalPlayer(), Header, CachedTheme.Get(), EMCore_ThemeTextRole::Heading);
 		}
 	}
 	return Header;
 }
 
+bool UMCore_KeyBindingPanel_Base::RequestContextLoad(APlayerController* OwningPlayer)
+{
+	/* One attempt per panel: a context that failed to load is skipped, not retried forever */
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings) { return false; }
+	if (bContextLoadRequested)
+	{
+		return ContextLoadHandle.IsValid() && ContextLoadHandle->IsLoadingInProgress();
+	}
+
+	TArray<FSoftObjectPath> PendingPaths;
+	for (const FMCore_KeyBindingContext& Context : CoreSettings->KeyBindingContexts)
+	{
+		if (!Context.MappingContext.IsNull() && !Context.MappingContext.Get())
+		{
+			PendingPaths.Add(Context.MappingContext.ToSoftObjectPath());
+		}
+	}
+	if (PendingPaths.IsEmpty()) { return false; }
+
+	UE_LOG(LogModulusUI, Log,
+		TEXT("KeyBindingPanel_Base::RequestContextLoad -- streaming %d input mapping contexts [%s]"),
+		PendingPaths.Num(), *GetNameSafe(this));
+
+	/* Set first: the delegate can run inside RequestAsyncLoad and repopulate straight away */
+	bContextLoadRequested = true;
+	ContextLoadHandle = StreamableManager.RequestAsyncLoad(MoveTemp(PendingPaths),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::HandleContextsLoaded,
+			TWeakObjectPtr<APlayerController>(OwningPlayer)));
+	return ContextLoadHandle.IsValid();
+}
+
+void UMCore_KeyBindingPanel_Base::HandleContextsLoaded(TWeakObjectPtr<APlayerController> WeakOwningPlayer)
+{
+	if (APlayerController* OwningPlayer = WeakOwningPlayer.Get())
+	{
+		PopulateBindings(OwningPlayer);
+	}
+}
+
+void UMCore_KeyBindingPanel_Base::RegisterRow(UMCore_KeyBindingRow* Row)
+{
+	Row->OnRowRebindCompleted.AddDynamic(this, &ThisClass::HandleRowRebindCompleted);
+	Row->OnRowCaptureStateChanged.AddDynamic(this, &ThisClass::HandleRowCaptureStateChanged);
+	Row->OnRowRebindResult.AddDynamic(this, &ThisClass::HandleRowRebindResult);
+	AllRows.Add(Row);
+
+	OnRowCreated(Row);
+}
+
+void UMCore_KeyBindingPanel_Base::UnregisterAllRows()
+{
+	for (UMCore_KeyBindingRow* Row : AllRows)
+	{
+		if (Row)
+		{
+			Row->OnRowRebindCompleted.RemoveAll(this);
+			Row->OnRowCaptureStateChanged.RemoveAll(this);
+			Row->OnRowRebindResult.RemoveAll(this);
+		}
+	}
+	AllRows.Reset();
+
+	for (UMCore_KeyBindingListView* ListPage : ListPages)
+	{
+		if (ListPage) { ListPage->OnEntryWidgetGenerated().RemoveAll(this); }
+	}
+	ListPages.Reset();
+}
+
+void UMCore_KeyBindingPanel_Base::HandleListEntryGenerated(UUserWidget& EntryWidget)
+{
+	/* Recycled rows are generated again on reuse; they are already registered. The set is
+	 * bounded by the list's entry pool, which hands back the same widgets as it scrolls. */
+	UMCore_KeyBindingRow* Row = Cast<UMCore_KeyBindingRow>(&EntryWidget);
+	if (Row && !AllRows.Contains(Row))
+	{
+		RegisterRow(Row);
+	}
+}
+
 // ============================================================================
 // TAB CALLBACKS
 // ============================================================================
@@ -485,7 +600,7 @@ void UMCore_KeyBindingPanel_Base::HandleResetAllClicked()
 	{
 		/** No dialog configured, reset directly as safety net */
 		UMCore_InputDisplayLibrary::ResetAllBindingsToDefault(GetOwningPlayer());
-		RefreshAllRows();
+		QueueChangedRowRefresh();
 		return;
 	}
 
@@ -522,7 +637,7 @@ void UMCore_KeyBindingPanel_Base::HandleResetAllConfirmResult(bool bConfirmed)
 	if (bConfirmed)
 	{
 		UMCore_InputDisplayLibrary::ResetAllBindingsToDefault(GetOwningPlayer());
-		RefreshAllRows();
+		QueueChangedRowRefresh();
 	}
 }
 
@@ -539,7 +654,8 @@ void UMCore_KeyBindingPanel_Base::HandleResetCategoryClicked()
 
 	for (const FMCore_KeyBindingContext& Context : CoreSettings->KeyBindingContexts)
 	{
-		UInputMappingContext* IMC = Context.MappingContext.LoadSynchronous();
+		/* Tabs only exist for contexts PopulateBindings found resident */
+		UInputMappingContext* IMC = Context.MappingContext.Get();
 		if (IMC && FName(*IMC->GetName()) == ActiveContextTabID)
 		{
 			ActiveIMC = IMC;
@@ -569,7 +685,7 @@ void UMCore_KeyBindingPanel_Base::HandleResetCategoryClicked()
 	{
 		/** No dialog configured, reset directly as safety net */
 		UMCore_InputDisplayLibrary::ResetBindingsForContext(GetOwningPlayer(), ActiveIMC);
-		RefreshAllRows();
+		QueueChangedRowRefresh();
 		return;
 	}
 	
@@ -611,7 +727,7 @@ void UMCore_KeyBindingPanel_Base::HandleResetCategoryConfirmResult(bool bConfirm
 		{
 			for (const FMCore_KeyBindingContext& Context : CoreSettings->KeyBindingContexts)
 			{
-				UInputMappingContext* IMC = Context.MappingContext.LoadSynchronous();
+				UInputMappingContext* IMC = Context.MappingContext.Get();
 				if (IMC && FName(*IMC->GetName()) == ActiveContextTabID)
 				{
 					UMCore_InputDisplayLibrary::ResetBindingsForContext(GetOwningPlayer(), IMC);
@@ -619,13 +735,15 @@ void UMCore_KeyBindingPanel_Base::HandleResetCategoryConfirmResult(bool bConfirm
 				}
 			}
 		}
-		RefreshAllRows();
+		QueueChangedRowRefresh();
 	}
 }
 
 void UMCore_KeyBindingPanel_Base::HandleRowRebindCompleted()
 {
-	RefreshAllRows();
+	/* A rebind can also move a key off another action, so diff every row rather than
+	 * refreshing them all. The settings notification usually queued this already. */
+	QueueChangedRowRefresh();
 }
 
 void UMCore_KeyBindingPanel_Base::HandleRowCaptureStateChanged(
@@ -744,6 +862,77 @@ void UMCore_KeyBindingPanel_Base::HandleCaptureDialogReadyForCapture()
 	}
 }
 
+// ============================================================================
+// BINDING CHANGES
+// ============================================================================
+
+void UMCore_KeyBindingPanel_Base::BindUserSettingsDelegate(APlayerController* OwningPlayer)
+{
+	UnbindUserSettingsDelegate();
+
+	const ULocalPlayer* LocalPlayer = OwningPlayer ? OwningPlayer->GetLocalPlayer() : nullptr;
+	const UEnhancedInputLocalPlayerSubsystem* EISubsystem = LocalPlayer
+		? LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>()
+		: nullptr;
+	UEnhancedInputUserSettings* UserSettings = EISubsystem ? EISubsystem->GetUserSettings() : nullptr;
+	if (!UserSettings) { return; }
+
+	UserSettings->OnSettingsChanged.AddDynamic(this, &ThisClass::HandleInputUserSettingsChanged);
+	BoundUserSettings = UserSettings;
+}
+
+void UMCore_KeyBindingPanel_Base::UnbindUserSettingsDelegate()
+{
+	if (BoundUserSettings.IsValid())
+	{
+		BoundUserSettings->OnSettingsChanged.RemoveAll(this);
+	}
+	BoundUserSettings.Reset();
+}
+
+void UMCore_KeyBindingPanel_Base::HandleInputUserSettingsChanged(UEnhancedInputUserSettings* Settings)
+{
+	QueueChangedRowRefresh();
+}
+
+void UMCore_KeyBindingPanel_Base::QueueChangedRowRefresh()
+{
+	if (ChangedRowRefreshTicker.IsValid()) { return; }
+
+	ChangedRowRefreshTicker = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::FlushChangedRowRefresh));
+}
+
+bool UMCore_KeyBindingPanel_Base::FlushChangedRowRefresh(float DeltaTime)
+{
+	ChangedRowRefreshTicker.Reset();
+	RefreshChangedRows();
+	return false;
+}
+
+void UMCore_KeyBindingPanel_Base::CaptureBindingSignatures(
+	TMap<TObjectPtr<const UInputAction>, uint32>& OutSignatures) const
+{
+	OutSignatures.Reset();
+
+	const UEnhancedPlayerMappableKeyProfile* Profile =
+		UMCore_InputDisplayLibrary::GetActiveKeyProfile(GetOwningPlayer());
+	if (!Profile) { return; }
+
+	for (const TPair<FName, FKeyMappingRow>& Pair : Profile->GetPlayerMappingRows())
+	{
+		for (const FPlayerKeyMapping& Mapping : Pair.Value.Mappings)
+		{
+			const UInputAction* Action = Mapping.GetAssociatedInputAction();
+			if (!Action) { continue; }
+
+			/* Summed so set iteration order does not matter */
+			OutSignatures.FindOrAdd(Action) += HashCombine(
+				GetTypeHash(Mapping.GetCurrentKey()), static_cast<uint32>(Mapping.GetSlot()));
+		}
+	}
+}
+
 // ============================================================================
 // THEME
 // ============================================================================
@@ -756,8 +945,8 @@ void UMCore_KeyBindingPanel_Base::ApplyTheme_Implementation(UMCore_PDA_UITheme_B
 	{
 		if (Header)
 		{
-			UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-				GetOwningLocalPlayer(), Header, NewTheme->HeadingTextStyle);
+			UMCore_ThemeLibrary::ApplyThemeTextStyle(
+				GetOwningLocalPlayer(), Header, NewTheme, EMCore_ThemeTextRole::Heading);
 		}
 	}
 
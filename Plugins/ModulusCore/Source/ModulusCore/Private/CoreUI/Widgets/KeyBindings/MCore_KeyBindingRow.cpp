@@ -3,6 +3,8 @@
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingRow.h"
 
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingButton.h"
+#include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingListView.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
 #include "CoreData/Libraries/MCore_InputDisplayLibrary.h"
 #include "CoreData/Logging/LogModulusUI.h"
 
@@ -65,6 +67,24 @@ void UMCore_KeyBindingRow::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UMCore_KeyBindingRow::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	const UMCore_KeyBindingListItem* Item = Cast<UMCore_KeyBindingListItem>(ListItemObject);
+	if (!Item || !Item->Action) { return; }
+
+	/* A pooled row coming back to the action it already shows only needs fresh keys */
+	if (Item->Action == BoundAction && PlayerRef.IsValid())
+	{
+		RefreshDisplay();
+		return;
+	}
+
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	InitFromAction(GetOwningPlayer(), Item->Action, CoreSettings && CoreSettings->bShowSecondaryBindings);
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
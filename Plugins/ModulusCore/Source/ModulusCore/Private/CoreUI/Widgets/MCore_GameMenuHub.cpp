@@ -4,12 +4,53 @@
 
 #include "CoreUI/MCore_UISubsystem.h"
 #include "CoreUI/Widgets/Primitives/MCore_TabbedContainer.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
 #include "CoreData/Logging/LogModulusUI.h"
+#include "CoreData/Logging/StatModulusUI.h"
 #include "CoreData/Types/UI/MCore_MenuTabTypes.h"
 
 #include "GameplayTagContainer.h"
 #include "CommonButtonBase.h"
 #include "CommonAnimatedSwitcher.h"
+#include "Components/SizeBox.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+    /* Same tab and same page class; a re-registration with another class needs a new page */
+    bool IsSameMenuTab(const FMCore_MenuTab& A, const FMCore_MenuTab& B)
+    {
+        return A.TabID == B.TabID && A.ScreenWidgetClass == B.ScreenWidgetClass;
+    }
+
+    /* UObject footprint of a widget and everything it outers (child widgets, widget tree, slots) */
+    int64 EstimateWidgetBytes(UWidget& Widget)
+    {
+        int64 Bytes = Widget.GetClass()->GetStructureSize() + Widget.GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        ForEachObjectWithOuter(&Widget, [&Bytes](UObject* Inner)
+        {
+            Bytes += Inner->GetClass()->GetStructureSize() + Inner->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        }, true);
+        return Bytes;
+    }
+
+#if !UE_BUILD_SHIPPING
+    FAutoConsoleCommand CmdMenuHubPageStats(
+        TEXT("Modulus.UI.MenuHub.PageStats"),
+        TEXT("Logs live and placeholder tab page counts and approximate page memory of every menu hub instance."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            for (TObjectIterator<UMCore_GameMenuHub> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+            {
+                const FMCore_MenuPageStats Stats = It->GetPageStats();
+                UE_LOG(LogModulusUI, Log, TEXT("GameMenuHub::PageStats -- %s: live=%d placeholders=%d bytes=%lld"),
+                    *It->GetName(), Stats.LivePages, Stats.PlaceholderPages, Stats.LivePageBytes);
+            }
+        }));
+#endif
+}
 
 UMCore_GameMenuHub::UMCore_GameMenuHub(const FObjectInitializer& ObjectInitializer)
   : Super(ObjectInitializer)
@@ -23,47 +64,178 @@ void UMCore_GameMenuHub::NativeOnInitialized()
     if (TabbedContainer)
     {
         TabbedContainer->OnTabAdded.AddDynamic(this, &ThisClass::HandleContainerTabAdded);
+        TabbedContainer->OnTabSelecting.AddUObject(this, &ThisClass::HandleContainerTabSelecting);
+        TabbedContainer->OnTabSelected.AddDynamic(this, &ThisClass::HandleContainerTabSelected);
     }
 }
 
+void UMCore_GameMenuHub::NativeOnDeactivated()
+{
+    StopAdjacentPrefetch();
+
+    Super::NativeOnDeactivated();
+}
+
 void UMCore_GameMenuHub::NativeDestruct()
 {
+    StopAdjacentPrefetch();
+
     if (TabbedContainer)
     {
         TabbedContainer->OnTabAdded.RemoveAll(this);
+        TabbedContainer->OnTabSelecting.RemoveAll(this);
+        TabbedContainer->OnTabSelected.RemoveAll(this);
     }
 
     Super::NativeDestruct();
 }
 
 void UMCore_GameMenuHub::RebuildTabBar()
+{
+    if (!BeginTabBuild()) { return; }
+
+    ContinueTabBuild(TNumericLimits<double>::Max(), false);
+}
+
+bool UMCore_GameMenuHub::WarmUpTabs(double BudgetSeconds)
+{
+    if (!IsTabPlanCurrent() && !BeginTabBuild())
+    {
+        return true;
+    }
+
+    return ContinueTabBuild(BudgetSeconds, true);
+}
+
+void UMCore_GameMenuHub::EnsureTabBarBuilt()
+{
+    if (!IsTabPlanCurrent())
+    {
+        SyncTabsWithRegisteredScreens();
+    }
+    else if (NumTabsBuilt < PlannedTabs.Num())
+    {
+        ContinueTabBuild(TNumericLimits<double>::Max(), false);
+    }
+
+    /* Every open starts on the first tab, as a freshly built hub does */
+    SelectFirstTab();
+}
+
+void UMCore_GameMenuHub::SyncTabsWithRegisteredScreens()
+{
+    /* Diffing needs a complete build of real tabs; empty state and partial builds start over */
+    if (!TabbedContainer || !bTabBuildStarted || PlannedTabs.IsEmpty() || NumTabsBuilt < PlannedTabs.Num())
+    {
+        RebuildTabBar();
+        return;
+    }
+
+    const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+    const UMCore_UISubsystem* UISubsystem = LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_UISubsystem>() : nullptr;
+    if (!UISubsystem) { return; }
+
+    const TArray<FMCore_MenuTab> RegisteredScreens = UISubsystem->GetRegisteredMenuScreens();
+    if (RegisteredScreens.IsEmpty())
+    {
+        RebuildTabBar();
+        return;
+    }
+
+    int32 NumRemoved{0};
+    for (int32 Index = PlannedTabs.Num() - 1; Index >= 0; --Index)
+    {
+        const FMCore_MenuTab& Tab = PlannedTabs[Index];
+        if (!RegisteredScreens.ContainsByPredicate([&Tab](const FMCore_MenuTab& Candidate) { return IsSameMenuTab(Candidate, Tab); }))
+        {
+            const FName TabNameID = FName(*Tab.TabID.ToString());
+            TabbedContainer->RemoveTab(TabNameID);
+            PlaceholderTabs.Remove(TabNameID);
+            PageLastSelectedTime.Remove(TabNameID);
+            PlannedTabs.RemoveAt(Index);
+            ++NumRemoved;
+        }
+    }
+
+    /* PlannedTabs mirrors the container, so PlanIndex is also the container index. A survivor
+       found later in the plan was re-registered at another priority and is moved. */
+    int32 NumAdded{0};
+    int32 NumMoved{0};
+    int32 NumFailed{0};
+    int32 PlanIndex{0};
+    for (const FMCore_MenuTab& Tab : RegisteredScreens)
+    {
+        if (PlannedTabs.IsValidIndex(PlanIndex) && IsSameMenuTab(PlannedTabs[PlanIndex], Tab))
+        {
+            ++PlanIndex;
+            continue;
+        }
+
+        const FName TabNameID = FName(*Tab.TabID.ToString());
+        const int32 OldIndex = PlannedTabs.IndexOfByPredicate([&Tab](const FMCore_MenuTab& Candidate) { return IsSameMenuTab(Candidate, Tab); });
+        if (OldIndex != INDEX_NONE)
+        {
+            TabbedContainer->RemoveTab(TabNameID);
+            PlaceholderTabs.Remove(TabNameID);
+            PageLastSelectedTime.Remove(TabNameID);
+            PlannedTabs.RemoveAt(OldIndex);
+        }
+
+        /* A tab that failed stays out of the plan, so the plan is stale and the next sync retries it */
+        if (AddTabPage(Tab, PlanIndex, false, false))
+        {
+            PlannedTabs.Insert(Tab, PlanIndex++);
+            ++(OldIndex != INDEX_NONE ? NumMoved : NumAdded);
+        }
+        else
+        {
+            ++NumFailed;
+        }
+    }
+    NumTabsBuilt = PlannedTabs.Num();
+
+    if (TabbedContainer->GetSelectedTabID().IsNone())
+    {
+        SelectFirstTab();
+    }
+
+    UE_LOG(LogModulusUI, Log,
+        TEXT("GameMenuHub::SyncTabsWithRegisteredScreens -- added %d, moved %d, removed %d, failed %d tab(s) (total: %d)"),
+        NumAdded, NumMoved, NumRemoved, NumFailed, TabbedContainer->GetTabCount());
+}
+
+bool UMCore_GameMenuHub::BeginTabBuild()
 {
     if (!TabbedContainer)
     {
         UE_LOG(LogModulusUI, Error,
             TEXT("GameMenuHub::RebuildTabBar -- TabbedContainer not bound, verify BindWidget in Blueprint"));
-        return;
+        return false;
     }
 
     ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
     if (!LocalPlayer)
     {
         UE_LOG(LogModulusUI, Warning, TEXT("GameMenuHub::RebuildTabBar -- no owning LocalPlayer"));
-        return;
+        return false;
     }
 
     UMCore_UISubsystem* UISubsystem = LocalPlayer->GetSubsystem<UMCore_UISubsystem>();
     if (!UISubsystem)
     {
         UE_LOG(LogModulusUI, Warning, TEXT("GameMenuHub::RebuildTabBar -- no UISubsystem found"));
-        return;
+        return false;
     }
 
-    const TArray<FMCore_MenuTab>& RegisteredScreens = UISubsystem->GetRegisteredMenuScreens();
+    PlannedTabs = UISubsystem->GetRegisteredMenuScreens();
+    NumTabsBuilt = 0;
+    bTabBuildStarted = true;
+    PlaceholderTabs.Reset();
+    PageLastSelectedTime.Reset();
 
     TabbedContainer->ClearAllTabs();
 
-    if (RegisteredScreens.IsEmpty())
+    if (PlannedTabs.IsEmpty())
     {
         if (EmptyStateWidgetClass)
         {
@@ -85,37 +257,85 @@ void UMCore_GameMenuHub::RebuildTabBar()
         {
             UE_LOG(LogModulusUI, Warning, TEXT("GameMenuHub::RebuildTabBar -- no screens registered and EmptyStateWidgetClass not set"));
         }
-        return;
+        return false;
     }
 
-    for (int32 Index = 0; Index < RegisteredScreens.Num(); ++Index)
-    {
-        const FMCore_MenuTab& Tab = RegisteredScreens[Index];
-        FName TabNameID = FName(*Tab.TabID.ToString());
+    return true;
+}
+
+bool UMCore_GameMenuHub::ContinueTabBuild(double BudgetSeconds, bool bWarmPages)
+{
+    if (!TabbedContainer || NumTabsBuilt >= PlannedTabs.Num()) { return true; }
 
-        UCommonActivatableWidget* ScreenWidget = CreateWidget<UCommonActivatableWidget>(
-            this, Tab.ScreenWidgetClass);
+    const double StartTime = FPlatformTime::Seconds();
 
-        if (!ScreenWidget)
+    while (NumTabsBuilt < PlannedTabs.Num())
+    {
+        /* Warm-up exists to construct pages ahead of time, so it never leaves placeholders.
+           A tab that fails is dropped from the plan, which leaves it stale for the next sync to retry. */
+        if (AddTabPage(PlannedTabs[NumTabsBuilt], NumTabsBuilt, bWarmPages, bWarmPages))
         {
-            UE_LOG(LogModulusUI, Error,
-                TEXT("GameMenuHub::RebuildTabBar -- failed to create widget for '%s'"),
-                *Tab.TabID.ToString());
-            continue;
+            ++NumTabsBuilt;
+        }
+        else
+        {
+            PlannedTabs.RemoveAt(NumTabsBuilt);
         }
 
-        TabbedContainer->AddTab(TabNameID, ScreenWidget);
-        OnPageCreated(TabNameID, ScreenWidget);
+        if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds && NumTabsBuilt < PlannedTabs.Num())
+        {
+            return false;
+        }
+    }
+
+    SelectFirstTab();
+
+    UE_LOG(LogModulusUI, Log,
+        TEXT("GameMenuHub::RebuildTabBar -- rebuilt tab bar with %d tabs"),
+        PlannedTabs.Num());
+    return true;
+}
+
+bool UMCore_GameMenuHub::IsTabPlanCurrent() const
+{
+    if (!bTabBuildStarted) { return false; }
+
+    const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+    const UMCore_UISubsystem* UISubsystem = LocalPlayer ? LocalPlayer->GetSubsystem<UMCore_UISubsystem>() : nullptr;
+    if (!UISubsystem) { return false; }
+
+    const TArray<FMCore_MenuTab>& RegisteredScreens = UISubsystem->GetRegisteredMenuScreens();
+    if (RegisteredScreens.Num() != PlannedTabs.Num()) { return false; }
+
+    for (int32 Index = 0; Index < PlannedTabs.Num(); ++Index)
+    {
+        if (!IsSameMenuTab(RegisteredScreens[Index], PlannedTabs[Index]))
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    if (!RegisteredScreens.IsEmpty())
+UCommonActivatableWidget* UMCore_GameMenuHub::CreateTabPage(const FMCore_MenuTab& Tab)
+{
+    UCommonActivatableWidget* ScreenWidget = CreateWidget<UCommonActivatableWidget>(
+        this, Tab.ScreenWidgetClass);
+
+    if (!ScreenWidget)
     {
-        FName FirstTabID = FName(*RegisteredScreens[0].TabID.ToString());
-        TabbedContainer->SelectTab(FirstTabID);
+        UE_LOG(LogModulusUI, Error,
+            TEXT("GameMenuHub::CreateTabPage -- failed to create widget for '%s'"),
+            *Tab.TabID.ToString());
+    }
+    return ScreenWidget;
+}
 
-        UE_LOG(LogModulusUI, Log,
-            TEXT("GameMenuHub::RebuildTabBar -- rebuilt tab bar with %d tabs"),
-            RegisteredScreens.Num());
+void UMCore_GameMenuHub::SelectFirstTab()
+{
+    if (TabbedContainer && TabbedContainer->GetTabCount() > 0)
+    {
+        TabbedContainer->SelectTab(TabbedContainer->GetTabOrder()[0]);
     }
 }
 
@@ -206,3 +426,196 @@ void UMCore_GameMenuHub::HandleContainerTabAdded(FName TabID, UCommonButtonBase*
 {
     OnTabCreated(TabID, TabButton);
 }
+
+void UMCore_GameMenuHub::HandleContainerTabSelecting(FName TabID)
+{
+    MaterializeTabPage(TabID);
+    if (!PlaceholderTabs.Contains(TabID))
+    {
+        PageLastSelectedTime.Add(TabID, FPlatformTime::Seconds());
+    }
+}
+
+void UMCore_GameMenuHub::HandleContainerTabSelected(FName TabID)
+{
+    ApplyPageUnloadPolicy();
+
+    const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+    if (DevSettings && DevSettings->bLazyMenuTabPages && DevSettings->bPrefetchAdjacentMenuTabs
+        && !PlaceholderTabs.IsEmpty() && !AdjacentPrefetchTicker.IsValid())
+    {
+        AdjacentPrefetchTicker = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &ThisClass::TickAdjacentPrefetch));
+    }
+}
+
+bool UMCore_GameMenuHub::AddTabPage(const FMCore_MenuTab& Tab, int32 ContainerIndex, bool bConstructPage, bool bWarmPage)
+{
+    const FName TabNameID = FName(*Tab.TabID.ToString());
+    const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+
+    if (!bConstructPage && DevSettings && DevSettings->bLazyMenuTabPages)
+    {
+        /* Holds the tab's place in the switcher until first selection */
+        if (!TabbedContainer->InsertTab(TabNameID, NewObject<USizeBox>(this), ContainerIndex)) { return false; }
+
+        PlaceholderTabs.Add(TabNameID);
+        return true;
+    }
+
+    UCommonActivatableWidget* ScreenWidget = CreateTabPage(Tab);
+    if (!ScreenWidget || !TabbedContainer->InsertTab(TabNameID, ScreenWidget, ContainerIndex)) { return false; }
+
+    PageLastSelectedTime.Add(TabNameID, FPlatformTime::Seconds());
+    OnPageCreated(TabNameID, ScreenWidget);
+
+    if (bWarmPage)
+    {
+        if (UMCore_ActivatableBase* ModulusPage = Cast<UMCore_ActivatableBase>(ScreenWidget))
+        {
+            ModulusPage->WarmUp();
+        }
+    }
+    return true;
+}
+
+bool UMCore_GameMenuHub::MaterializeTabPage(FName TabID)
+{
+    if (!TabbedContainer || !PlaceholderTabs.Contains(TabID)) { return false; }
+
+    const FMCore_MenuTab* Tab = PlannedTabs.FindByPredicate([TabID](const FMCore_MenuTab& Candidate)
+    {
+        return FName(*Candidate.TabID.ToString()) == TabID;
+    });
+    if (!Tab) { return false; }
+
+    UCommonActivatableWidget* ScreenWidget = CreateTabPage(*Tab);
+    if (!ScreenWidget || !TabbedContainer->ReplaceTabPage(TabID, ScreenWidget)) { return false; }
+
+    PlaceholderTabs.Remove(TabID);
+    PageLastSelectedTime.Add(TabID, FPlatformTime::Seconds());
+    OnPageCreated(TabID, ScreenWidget);
+    INC_DWORD_STAT(STAT_MCore_MenuPagesMaterialized);
+
+    UE_LOG(LogModulusUI, Verbose, TEXT("GameMenuHub::MaterializeTabPage -- built page for tab '%s'"), *TabID.ToString());
+    return true;
+}
+
+bool UMCore_GameMenuHub::UnloadTabPage(FName TabID)
+{
+    if (!TabbedContainer || PlaceholderTabs.Contains(TabID) || !TabbedContainer->HasTab(TabID)) { return false; }
+    if (TabbedContainer->GetSelectedTabID() == TabID) { return false; }
+
+    /* The dropped page is left to GC once the switcher releases it */
+    if (!TabbedContainer->ReplaceTabPage(TabID, NewObject<USizeBox>(this))) { return false; }
+
+    PlaceholderTabs.Add(TabID);
+    PageLastSelectedTime.Remove(TabID);
+    INC_DWORD_STAT(STAT_MCore_MenuPagesUnloaded);
+
+    UE_LOG(LogModulusUI, Verbose, TEXT("GameMenuHub::UnloadTabPage -- unloaded page for tab '%s'"), *TabID.ToString());
+    return true;
+}
+
+void UMCore_GameMenuHub::ApplyPageUnloadPolicy()
+{
+    const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+    if (!TabbedContainer || !DevSettings || !DevSettings->bLazyMenuTabPages) { return; }
+    if (DevSettings->MenuTabPageUnloadSeconds <= 0.0f && DevSettings->MaxLiveMenuTabPages <= 0) { return; }
+
+    const FName SelectedTab = TabbedContainer->GetSelectedTabID();
+    const double Now = FPlatformTime::Seconds();
+
+    int32 NumLive{0};
+    TArray<TPair<double, FName>> Candidates;
+    for (const FName& TabID : TabbedContainer->GetTabOrder())
+    {
+        if (PlaceholderTabs.Contains(TabID)) { continue; }
+
+        ++NumLive;
+        if (TabID != SelectedTab)
+        {
+            Candidates.Emplace(PageLastSelectedTime.FindRef(TabID), TabID);
+        }
+    }
+
+    /* Least recently selected first */
+    Candidates.Sort([](const TPair<double, FName>& A, const TPair<double, FName>& B) { return A.Key < B.Key; });
+
+    for (const TPair<double, FName>& Candidate : Candidates)
+    {
+        const bool bStale = DevSettings->MenuTabPageUnloadSeconds > 0.0f
+            && Now - Candidate.Key > DevSettings->MenuTabPageUnloadSeconds;
+        const bool bOverCap = DevSettings->MaxLiveMenuTabPages > 0 && NumLive > DevSettings->MaxLiveMenuTabPages;
+
+        if ((bStale || bOverCap) && UnloadTabPage(Candidate.Value))
+        {
+            --NumLive;
+        }
+    }
+}
+
+bool UMCore_GameMenuHub::TickAdjacentPrefetch(float DeltaTime)
+{
+    const UMCore_CoreSettings* DevSettings = UMCore_CoreSettings::Get();
+    if (!TabbedContainer || !DevSettings || !IsActivated())
+    {
+        AdjacentPrefetchTicker.Reset();
+        return false;
+    }
+
+    const TArray<FName>& TabOrder = TabbedContainer->GetTabOrder();
+    const int32 SelectedIndex = TabOrder.IndexOfByKey(TabbedContainer->GetSelectedTabID());
+    const int32 NumLive = TabOrder.Num() - PlaceholderTabs.Num();
+    const bool bUnderCap = DevSettings->MaxLiveMenuTabPages <= 0 || NumLive < DevSettings->MaxLiveMenuTabPages;
+
+    if (SelectedIndex != INDEX_NONE && bUnderCap)
+    {
+        /* Neighbours as SelectNextTab/SelectPreviousTab reach them, wrapping; one page per frame */
+        for (const int32 Offset : {1, -1})
+        {
+            const FName Neighbour = TabOrder[(SelectedIndex + Offset + TabOrder.Num()) % TabOrder.Num()];
+            if (MaterializeTabPage(Neighbour))
+            {
+                return true;
+            }
+        }
+    }
+
+    AdjacentPrefetchTicker.Reset();
+    return false;
+}
+
+void UMCore_GameMenuHub::StopAdjacentPrefetch()
+{
+    if (AdjacentPrefetchTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(AdjacentPrefetchTicker);
+        AdjacentPrefetchTicker.Reset();
+    }
+}
+
+bool UMCore_GameMenuHub::PrefetchTabPage(FGameplayTag TabID)
+{
+    return TabID.IsValid() && MaterializeTabPage(FName(*TabID.ToString()));
+}
+
+FMCore_MenuPageStats UMCore_GameMenuHub::GetPageStats() const
+{
+    FMCore_MenuPageStats Stats;
+    if (!TabbedContainer) { return Stats; }
+
+    for (const FName& TabID : TabbedContainer->GetTabOrder())
+    {
+        if (PlaceholderTabs.Contains(TabID))
+        {
+            ++Stats.PlaceholderPages;
+        }
+        else if (UWidget* PageWidget = TabbedContainer->GetPageWidget(TabID))
+        {
+            ++Stats.LivePages;
+            Stats.LivePageBytes += EstimateWidgetBytes(*PageWidget);
+        }
+    }
+    return Stats;
+}
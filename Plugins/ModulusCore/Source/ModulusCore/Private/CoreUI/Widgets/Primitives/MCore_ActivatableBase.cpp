@@ -300,6 +300,42 @@ void UMCore_ActivatableBase::UnbindThemeDelegate()
 	bThemeDelegateBound = false;
 }
 
+void UMCore_ActivatableBase::ResetForReuse()
+{
+	NativeResetForReuse();
+}
+
+void UMCore_ActivatableBase::NativeResetForReuse()
+{
+	SavedFocusTarget.Reset();
+	UnregisterAllBindings();
+
+	/* Match a fresh instance even if the theme changed while this one sat closed and unbound */
+	BindThemeDelegate();
+	if (ULocalPlayer* LocalPlayer = GetOwningLocalPlayer())
+	{
+		if (UMCore_UISubsystem* UISubsystem = LocalPlayer->GetSubsystem<UMCore_UISubsystem>())
+		{
+			ApplyTheme(UISubsystem->GetActiveTheme());
+		}
+	}
+
+	K2_OnResetForReuse();
+
+	UE_LOG(LogModulusUI, Verbose, TEXT("ActivatableBase::NativeResetForReuse -- reset for reuse, widget=%s"),
+		*GetNameSafe(this));
+}
+
+void UMCore_ActivatableBase::WarmUp()
+{
+	NativeWarmUp();
+}
+
+void UMCore_ActivatableBase::NativeWarmUp()
+{
+	K2_OnWarmUp();
+}
+
 void UMCore_ActivatableBase::NativeDestruct()
 {
 	if (ULocalPlayer* LocalPlayer = GetOwningLocalPlayer())
@@ -175,8 +175,8 @@ void UMCore_ButtonBase::ApplyTheme_Implementation(UMCore_PDA_UITheme_Base* Theme
 	}
 	else if (Theme)
 	{
-		UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-			GetOwningLocalPlayer(), Txt_BtnLabel, Theme->LabelTextStyle);
+		UMCore_ThemeLibrary::ApplyThemeTextStyle(
+			GetOwningLocalPlayer(), Txt_BtnLabel, Theme, EMCore_ThemeTextRole::Label);
 	}
 
 	K2_OnThemeApplied(Theme);
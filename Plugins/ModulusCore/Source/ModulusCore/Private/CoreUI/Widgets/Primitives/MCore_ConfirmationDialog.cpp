@@ -41,6 +41,11 @@ void UMCore_ConfirmationDialog::NativeOnInitialized()
 {
 	Super::NativeOnInitialized();
 
+	if (Txt_DialogMessage)
+	{
+		DefaultDialogMessage = Txt_DialogMessage->GetText();
+	}
+
 	if (Btn_Confirm)
 	{
 		Btn_Confirm->OnButtonClicked.AddDynamic(this, &ThisClass::HandleConfirmClicked);
@@ -103,6 +108,16 @@ void UMCore_ConfirmationDialog::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UMCore_ConfirmationDialog::NativeResetForReuse()
+{
+	Super::NativeResetForReuse();
+
+	/* Callers set the message after opening; never show the previous caller's */
+	OnDialogResult.Clear();
+	bResolved = false;
+	SetDialogMessage(DefaultDialogMessage);
+}
+
 UWidget* UMCore_ConfirmationDialog::NativeGetDesiredFocusTarget() const
 {
 	/* Default focus to Cancel for safety (prevent accidental confirms) */
@@ -6,16 +6,42 @@
 #include "Components/HorizontalBox.h"
 #include "Components/HorizontalBoxSlot.h"
 
-void UMCore_TabListBase::HandleTabCreation_Implementation(FName TabNameID, UCommonButtonBase* TabButton)
+void UMCore_TabListBase::SyncTabButtonOrder(TConstArrayView<FName> Order, int32 FirstIndex)
 {
-	if (HBox_Tabs && TabButton)
+	if (!HBox_Tabs) { return; }
+
+	/* InsertChildAt never reaches the live Slate box; removing and re-adding the tail does */
+	TArray<UCommonButtonBase*, TInlineAllocator<16>> Tail;
+	for (int32 Index = FMath::Max(FirstIndex, 0); Index < Order.Num(); ++Index)
 	{
-		if (UHorizontalBoxSlot* TabSlot = HBox_Tabs->AddChildToHorizontalBox(TabButton))
+		if (UCommonButtonBase* TabButton = GetTabButtonBaseByID(Order[Index]))
 		{
-			TabSlot->SetHorizontalAlignment(HAlign_Fill);
-			TabSlot->SetVerticalAlignment(VAlign_Fill);
+			HBox_Tabs->RemoveChild(TabButton);
+			Tail.Add(TabButton);
 		}
 	}
+
+	for (UCommonButtonBase* TabButton : Tail)
+	{
+		AddTabButtonSlot(TabButton);
+	}
+}
+
+void UMCore_TabListBase::HandleTabCreation_Implementation(FName TabNameID, UCommonButtonBase* TabButton)
+{
+	if (HBox_Tabs && TabButton)
+	{
+		AddTabButtonSlot(TabButton);
+	}
+}
+
+void UMCore_TabListBase::AddTabButtonSlot(UCommonButtonBase* TabButton)
+{
+	if (UHorizontalBoxSlot* TabSlot = HBox_Tabs->AddChildToHorizontalBox(TabButton))
+	{
+		TabSlot->SetHorizontalAlignment(HAlign_Fill);
+		TabSlot->SetVerticalAlignment(VAlign_Fill);
+	}
 }
 
 void UMCore_TabListBase::HandleTabRemoval_Implementation(FName TabNameID, UCommonButtonBase* TabButton)
@@ -4,6 +4,7 @@
 
 #include "CoreData/Logging/LogModulusUI.h"
 #include "CoreUI/Widgets/Primitives/MCore_ActionButton.h"
+#include "CoreUI/Widgets/Primitives/MCore_TabListBase.h"
 
 #include "CommonButtonBase.h"
 #include "CommonTabListWidgetBase.h"
@@ -38,23 +39,28 @@ void UMCore_TabbedContainer::NativeDestruct()
 }
 
 bool UMCore_TabbedContainer::AddTab(FName TabID, UWidget* PageWidget)
+{
+	return InsertTab(TabID, PageWidget, TabOrder.Num());
+}
+
+bool UMCore_TabbedContainer::InsertTab(FName TabID, UWidget* PageWidget, int32 Index)
 {
 	if (TabID.IsNone())
 	{
-		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::AddTab -- invalid TabID (NAME_None)"));
+		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::InsertTab -- invalid TabID (NAME_None)"));
 		return false;
 	}
 
 	if (!PageWidget)
 	{
-		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::AddTab -- PageWidget is null for tab '%s'"),
+		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::InsertTab -- PageWidget is null for tab '%s'"),
 			*TabID.ToString());
 		return false;
 	}
 
 	if (PageWidgets.Contains(TabID))
 	{
-		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::AddTab -- tab '%s' already exists, skipping duplicate"),
+		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::InsertTab -- tab '%s' already exists, skipping duplicate"),
 			*TabID.ToString());
 		return false;
 	}
@@ -64,69 +70,70 @@ bool UMCore_TabbedContainer::AddTab(FName TabID, UWidget* PageWidget)
 	{
 		ButtonClass = UCommonButtonBase::StaticClass();
 		UE_LOG(LogModulusUI, Warning,
-			TEXT("TabbedContainer::AddTab -- TabButtonClass not set, using framework default"));
+			TEXT("TabbedContainer::InsertTab -- TabButtonClass not set, using framework default"));
 	}
 
+	/* Pages switch by widget, not by index, so the switcher only ever appends */
+	Index = FMath::Clamp(Index, 0, TabOrder.Num());
 	PageWidgets.Add(TabID, PageWidget);
-	TabOrder.Add(TabID);
+	TabOrder.Insert(TabID, Index);
 	PageSwitcher->AddChild(PageWidget);
-	TabList->RegisterTab(TabID, ButtonClass, PageWidget, PageWidgets.Num() - 1);
+	TabList->RegisterTab(TabID, ButtonClass, PageWidget, Index);
+
+	/* The new button landed at the end of the bar; slide the tabs that follow it back behind it */
+	if (Index < TabOrder.Num() - 1)
+	{
+		if (UMCore_TabListBase* ModulusTabList = Cast<UMCore_TabListBase>(TabList))
+		{
+			ModulusTabList->SyncTabButtonOrder(TabOrder, Index + 1);
+		}
+	}
 
 	if (UCommonButtonBase* TabButton = TabList->GetTabButtonBaseByID(TabID))
 	{
 		OnTabAdded.Broadcast(TabID, TabButton);
 	}
 
-	UE_LOG(LogModulusUI, Verbose, TEXT("TabbedContainer::AddTab -- added tab '%s' (total: %d)"),
-		*TabID.ToString(), PageWidgets.Num());
+	/* The tab list selects nothing on insert; keep showing the selected page */
+	if (!SelectedTabID.IsNone() && TabList->GetSelectedTabId() != SelectedTabID)
+	{
+		TabList->SelectTabByID(SelectedTabID, true);
+	}
+
+	UE_LOG(LogModulusUI, Verbose, TEXT("TabbedContainer::InsertTab -- added tab '%s' at %d (total: %d)"),
+		*TabID.ToString(), Index, PageWidgets.Num());
 
 	return true;
 }
 
 bool UMCore_TabbedContainer::RemoveTab(FName TabID)
 {
-	if (!PageWidgets.Contains(TabID))
+	TObjectPtr<UWidget> PageWidget;
+	if (!PageWidgets.RemoveAndCopyValue(TabID, PageWidget))
 	{
 		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::RemoveTab -- tab '%s' not found"),
 			*TabID.ToString());
 		return false;
 	}
 
-	/* Store remaining tabs preserving insertion order via iteration */
-	TArray<TPair<FName, TObjectPtr<UWidget>>> RemainingTabs;
-	for (auto& Pair : PageWidgets)
-	{
-		if (Pair.Key != TabID)
-		{
-			RemainingTabs.Add(Pair);
-		}
-	}
-
-	/* Clear and rebuild to maintain correct indices */
-	TabList->RemoveAllTabs();
-	PageSwitcher->ClearChildren();
-	PageWidgets.Empty();
-	TabOrder.Reset();
-	SelectedTabID = NAME_None;
+	const int32 OrderIndex = TabOrder.IndexOfByKey(TabID);
+	TabOrder.RemoveAt(OrderIndex);
 
-	TSubclassOf<UCommonButtonBase> ButtonClass = TabButtonClass;
-	if (!ButtonClass)
-	{
-		ButtonClass = UCommonButtonBase::StaticClass();
-	}
+	TabList->RemoveTab(TabID);
+	PageSwitcher->RemoveChild(PageWidget);
 
-	for (int32 Index = 0; Index < RemainingTabs.Num(); ++Index)
+	/* Only the selected tab's removal moves the selection: to the tab that took its place */
+	if (SelectedTabID == TabID)
 	{
-		const auto& Pair = RemainingTabs[Index];
-		PageSwitcher->AddChild(Pair.Value);
-		TabList->RegisterTab(Pair.Key, ButtonClass, Pair.Value, Index);
-		PageWidgets.Add(Pair.Key, Pair.Value);
-		TabOrder.Add(Pair.Key);
+		SelectedTabID = NAME_None;
+		if (!TabOrder.IsEmpty())
+		{
+			SelectTab(TabOrder[FMath::Min(OrderIndex, TabOrder.Num() - 1)]);
+		}
 	}
-
-	if (RemainingTabs.Num() > 0)
+	else if (!SelectedTabID.IsNone() && PageSwitcher->GetActiveWidget() != PageWidgets.FindRef(SelectedTabID))
 	{
-		TabList->SelectTabByID(RemainingTabs[0].Key);
+		PageSwitcher->SetActiveWidget(PageWidgets.FindRef(SelectedTabID));
 	}
 
 	UE_LOG(LogModulusUI, Log, TEXT("TabbedContainer::RemoveTab -- removed tab '%s' (remaining: %d)"),
@@ -153,6 +160,35 @@ void UMCore_TabbedContainer::ClearAllTabs()
 	SelectedTabID = NAME_None;
 }
 
+bool UMCore_TabbedContainer::ReplaceTabPage(FName TabID, UWidget* NewPageWidget)
+{
+	TObjectPtr<UWidget>* FoundWidget = PageWidgets.Find(TabID);
+	if (!FoundWidget || !NewPageWidget)
+	{
+		UE_LOG(LogModulusUI, Warning, TEXT("TabbedContainer::ReplaceTabPage -- tab '%s' not found or new page is null"),
+			*TabID.ToString());
+		return false;
+	}
+
+	UWidget* OldPageWidget = *FoundWidget;
+	if (OldPageWidget == NewPageWidget) { return true; }
+
+	/* Pages switch by widget, so the new page can go at the end; re-point the switcher afterwards */
+	UWidget* ActiveWidget = PageSwitcher->GetActiveWidget();
+	PageSwitcher->RemoveChild(OldPageWidget);
+	PageSwitcher->AddChild(NewPageWidget);
+	*FoundWidget = NewPageWidget;
+
+	if (UWidget* ShownWidget = ActiveWidget == OldPageWidget ? NewPageWidget : ActiveWidget)
+	{
+		PageSwitcher->SetActiveWidget(ShownWidget);
+	}
+
+	UE_LOG(LogModulusUI, Verbose, TEXT("TabbedContainer::ReplaceTabPage -- replaced page of tab '%s'"),
+		*TabID.ToString());
+	return true;
+}
+
 bool UMCore_TabbedContainer::SelectTab(FName TabID)
 {
 	if (!PageWidgets.Contains(TabID))
@@ -199,6 +235,8 @@ void UMCore_TabbedContainer::SetTabCycleActions(
 
 void UMCore_TabbedContainer::HandleTabSelected(FName TabNameID)
 {
+	OnTabSelecting.Broadcast(TabNameID);
+
 	TObjectPtr<UWidget>* FoundWidget = PageWidgets.Find(TabNameID);
 	if (!FoundWidget || !*FoundWidget)
 	{
@@ -0,0 +1,199 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreUI/Widgets/Settings/MCore_SettingsListView.h"
+
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Logging/LogModulusSettings.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsSectionHeader.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Base.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Slider.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Switcher.h"
+
+// ============================================================================
+// ROWS
+// ============================================================================
+
+void UMCore_SettingsListView::SetSettingDefinitions(TConstArrayView<const UMCore_DA_SettingDefinition*> Definitions)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	const bool bSectionHeaders = CoreSettings && CoreSettings->SettingsSectionHeaderWidgetClass;
+
+	PendingFocusItem.Reset();
+	Rows.Reset(Definitions.Num());
+
+	FText CurrentSection;
+	for (const UMCore_DA_SettingDefinition* Definition : Definitions)
+	{
+		if (!Definition) { continue; }
+
+		if (!ResolveSettingWidgetClass(Definition))
+		{
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("SettingsListView::SetSettingDefinitions -- no widget class configured for SettingType %d, setting='%s'"),
+				(int32)Definition->SettingType, *Definition->SettingTag.ToString());
+			continue;
+		}
+
+		if (bSectionHeaders && !Definition->SectionName.IsEmpty()
+			&& !Definition->SectionName.EqualTo(CurrentSection))
+		{
+			UMCore_SettingsListItem* Header = NewObject<UMCore_SettingsListItem>(this);
+			Header->SectionName = Definition->SectionName;
+			Rows.Add(Header);
+		}
+		CurrentSection = Definition->SectionName;
+
+		UMCore_SettingsListItem* Row = NewObject<UMCore_SettingsListItem>(this);
+		Row->Definition = Definition;
+		Row->SectionName = Definition->SectionName;
+		Rows.Add(Row);
+	}
+
+	TArray<UObject*> Items;
+	Items.Reserve(Rows.Num());
+	for (UMCore_SettingsListItem* Row : Rows)
+	{
+		Items.Add(Row);
+	}
+	SetListItems(Items);
+}
+
+int32 UMCore_SettingsListView::FindSettingIndex(const FGameplayTag& SettingTag) const
+{
+	return Rows.IndexOfByPredicate([&SettingTag](const UMCore_SettingsListItem* Row)
+	{
+		return Row->Definition && Row->Definition->SettingTag == SettingTag;
+	});
+}
+
+const UMCore_DA_SettingDefinition* UMCore_SettingsListView::GetDefinitionAt(int32 Index) const
+{
+	return Rows.IsValidIndex(Index) ? Rows[Index]->Definition.Get() : nullptr;
+}
+
+// ============================================================================
+// FOCUS
+// ============================================================================
+
+bool UMCore_SettingsListView::FocusSetting(const FGameplayTag& SettingTag)
+{
+	const int32 Index = FindSettingIndex(SettingTag);
+	if (Index == INDEX_NONE) { return false; }
+
+	/* The entry may not exist yet; OnItemScrolledIntoViewInternal hands it focus once it does */
+	PendingFocusItem = Rows[Index];
+	SetSelectedIndex(Index);
+	NavigateToIndex(Index);
+	return true;
+}
+
+bool UMCore_SettingsListView::FocusFirstSetting()
+{
+	for (const UMCore_SettingsListItem* Row : Rows)
+	{
+		if (Row->Definition)
+		{
+			return FocusSetting(Row->Definition->SettingTag);
+		}
+	}
+	return false;
+}
+
+void UMCore_SettingsListView::OnItemScrolledIntoViewInternal(UObject* Item, UUserWidget& EntryWidget)
+{
+	Super::OnItemScrolledIntoViewInternal(Item, EntryWidget);
+
+	if (Item && Item == PendingFocusItem.Get())
+	{
+		PendingFocusItem.Reset();
+		EntryWidget.SetUserFocus(GetOwningPlayer());
+	}
+}
+
+TArray<UMCore_SettingsWidget_Base*> UMCore_SettingsListView::GetDisplayedSettingWidgets() const
+{
+	TArray<UMCore_SettingsWidget_Base*> Widgets;
+	for (UUserWidget* Entry : GetDisplayedEntryWidgets())
+	{
+		if (UMCore_SettingsWidget_Base* SettingWidget = Cast<UMCore_SettingsWidget_Base>(Entry))
+		{
+			Widgets.Add(SettingWidget);
+		}
+	}
+	return Widgets;
+}
+
+// ============================================================================
+// ENTRY GENERATION
+// ============================================================================
+
+TSubclassOf<UMCore_SettingsWidget_Base> UMCore_SettingsListView::ResolveSettingWidgetClass(
+	const UMCore_DA_SettingDefinition* Definition)
+{
+	if (!Definition) { return nullptr; }
+	if (Definition->WidgetClassOverride) { return Definition->WidgetClassOverride; }
+
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings) { return nullptr; }
+
+	switch (Definition->SettingType)
+	{
+	case EMCore_SettingType::Toggle:
+	case EMCore_SettingType::Dropdown:
+		return CoreSettings->SettingsSwitcherWidgetClass;
+
+	case EMCore_SettingType::Slider:
+		return CoreSettings->SettingsSliderWidgetClass;
+	}
+	return nullptr;
+}
+
+TSubclassOf<UMCore_SettingsListView> UMCore_SettingsListView::GetConfiguredClass()
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings || !CoreSettings->bVirtualizeSettingsLists) { return nullptr; }
+
+	/* Entry classes are chosen per row, but the base list refuses to build without a default */
+	const TSubclassOf<UMCore_SettingsListView> ListClass = CoreSettings->SettingsListViewClass;
+	if (!ListClass || !ListClass.GetDefaultObject()->GetEntryWidgetClass())
+	{
+		static bool bWarned = false;
+		if (!bWarned)
+		{
+			bWarned = true;
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("SettingsListView::GetConfiguredClass -- bVirtualizeSettingsLists is on but SettingsListViewClass is unset or has no EntryWidgetClass, building scroll box pages"));
+		}
+		return nullptr;
+	}
+	return ListClass;
+}
+
+UUserWidget& UMCore_SettingsListView::OnGenerateEntryWidgetInternal(UObject* Item,
+	TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	TSubclassOf<UUserWidget> EntryClass = DesiredEntryClass;
+
+	if (const UMCore_SettingsListItem* Row = Cast<UMCore_SettingsListItem>(Item))
+	{
+		if (Row->IsSectionHeader())
+		{
+			/* Headers are only created when this class is set */
+			EntryClass = UMCore_CoreSettings::Get()->SettingsSectionHeaderWidgetClass;
+		}
+		else if (const TSubclassOf<UMCore_SettingsWidget_Base> RowClass = ResolveSettingWidgetClass(Row->Definition))
+		{
+			EntryClass = RowClass;
+		}
+	}
+
+	/* The entry pool keys on class, so sliders recycle into sliders and switchers into switchers */
+	return GenerateTypedEntry(EntryClass, OwnerTable);
+}
+
+bool UMCore_SettingsListView::OnIsSelectableOrNavigableInternal(UObject* FirstSelectedItem)
+{
+	const UMCore_SettingsListItem* Row = Cast<UMCore_SettingsListItem>(FirstSelectedItem);
+	return Row && !Row->IsSectionHeader() && Super::OnIsSelectableOrNavigableInternal(FirstSelectedItem);
+}
@@ -4,23 +4,32 @@
 
 #include "CoreData/DevSettings/MCore_CoreSettings.h"
 #include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
+#include "CoreData/Settings/MCore_SettingsCollectionSubsystem.h"
 #include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
 #include "CoreUI/MCore_UISubsystem.h"
 #include "CoreUI/Widgets/Primitives/MCore_ActionButton.h"
 #include "CoreUI/Widgets/Primitives/MCore_ButtonBase.h"
 #include "CoreUI/Widgets/Primitives/MCore_TabbedContainer.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsListView.h"
 #include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Base.h"
-#include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Slider.h"
-#include "CoreUI/Widgets/Settings/MCore_SettingsWidget_Switcher.h"
 #include "CoreUI/Widgets/KeyBindings/MCore_KeyBindingPanel_Base.h"
 #include "CoreUI/Widgets/Primitives/MCore_ConfirmationDialog.h"
 #include "CoreUI/Widgets/Settings/MCore_SettingsRevertCountdown.h"
 #include "CoreData/Logging/LogModulusSettings.h"
 #include "CoreData/Tags/MCore_UILayerTags.h"
 
+#include "Blueprint/WidgetTree.h"
 #include "CommonTextBlock.h"
+#include "Components/EditableTextBox.h"
+#include "Components/PanelWidget.h"
 #include "Components/ScrollBox.h"
 #include "Components/SizeBox.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Slate/WidgetRenderer.h"
+#include "UObject/UObjectIterator.h"
 
 // ============================================================================
 // FILE-LOCAL HELPERS
@@ -28,17 +37,6 @@
 
 namespace
 {
-	FGameplayTag GetParentTag(const FGameplayTag& Tag)
-	{
-		const FString TagStr = Tag.ToString();
-		int32 LastDot;
-		if (TagStr.FindLastChar(TEXT('.'), LastDot))
-		{
-			return FGameplayTag::RequestGameplayTag(FName(*TagStr.Left(LastDot)), false);
-		}
-		return FGameplayTag();
-	}
-
 	void SetTabButtonLabel(UMCore_TabbedContainer* Container, FName TabID, const FGameplayTag& Tag)
 	{
 		if (UMCore_ButtonBase* TabButton = Cast<UMCore_ButtonBase>(Container->GetTabButton(TabID)))
@@ -46,6 +44,26 @@ namespace
 			TabButton->SetButtonText(UMCore_CoreSettings::Get()->GetCategoryDisplayName(Tag));
 		}
 	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommand CmdSettingsListBenchmark(
+		TEXT("Modulus.Settings.ListBenchmark"),
+		TEXT("Compares a scroll box page and a virtualized list page on the open settings panel. Usage: Modulus.Settings.ListBenchmark [NumSettings=2000]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumSettings = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000;
+			for (TObjectIterator<UMCore_SettingsPanel> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+			{
+				if (It->IsConstructed())
+				{
+					It->RunListBenchmark(NumSettings);
+					return;
+				}
+			}
+			UE_LOG(LogModulusSettings, Warning,
+				TEXT("SettingsPanel::RunListBenchmark -- no constructed settings panel, open one first"));
+		}));
+#endif
 }
 
 // ============================================================================
@@ -62,8 +80,17 @@ void UMCore_SettingsPanel::NativeOnInitialized()
 	Btn_ResetCategory->OnButtonClicked.AddDynamic(this, &ThisClass::HandleResetCategoryClicked);
 	Btn_Back->OnButtonClicked.AddDynamic(this, &ThisClass::HandleBackClicked);
 
+	if (Input_Search)
+	{
+		Input_Search->OnTextChanged.AddDynamic(this, &ThisClass::HandleSearchTextChanged);
+		Input_Search->OnTextCommitted.AddDynamic(this, &ThisClass::HandleSearchTextCommitted);
+	}
+	if (Panel_SearchResults) { Panel_SearchResults->SetVisibility(ESlateVisibility::Collapsed); }
+
 	UMCore_GameSettingsLibrary::OnSettingsConfirmationRequired.AddUObject(
 		this, &ThisClass::HandleConfirmationRequired);
+
+	BindRegistryPatchedDelegate();
 }
 
 void UMCore_SettingsPanel::NativeOnActivated()
@@ -123,6 +150,12 @@ void UMCore_SettingsPanel::NativeOnActivated()
 			Delegate.BindDynamic(this, &UMCore_SettingsPanel::HandleResetAllInput);
 			RegisterBinding(ResetDefaultsAction, Delegate, Handle);
 		}
+		if (!UndoSettingsAction.IsNull())
+		{
+			FInputActionExecutedDelegate Delegate;
+			Delegate.BindDynamic(this, &UMCore_SettingsPanel::HandleUndoInput);
+			RegisterBinding(UndoSettingsAction, Delegate, Handle);
+		}
 	}
 
 	/* Configure optional action bar icon buttons */
@@ -142,9 +175,17 @@ void UMCore_SettingsPanel::NativeOnActivated()
 		Btn_ResetCategory->OnButtonClicked.AddDynamic(this, &ThisClass::HandleResetCategoryClicked);
 		Btn_Back->OnButtonClicked.AddDynamic(this, &ThisClass::HandleBackClicked);
 
+		if (Input_Search)
+		{
+			Input_Search->OnTextChanged.AddDynamic(this, &ThisClass::HandleSearchTextChanged);
+			Input_Search->OnTextCommitted.AddDynamic(this, &ThisClass::HandleSearchTextCommitted);
+		}
+
 		UMCore_GameSettingsLibrary::OnSettingsConfirmationRequired.AddUObject(
 			this, &ThisClass::HandleConfirmationRequired);
 
+		BindRegistryPatchedDelegate();
+
 		/* BuildPanel internally clears stale state:
 		 *   ClearAllTabs() resets PageWidgets/TabList/PageSwitcher (fixes stale GetTabCount=5)
 		 *   Rebuilds SubContainer->OnTabSelected and Widget->OnSettingFocused delegates via helpers */
@@ -157,10 +198,11 @@ void UMCore_SettingsPanel::NativeOnActivated()
 	}
 	else
 	{
+		/* Only rows whose stored value moved while the panel was hidden re-read */
+		const int32 NumRefreshed = RefreshStaleWidgets();
 		UE_LOG(LogModulusSettings, Verbose,
-			TEXT("SettingsPanel::NativeOnActivated -- calling RefreshAllWidgets (re-activation, %d tabs exist)"),
-			TabbedContainer_Main->GetTabCount());
-		RefreshAllWidgets();
+			TEXT("SettingsPanel::NativeOnActivated -- refreshed %d of %d widget(s) (re-activation, %d tabs exist)"),
+			NumRefreshed, AllSettingWidgets.Num(), TabbedContainer_Main->GetTabCount());
 	}
 }
 
@@ -181,6 +223,17 @@ UWidget* UMCore_SettingsPanel::NativeGetDesiredFocusTarget() const
 	return Super::NativeGetDesiredFocusTarget();
 }
 
+void UMCore_SettingsPanel::NativeWarmUp()
+{
+	Super::NativeWarmUp();
+
+	/* A destructed panel rebinds its child delegates on activation; leave that path to it */
+	if (bNeedsFullRebuild || !TabbedContainer_Main || TabbedContainer_Main->GetTabCount() > 0) { return; }
+
+	UE_LOG(LogModulusSettings, Verbose, TEXT("SettingsPanel::NativeWarmUp -- building panel ahead of first activation"));
+	BuildPanel();
+}
+
 void UMCore_SettingsPanel::NativeOnDeactivated()
 {
 	UE_LOG(LogModulusSettings, Verbose, TEXT("SettingsPanel::NativeOnDeactivated -- this=%p, TabCount=%d"),
@@ -232,15 +285,23 @@ void UMCore_SettingsPanel::NativeDestruct()
 	}
 	SubTabContainers.Empty();
 	MainTabToSubContainer.Empty();
+	LeafTagToPage.Empty();
 
-	for (UMCore_SettingsWidget_Base* Widget : AllSettingWidgets)
+	ForEachSettingWidget([this](UMCore_SettingsWidget_Base& Widget)
+	{
+		Widget.OnSettingFocused.RemoveAll(this);
+	});
+	AllSettingWidgets.Empty();
+
+	for (const TPair<FGameplayTag, TObjectPtr<UMCore_SettingsListView>>& Pair : LeafTagToListPage)
 	{
-		if (IsValid(Widget))
+		if (IsValid(Pair.Value))
 		{
-			Widget->OnSettingFocused.RemoveAll(this);
+			Pair.Value->OnEntryWidgetGenerated().RemoveAll(this);
+			Pair.Value->OnItemSelectionChanged().RemoveAll(this);
 		}
 	}
-	AllSettingWidgets.Empty();
+	LeafTagToListPage.Empty();
 
 	if (PendingConfirmationDialog.IsValid())
 	{
@@ -249,6 +310,7 @@ void UMCore_SettingsPanel::NativeDestruct()
 	}
 
 	UMCore_GameSettingsLibrary::OnSettingsConfirmationRequired.RemoveAll(this);
+	UnbindRegistryPatchedDelegate();
 
 	if (ActiveRevertCountdown.IsValid())
 	{
@@ -262,6 +324,22 @@ void UMCore_SettingsPanel::NativeDestruct()
 	if (Btn_ResetCategory) { Btn_ResetCategory->OnButtonClicked.RemoveAll(this); }
 	if (Btn_Back) { Btn_Back->OnButtonClicked.RemoveAll(this); }
 
+	if (Input_Search)
+	{
+		Input_Search->OnTextChanged.RemoveAll(this);
+		Input_Search->OnTextCommitted.RemoveAll(this);
+	}
+
+	/* Result buttons are recreated on demand after the rebuild */
+	for (UMCore_ButtonBase* ResultButton : SearchResultButtons)
+	{
+		if (IsValid(ResultButton)) { ResultButton->OnClicked().RemoveAll(this); }
+	}
+	SearchResultButtons.Empty();
+	SearchResultTags.Empty();
+	SearchQuery.Reset();
+	if (Panel_SearchResults) { Panel_SearchResults->ClearChildren(); }
+
 	Super::NativeDestruct();
 }
 
@@ -275,6 +353,12 @@ void UMCore_SettingsPanel::OnCategoryPageCreated_Implementation(
 	/* Default: no-op. Blueprint subclasses can override to inject custom widgets. */
 }
 
+void UMCore_SettingsPanel::OnCategoryListCreated_Implementation(
+	const FGameplayTag& CategoryTag, UMCore_SettingsListView* PageListView)
+{
+	/* Default: no-op. */
+}
+
 void UMCore_SettingsPanel::OnPanelBuildComplete_Implementation()
 {
 	/* Default: no-op. Blueprint subclasses can override for post-build setup. */
@@ -303,16 +387,21 @@ void UMCore_SettingsPanel::BuildPanel()
 	AllSettingWidgets.Reset();
 	SubTabContainers.Reset();
 	MainTabToSubContainer.Reset();
+	LeafTagToPage.Reset();
+	LeafTagToListPage.Reset();
 
 	const TArray<FGameplayTag> AllCategories = CoreSettings->GetAllSettingsCategories();
 
 	/* Group depth-4 tags under their depth-3 parent, preserving encounter order */
 	TArray<FGameplayTag> MainTabOrder;
 	TMap<FGameplayTag, TArray<FGameplayTag>> ParentToChildren;
+	UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(this);
 
 	for (const FGameplayTag& LeafTag : AllCategories)
 	{
-		const FGameplayTag ParentTag = GetParentTag(LeafTag);
+		const FGameplayTag ParentTag = Collections
+			? Collections->GetCategoryParent(LeafTag)
+			: LeafTag.RequestDirectParent();
 		if (!ParentTag.IsValid())
 		{
 			continue;
@@ -399,17 +488,53 @@ void UMCore_SettingsPanel::BuildPanel()
 		}
 	}
 
+	/* Result slots point at rows of the previous build */
+	ClearSearch();
+
 	OnPanelBuildComplete();
 }
 
-UScrollBox* UMCore_SettingsPanel::BuildSinglePage(const FGameplayTag& SubcategoryTag)
+UWidget* UMCore_SettingsPanel::BuildSinglePage(const FGameplayTag& SubcategoryTag)
 {
-	UScrollBox* ScrollBox = NewObject<UScrollBox>(this);
-	PopulatePage(ScrollBox, SubcategoryTag);
+	UWidget* Page = CreateCategoryPage(SubcategoryTag);
+	NotifyCategoryPageCreated(SubcategoryTag, Page);
 
-	OnCategoryPageCreated(SubcategoryTag, ScrollBox);
+	return Page;
+}
+
+UWidget* UMCore_SettingsPanel::CreateCategoryPage(const FGameplayTag& CategoryTag)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	const TSubclassOf<UMCore_SettingsListView> ListViewClass = UMCore_SettingsListView::GetConfiguredClass();
+
+	if (!ListViewClass)
+	{
+		UScrollBox* ScrollBox = NewObject<UScrollBox>(this);
+		PopulatePage(ScrollBox, CategoryTag);
+		LeafTagToPage.Add(CategoryTag, ScrollBox);
+		return ScrollBox;
+	}
+
+	/* Built in this panel's tree: pooled rows find their owning player through it */
+	UMCore_SettingsListView* ListView = WidgetTree->ConstructWidget<UMCore_SettingsListView>(ListViewClass);
+	ListView->OnEntryWidgetGenerated().AddUObject(this, &ThisClass::HandleListEntryGenerated);
+	ListView->OnItemSelectionChanged().AddUObject(this, &ThisClass::HandleListSelectionChanged);
+	ListView->SetSettingDefinitions(
+		TArray<const UMCore_DA_SettingDefinition*>(CoreSettings->GetSettingsForCategory(CategoryTag)));
+	LeafTagToListPage.Add(CategoryTag, ListView);
+	return ListView;
+}
 
-	return ScrollBox;
+void UMCore_SettingsPanel::NotifyCategoryPageCreated(const FGameplayTag& CategoryTag, UWidget* Page)
+{
+	if (UScrollBox* ScrollBox = Cast<UScrollBox>(Page))
+	{
+		OnCategoryPageCreated(CategoryTag, ScrollBox);
+	}
+	else if (UMCore_SettingsListView* ListView = Cast<UMCore_SettingsListView>(Page))
+	{
+		OnCategoryListCreated(CategoryTag, ListView);
+	}
 }
 
 UMCore_TabbedContainer* UMCore_SettingsPanel::BuildTabbedPage(
@@ -432,15 +557,14 @@ UMCore_TabbedContainer* UMCore_SettingsPanel::BuildTabbedPage(
 	for (const FGameplayTag& ChildTag : ChildTags)
 	{
 		const FName SubTabID = FName(*ChildTag.ToString());
-		UScrollBox* SubPage = NewObject<UScrollBox>(this);
-		PopulatePage(SubPage, ChildTag);
+		UWidget* SubPage = CreateCategoryPage(ChildTag);
 
 		if (SubContainer->AddTab(SubTabID, SubPage))
 		{
 			SetTabButtonLabel(SubContainer, SubTabID, ChildTag);
 			TabIDToLeafTag.Add(SubTabID, ChildTag);
 
-			OnCategoryPageCreated(ChildTag, SubPage);
+			NotifyCategoryPageCreated(ChildTag, SubPage);
 
 			if (FirstSubTabID.IsNone())
 			{
@@ -492,35 +616,13 @@ void UMCore_SettingsPanel::PopulatePage(
 UMCore_SettingsWidget_Base* UMCore_SettingsPanel::CreateSettingWidget(
 	const UMCore_DA_SettingDefinition* Definition)
 {
-	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
 	UMCore_SettingsWidget_Base* Widget = nullptr;
 
-	if (Definition->WidgetClassOverride)
+	/* Same class choice virtualized pages make per row */
+	if (const TSubclassOf<UMCore_SettingsWidget_Base> WidgetClass =
+		UMCore_SettingsListView::ResolveSettingWidgetClass(Definition))
 	{
-		Widget = CreateWidget<UMCore_SettingsWidget_Base>(this, Definition->WidgetClassOverride);
-	}
-
-	if (!Widget)
-	{
-		switch (Definition->SettingType)
-		{
-		case EMCore_SettingType::Toggle:
-		case EMCore_SettingType::Dropdown:
-			if (CoreSettings->SettingsSwitcherWidgetClass)
-			{
-				Widget = CreateWidget<UMCore_SettingsWidget_Switcher>(
-					this, CoreSettings->SettingsSwitcherWidgetClass);
-			}
-			break;
-
-		case EMCore_SettingType::Slider:
-			if (CoreSettings->SettingsSliderWidgetClass)
-			{
-				Widget = CreateWidget<UMCore_SettingsWidget_Slider>(
-					this, CoreSettings->SettingsSliderWidgetClass);
-			}
-			break;
-		}
+		Widget = CreateWidget<UMCore_SettingsWidget_Base>(this, WidgetClass);
 	}
 
 	if (Widget)
@@ -537,6 +639,150 @@ UMCore_SettingsWidget_Base* UMCore_SettingsPanel::CreateSettingWidget(
 	return Widget;
 }
 
+void UMCore_SettingsPanel::ForEachSettingWidget(TFunctionRef<void(UMCore_SettingsWidget_Base&)> Callback) const
+{
+	for (UMCore_SettingsWidget_Base* Widget : AllSettingWidgets)
+	{
+		if (IsValid(Widget)) { Callback(*Widget); }
+	}
+
+	for (const TPair<FGameplayTag, TObjectPtr<UMCore_SettingsListView>>& Pair : LeafTagToListPage)
+	{
+		if (!IsValid(Pair.Value)) { continue; }
+
+		for (UMCore_SettingsWidget_Base* Widget : Pair.Value->GetDisplayedSettingWidgets())
+		{
+			Callback(*Widget);
+		}
+	}
+}
+
+void UMCore_SettingsPanel::HandleListEntryGenerated(UUserWidget& EntryWidget)
+{
+	if (UMCore_SettingsWidget_Base* Widget = Cast<UMCore_SettingsWidget_Base>(&EntryWidget))
+	{
+		Widget->OnSettingFocused.AddUniqueDynamic(this, &ThisClass::HandleSettingFocused);
+	}
+}
+
+void UMCore_SettingsPanel::HandleListSelectionChanged(UObject* Item)
+{
+	const UMCore_SettingsListItem* Row = Cast<UMCore_SettingsListItem>(Item);
+	if (Row && Row->Definition)
+	{
+		HandleSettingFocused(Row->Definition->SettingTag, Row->Definition->Description);
+	}
+}
+
+// ============================================================================
+// REGISTRY HOT RELOAD
+// ============================================================================
+
+void UMCore_SettingsPanel::BindRegistryPatchedDelegate()
+{
+	if (UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(this))
+	{
+		RegistryPatchedHandle = Collections->OnRegistryPatched.AddUObject(
+			this, &ThisClass::HandleSettingsRegistryPatched);
+	}
+}
+
+void UMCore_SettingsPanel::UnbindRegistryPatchedDelegate()
+{
+	if (UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(this))
+	{
+		Collections->OnRegistryPatched.Remove(RegistryPatchedHandle);
+	}
+	RegistryPatchedHandle.Reset();
+}
+
+void UMCore_SettingsPanel::HandleSettingsRegistryPatched(const FMCore_SettingsRegistryChange& Change)
+{
+	/* Not built yet -- the first BuildPanel reads the patched registry anyway */
+	if (TabbedContainer_Main->GetTabCount() == 0) { return; }
+
+	if (Change.bCategoryLayoutChanged)
+	{
+		UE_LOG(LogModulusSettings, Log,
+			TEXT("SettingsPanel::HandleSettingsRegistryPatched -- category layout changed, rebuilding panel"));
+		BuildPanel();
+		return;
+	}
+
+	for (const FGameplayTag& CategoryTag : Change.AffectedCategories)
+	{
+		if (!RebuildCategoryPage(CategoryTag))
+		{
+			BuildPanel();
+			return;
+		}
+	}
+
+	for (const TWeakObjectPtr<const UMCore_DA_SettingDefinition>& ChangedDefinition : Change.ChangedDefinitions)
+	{
+		const UMCore_DA_SettingDefinition* Definition = ChangedDefinition.Get();
+		if (!Definition) { continue; }
+
+		/* Fresh row items re-initialize every list entry showing the definition, pooled ones included */
+		if (UMCore_SettingsListView* ListPage = LeafTagToListPage.FindRef(Definition->CategoryTag))
+		{
+			ListPage->SetSettingDefinitions(TArray<const UMCore_DA_SettingDefinition*>(
+				UMCore_CoreSettings::Get()->GetSettingsForCategory(Definition->CategoryTag)));
+			continue;
+		}
+
+		for (UMCore_SettingsWidget_Base* Widget : AllSettingWidgets)
+		{
+			if (IsValid(Widget) && Widget->GetSettingDefinition() == Definition)
+			{
+				Widget->InitFromDefinition(Definition);
+			}
+		}
+	}
+
+	UE_LOG(LogModulusSettings, Verbose,
+		TEXT("SettingsPanel::HandleSettingsRegistryPatched -- %d page(s) rebuilt, %d row(s) re-initialized"),
+		Change.AffectedCategories.Num(), Change.ChangedDefinitions.Num());
+}
+
+bool UMCore_SettingsPanel::RebuildCategoryPage(const FGameplayTag& CategoryTag)
+{
+	if (UMCore_SettingsListView* ListPage = LeafTagToListPage.FindRef(CategoryTag))
+	{
+		ListPage->SetSettingDefinitions(TArray<const UMCore_DA_SettingDefinition*>(
+			UMCore_CoreSettings::Get()->GetSettingsForCategory(CategoryTag)));
+		OnCategoryListCreated(CategoryTag, ListPage);
+
+		if (ActiveLeafCategory == CategoryTag)
+		{
+			FocusFirstWidgetInActivePage();
+		}
+		return true;
+	}
+
+	UScrollBox* ScrollBox = LeafTagToPage.FindRef(CategoryTag);
+	if (!IsValid(ScrollBox)) { return false; }
+
+	AllSettingWidgets.RemoveAll([ScrollBox, this](const TObjectPtr<UMCore_SettingsWidget_Base>& Widget)
+	{
+		if (!IsValid(Widget)) { return true; }
+		if (Widget->GetParent() != ScrollBox) { return false; }
+
+		Widget->OnSettingFocused.RemoveAll(this);
+		return true;
+	});
+
+	ScrollBox->ClearChildren();
+	PopulatePage(ScrollBox, CategoryTag);
+	OnCategoryPageCreated(CategoryTag, ScrollBox);
+
+	if (ActiveLeafCategory == CategoryTag)
+	{
+		FocusFirstWidgetInActivePage();
+	}
+	return true;
+}
+
 // ============================================================================
 // TAB CALLBACKS
 // ============================================================================
@@ -577,18 +823,19 @@ void UMCore_SettingsPanel::FocusFirstWidgetInActivePage()
 	const FName ActiveMainTab = TabbedContainer_Main->GetSelectedTabID();
 	UWidget* Page = TabbedContainer_Main->GetPageWidget(ActiveMainTab);
 
-	UScrollBox* ScrollBox = nullptr;
-
 	if (UMCore_TabbedContainer* SubContainer = Cast<UMCore_TabbedContainer>(Page))
 	{
 		const FName ActiveSubTab = SubContainer->GetSelectedTabID();
-		ScrollBox = Cast<UScrollBox>(SubContainer->GetPageWidget(ActiveSubTab));
+		Page = SubContainer->GetPageWidget(ActiveSubTab);
 	}
-	else
+
+	if (UMCore_SettingsListView* ListView = Cast<UMCore_SettingsListView>(Page))
 	{
-		ScrollBox = Cast<UScrollBox>(Page);
+		ListView->FocusFirstSetting();
+		return;
 	}
 
+	UScrollBox* ScrollBox = Cast<UScrollBox>(Page);
 	if (ScrollBox && ScrollBox->GetChildrenCount() > 0)
 	{
 		if (UWidget* FirstChild = ScrollBox->GetChildAt(0))
@@ -618,7 +865,7 @@ void UMCore_SettingsPanel::HandleResetAllClicked()
 	{
 		/** No dialog configured, reset directly as safety net */
 		UMCore_GameSettingsLibrary::ResetAllSettingsToDefault(GetOwningLocalPlayer());
-		RefreshAllWidgets();
+		RefreshStaleWidgets();
 		return;
 	}
 	
@@ -648,7 +895,7 @@ void UMCore_SettingsPanel::HandleResetAllConfirmResult(bool bConfirmed)
 	if (bConfirmed)
 	{
 		UMCore_GameSettingsLibrary::ResetAllSettingsToDefault(GetOwningLocalPlayer());
-		RefreshAllWidgets();
+		RefreshStaleWidgets();
 	}
 }
 
@@ -671,7 +918,7 @@ void UMCore_SettingsPanel::HandleResetCategoryClicked()
 		/** No dialog configured, reset directly as safety net */
 		UMCore_GameSettingsLibrary::ResetCategoryToDefault(
 			GetOwningLocalPlayer(), ActiveLeafCategory);
-		RefreshAllWidgets();
+		RefreshStaleWidgets();
 		return;
 	}
 	
@@ -704,7 +951,7 @@ void UMCore_SettingsPanel::HandleResetCategoryConfirmResult(bool bConfirmed)
 	{
 		UMCore_GameSettingsLibrary::ResetCategoryToDefault(
 			GetOwningLocalPlayer(), ActiveLeafCategory);
-		RefreshAllWidgets();
+		RefreshStaleWidgets();
 	}
 }
 
@@ -713,8 +960,8 @@ void UMCore_SettingsPanel::SpawnRevertCountdown()
 	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
 	if (!CoreSettings || !CoreSettings->SettingsRevertCountdownClass)
 	{
-		/** No countdown class configured. Save + clear pending */
-		UMCore_GameSettingsLibrary::SavePlayerSettings(this);
+		/** No countdown class configured. Confirm + clear pending */
+		UMCore_GameSettingsLibrary::ConfirmPendingSettings(this);
 		PendingConfirmationTags.Empty();
 		return;
 	}
@@ -724,7 +971,7 @@ void UMCore_SettingsPanel::SpawnRevertCountdown()
 		: nullptr;
 	if (!UISubsystem)
 	{
-		UMCore_GameSettingsLibrary::SavePlayerSettings(this);
+		UMCore_GameSettingsLibrary::ConfirmPendingSettings(this);
 		PendingConfirmationTags.Empty();
 		return;
 	}
@@ -736,7 +983,7 @@ void UMCore_SettingsPanel::SpawnRevertCountdown()
 	UMCore_SettingsRevertCountdown* Countdown = Cast<UMCore_SettingsRevertCountdown>(Widget);
 	if (!Countdown)
 	{
-		UMCore_GameSettingsLibrary::SavePlayerSettings(this);
+		UMCore_GameSettingsLibrary::ConfirmPendingSettings(this);
 		PendingConfirmationTags.Empty();
 		return;
 	}
@@ -796,7 +1043,7 @@ void UMCore_SettingsPanel::HandleCountdownResult(bool bConfirmed)
 	}
 
 	PendingConfirmationTags.Empty();
-	RefreshAllWidgets();
+	RefreshStaleWidgets();
 }
 
 void UMCore_SettingsPanel::HandleBackClicked()
@@ -846,6 +1093,14 @@ void UMCore_SettingsPanel::HandleResetAllInput(FName ActionName)
 	HandleResetAllClicked();
 }
 
+void UMCore_SettingsPanel::HandleUndoInput(FName ActionName)
+{
+	if (UMCore_GameSettingsLibrary::UndoLastSettingsChange(GetOwningLocalPlayer()))
+	{
+		RefreshStaleWidgets();
+	}
+}
+
 // ============================================================================
 // SETTING FOCUS
 // ============================================================================
@@ -858,6 +1113,158 @@ void UMCore_SettingsPanel::HandleSettingFocused(FGameplayTag SettingTag, FText D
 	}
 }
 
+bool UMCore_SettingsPanel::JumpToSetting(FGameplayTag SettingTag)
+{
+	UMCore_SettingsWidget_Base* Row = nullptr;
+	for (UMCore_SettingsWidget_Base* Widget : AllSettingWidgets)
+	{
+		if (IsValid(Widget) && Widget->GetSettingTag() == SettingTag)
+		{
+			Row = Widget;
+			break;
+		}
+	}
+
+	UScrollBox* Page = nullptr;
+	UMCore_SettingsListView* ListPage = nullptr;
+	FGameplayTag LeafTag;
+
+	if (Row)
+	{
+		LeafTag = Row->GetSettingDefinition()->CategoryTag;
+		Page = LeafTagToPage.FindRef(LeafTag);
+	}
+	else
+	{
+		/* List rows only have widgets while in view; search the row data instead */
+		for (const TPair<FGameplayTag, TObjectPtr<UMCore_SettingsListView>>& Pair : LeafTagToListPage)
+		{
+			if (IsValid(Pair.Value) && Pair.Value->FindSettingIndex(SettingTag) != INDEX_NONE)
+			{
+				LeafTag = Pair.Key;
+				ListPage = Pair.Value;
+				break;
+			}
+		}
+	}
+
+	if (!IsValid(Page) && !ListPage)
+	{
+		UE_LOG(LogModulusSettings, Verbose,
+			TEXT("SettingsPanel::JumpToSetting -- no row for '%s' in this panel"), *SettingTag.ToString());
+		return false;
+	}
+
+	UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(this);
+	const FGameplayTag ParentTag = Collections
+		? Collections->GetCategoryParent(LeafTag)
+		: LeafTag.RequestDirectParent();
+	const FName MainTabID = FName(*ParentTag.ToString());
+
+	/* Sub-tab first so the main tab's selection callback resolves the right leaf page */
+	if (UMCore_TabbedContainer* SubContainer = MainTabToSubContainer.FindRef(MainTabID))
+	{
+		SubContainer->SelectTab(FName(*LeafTag.ToString()));
+	}
+	TabbedContainer_Main->SelectTab(MainTabID);
+	ActiveLeafCategory = LeafTag;
+
+	if (ListPage)
+	{
+		return ListPage->FocusSetting(SettingTag);
+	}
+
+	Page->ScrollWidgetIntoView(Row, true, EDescendantScrollDestination::Center);
+	Row->SetUserFocus(GetOwningPlayer());
+	return true;
+}
+
+// ============================================================================
+// SEARCH
+// ============================================================================
+
+void UMCore_SettingsPanel::HandleSearchTextChanged(const FText& Text)
+{
+	if (UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(this))
+	{
+		SearchQuery.SetIndex(Collections->GetSearchIndex());
+	}
+
+	SearchQuery.Update(Text.ToString());
+	RefreshSearchResults();
+}
+
+void UMCore_SettingsPanel::HandleSearchTextCommitted(const FText& Text, ETextCommit::Type CommitMethod)
+{
+	if (CommitMethod != ETextCommit::OnEnter || SearchResultTags.IsEmpty()) { return; }
+
+	JumpToSetting(SearchResultTags[0]);
+}
+
+void UMCore_SettingsPanel::HandleSearchResultClicked(int32 ResultSlot)
+{
+	if (SearchResultTags.IsValidIndex(ResultSlot))
+	{
+		JumpToSetting(SearchResultTags[ResultSlot]);
+	}
+}
+
+void UMCore_SettingsPanel::RefreshSearchResults()
+{
+	const FMCore_SettingsSearchIndex* Index = SearchQuery.GetIndex();
+	const TConstArrayView<FMCore_SettingSearchHit> Hits = SearchQuery.GetHits();
+	const int32 NumShown = Index ? FMath::Min(Hits.Num(), MaxSearchResults) : 0;
+
+	SearchResultTags.Reset();
+	for (int32 ResultSlot = 0; ResultSlot < NumShown; ++ResultSlot)
+	{
+		SearchResultTags.Add(Index->GetDefinition(Hits[ResultSlot].Entry)->SettingTag);
+	}
+
+	if (!Panel_SearchResults) { return; }
+
+	/* Pool grows to MaxSearchResults once; later keystrokes only relabel */
+	while (SearchResultButtons.Num() < NumShown && SearchResultButtonClass)
+	{
+		UMCore_ButtonBase* ResultButton = CreateWidget<UMCore_ButtonBase>(this, SearchResultButtonClass);
+		if (!ResultButton) { break; }
+
+		ResultButton->OnClicked().AddUObject(this, &ThisClass::HandleSearchResultClicked, SearchResultButtons.Num());
+		Panel_SearchResults->AddChild(ResultButton);
+		SearchResultButtons.Add(ResultButton);
+	}
+
+	for (int32 ResultSlot = 0; ResultSlot < SearchResultButtons.Num(); ++ResultSlot)
+	{
+		UMCore_ButtonBase* ResultButton = SearchResultButtons[ResultSlot];
+		if (!IsValid(ResultButton)) { continue; }
+
+		if (ResultSlot < NumShown)
+		{
+			const int32 Entry = Hits[ResultSlot].Entry;
+			ResultButton->SetButtonText(FText::Format(
+				NSLOCTEXT("ModulusCore", "SettingsSearchResult", "{0}  ({1})"),
+				Index->GetDefinition(Entry)->DisplayName, Index->GetCategoryPath(Entry)));
+			ResultButton->SetVisibility(ESlateVisibility::Visible);
+		}
+		else
+		{
+			ResultButton->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+
+	Panel_SearchResults->SetVisibility(NumShown > 0
+		? ESlateVisibility::SelfHitTestInvisible
+		: ESlateVisibility::Collapsed);
+}
+
+void UMCore_SettingsPanel::ClearSearch()
+{
+	SearchQuery.Reset();
+	if (Input_Search) { Input_Search->SetText(FText::GetEmpty()); }
+	RefreshSearchResults();
+}
+
 
 
 // ============================================================================
@@ -866,11 +1273,137 @@ void UMCore_SettingsPanel::HandleSettingFocused(FGameplayTag SettingTag, FText D
 
 void UMCore_SettingsPanel::RefreshAllWidgets()
 {
-	for (UMCore_SettingsWidget_Base* Widget : AllSettingWidgets)
+	/* List rows out of view re-read when they are next bound to a row */
+	ForEachSettingWidget([](UMCore_SettingsWidget_Base& Widget)
+	{
+		Widget.RefreshValueAndRecordVersion();
+	});
+}
+
+int32 UMCore_SettingsPanel::RefreshStaleWidgets()
+{
+	int32 NumRefreshed = 0;
+	ForEachSettingWidget([&NumRefreshed](UMCore_SettingsWidget_Base& Widget)
+	{
+		if (Widget.RefreshValueIfStale())
+		{
+			++NumRefreshed;
+		}
+	});
+	return NumRefreshed;
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if !UE_BUILD_SHIPPING
+void UMCore_SettingsPanel::RunListBenchmark(int32 NumSettings)
+{
+	NumSettings = FMath::Max(NumSettings, 1);
+
+	const TSubclassOf<UMCore_SettingsListView> ListViewClass = UMCore_SettingsListView::GetConfiguredClass();
+	if (!ListViewClass || !FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsPanel::RunListBenchmark -- needs a configured SettingsListViewClass and a Slate renderer"));
+		return;
+	}
+
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	TArray<const UMCore_DA_SettingDefinition*> SourceDefinitions;
+	for (const FGameplayTag& CategoryTag : CoreSettings->GetAllSettingsCategories())
+	{
+		for (const UMCore_DA_SettingDefinition* Definition : CoreSettings->GetSettingsForCategory(CategoryTag))
+		{
+			if (Definition && Definition->IsValid() && UMCore_SettingsListView::ResolveSettingWidgetClass(Definition))
+			{
+				SourceDefinitions.Add(Definition);
+			}
+		}
+	}
+
+	if (SourceDefinitions.IsEmpty())
+	{
+		UE_LOG(LogModulusSettings, Warning,
+			TEXT("SettingsPanel::RunListBenchmark -- no displayable setting definitions to build rows from"));
+		return;
+	}
+
+	/* The project's own definitions repeated, so every row pays a real row's value reads */
+	TArray<const UMCore_DA_SettingDefinition*> Definitions;
+	Definitions.Reserve(NumSettings);
+	for (int32 Index = 0; Index < NumSettings; ++Index)
 	{
-		if (Widget)
+		Definitions.Add(SourceDefinitions[Index % SourceDefinitions.Num()]);
+	}
+
+	/* Both pages are drawn offscreen as a full 1080p page; neither is added to the panel.
+	 * DrawWidget runs prepass, arrange and paint on the game thread, the cost a visible page pays. */
+	const FVector2D PageSize(1920.0, 1080.0);
+	const FGeometry PageGeometry = FGeometry::MakeRoot(PageSize, FSlateLayoutTransform());
+	FWidgetRenderer Renderer(/*bUseGammaCorrection*/ false, /*bInClearTarget*/ true);
+	UTextureRenderTarget2D* RenderTarget = FWidgetRenderer::CreateTargetFor(PageSize, TF_Default, false);
+
+	/* Scroll box: one initialized widget per setting */
+	double StartSeconds = FPlatformTime::Seconds();
+	UScrollBox* ScrollBox = WidgetTree->ConstructWidget<UScrollBox>();
+	for (const UMCore_DA_SettingDefinition* Definition : Definitions)
+	{
+		if (UMCore_SettingsWidget_Base* Widget = CreateSettingWidget(Definition))
 		{
-			Widget->RefreshValueFromSettings();
+			ScrollBox->AddChild(Widget);
 		}
 	}
-}
\ No newline at end of file
+	const double ScrollBuildMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	StartSeconds = FPlatformTime::Seconds();
+	TSharedPtr<SWidget> ScrollSlate = ScrollBox->TakeWidget();
+	Renderer.DrawWidget(RenderTarget, ScrollSlate.ToSharedRef(), PageSize, 0.0f);
+	const double ScrollPaintMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	const int32 ScrollRowWidgets = ScrollBox->GetChildrenCount();
+
+	/* List: row items only; entries are generated by the list's tick for what fits the page */
+	StartSeconds = FPlatformTime::Seconds();
+	UMCore_SettingsListView* ListView = WidgetTree->ConstructWidget<UMCore_SettingsListView>(ListViewClass);
+	ListView->SetSettingDefinitions(Definitions);
+	const double ListBuildMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	StartSeconds = FPlatformTime::Seconds();
+	TSharedPtr<SWidget> ListSlate = ListView->TakeWidget();
+	ListSlate->SlatePrepass(1.0f);
+	ListSlate->Tick(PageGeometry, FPlatformTime::Seconds(), 0.0f);
+	Renderer.DrawWidget(RenderTarget, ListSlate.ToSharedRef(), PageSize, 0.0f);
+	const double ListPaintMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	const int32 ListRowWidgets = ListView->GetDisplayedEntryWidgets().Num();
+
+	/* One tick applies the scroll, the next regenerates the rows at the new offset from the pool */
+	StartSeconds = FPlatformTime::Seconds();
+	ListView->ScrollToBottom();
+	ListSlate->Tick(PageGeometry, FPlatformTime::Seconds(), 0.0f);
+	ListSlate->Tick(PageGeometry, FPlatformTime::Seconds(), 0.0f);
+	Renderer.DrawWidget(RenderTarget, ListSlate.ToSharedRef(), PageSize, 0.0f);
+	const double ListScrollMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	UE_LOG(LogModulusSettings, Display,
+		TEXT("SettingsPanel::RunListBenchmark -- %d settings (%d distinct definitions), 1920x1080 page"),
+		NumSettings, SourceDefinitions.Num());
+	UE_LOG(LogModulusSettings, Display, TEXT("  %-10s %10s %10s %10s %12s"),
+		TEXT("Page"), TEXT("Build ms"), TEXT("Paint ms"), TEXT("Scroll ms"), TEXT("Row widgets"));
+	UE_LOG(LogModulusSettings, Display, TEXT("  %-10s %10.2f %10.2f %10s %12d"),
+		TEXT("ScrollBox"), ScrollBuildMs, ScrollPaintMs, TEXT("-"), ScrollRowWidgets);
+	UE_LOG(LogModulusSettings, Display, TEXT("  %-10s %10.2f %10.2f %10.2f %12d"),
+		TEXT("ListView"), ListBuildMs, ListPaintMs, ListScrollMs, ListRowWidgets);
+
+	/* Drop both pages from the panel's tree; rows go with them on the next GC */
+	ScrollSlate.Reset();
+	ListSlate.Reset();
+	ScrollBox->ClearChildren();
+	ListView->ClearListItems();
+	ScrollBox->ReleaseSlateResources(true);
+	ListView->ReleaseSlateResources(true);
+	ScrollBox->MarkAsGarbage();
+	ListView->MarkAsGarbage();
+	RenderTarget->MarkAsGarbage();
+}
+#endif
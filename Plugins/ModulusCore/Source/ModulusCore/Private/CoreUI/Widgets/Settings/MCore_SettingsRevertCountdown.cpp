@@ -16,6 +16,9 @@ UMCore_SettingsRevertCountdown::UMCore_SettingsRevertCountdown(
 	: Super(ObjectInitializer)
 {
 	bShouldFocusOnActivation = true;
+
+	/* Owns a running revert timer and the pending change set; always a fresh instance */
+	bAllowPooling = false;
 }
 
 // ============================================================================
@@ -186,10 +189,10 @@ void UMCore_SettingsRevertCountdown::ApplySettings(bool bConfirmed)
 {
 	if (bConfirmed)
 	{
-		UMCore_GameSettingsLibrary::SavePlayerSettings(this);
+		UMCore_GameSettingsLibrary::ConfirmPendingSettings(this);
 	}
 	else
 	{
-		UMCore_GameSettingsLibrary::ReloadAndApplyFromDisk(this);
+		UMCore_GameSettingsLibrary::RevertPendingSettings(this);
 	}
 }
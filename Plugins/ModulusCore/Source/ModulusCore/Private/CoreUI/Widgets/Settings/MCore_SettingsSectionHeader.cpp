@@ -0,0 +1,62 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "CoreUI/Widgets/Settings/MCore_SettingsSectionHeader.h"
+
+#include "CoreData/Assets/UI/Themes/MCore_PDA_UITheme_Base.h"
+#include "CoreData/Libraries/MCore_ThemeLibrary.h"
+#include "CoreUI/MCore_UISubsystem.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsListView.h"
+
+#include "CommonTextBlock.h"
+#include "Engine/LocalPlayer.h"
+
+void UMCore_SettingsSectionHeader::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (ULocalPlayer* LocalPlayer = GetOwningLocalPlayer())
+	{
+		if (UMCore_UISubsystem* UI = LocalPlayer->GetSubsystem<UMCore_UISubsystem>())
+		{
+			UI->OnThemeChanged.AddDynamic(this, &ThisClass::HandleThemeChanged);
+			HandleThemeChanged(UI->GetActiveTheme());
+		}
+	}
+}
+
+void UMCore_SettingsSectionHeader::NativeDestruct()
+{
+	if (ULocalPlayer* LocalPlayer = GetOwningLocalPlayer())
+	{
+		if (UMCore_UISubsystem* UI = LocalPlayer->GetSubsystem<UMCore_UISubsystem>())
+		{
+			UI->OnThemeChanged.RemoveAll(this);
+		}
+	}
+
+	Super::NativeDestruct();
+}
+
+void UMCore_SettingsSectionHeader::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	const UMCore_SettingsListItem* Item = Cast<UMCore_SettingsListItem>(ListItemObject);
+	SectionName = Item ? Item->SectionName : FText::GetEmpty();
+
+	if (Txt_SectionName)
+	{
+		Txt_SectionName->SetText(SectionName);
+	}
+
+	K2_OnSectionSet(SectionName);
+}
+
+void UMCore_SettingsSectionHeader::HandleThemeChanged(UMCore_PDA_UITheme_Base* NewTheme)
+{
+	if (NewTheme)
+	{
+		UMCore_ThemeLibrary::ApplyThemeTextStyle(
+			GetOwningLocalPlayer(), Txt_SectionName, NewTheme, EMCore_ThemeTextRole::Heading);
+	}
+}
@@ -9,8 +9,12 @@
 #include "CoreData/Types/Events/MCore_EventData.h"
 #include "CoreEvents/MCore_LocalEventSubsystem.h"
 #include "CoreUI/MCore_UISubsystem.h"
+#include "CoreUI/Widgets/Settings/MCore_SettingsListView.h"
 #include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
 #include "CoreData/Libraries/MCore_ThemeLibrary.h"
+#include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
+#include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
 
 #include "Engine/LocalPlayer.h"
 #include "CommonTextBlock.h"
@@ -49,7 +53,10 @@ void UMCore_SettingsWidget_Base::InitFromDefinition(const UMCore_DA_SettingDefin
 		*InDefinition->SettingTag.ToString(),
 		*GetNameSafe(this));
 
+	/* OnDefinitionSet reads the current value in every subclass */
+	DisplayedValueVersion = GetSourceValueVersion();
 	OnDefinitionSet(InDefinition);
+	SetSettingEnabled(UMCore_GameSettingsLibrary::IsSettingEnabled(this, InDefinition));
 }
 
 FGameplayTag UMCore_SettingsWidget_Base::GetSettingTag() const
@@ -73,6 +80,40 @@ void UMCore_SettingsWidget_Base::RefreshValueFromSettings_Implementation()
 	/* No-op. Derived classes fetch their values and update visuals */
 }
 
+bool UMCore_SettingsWidget_Base::RefreshValueIfStale()
+{
+	if (!IsValueStale()) { return false; }
+
+	RefreshValueAndRecordVersion();
+	return true;
+}
+
+bool UMCore_SettingsWidget_Base::IsValueStale() const
+{
+	return SettingDefinition != nullptr && GetSourceValueVersion() != DisplayedValueVersion;
+}
+
+void UMCore_SettingsWidget_Base::RefreshValueAndRecordVersion()
+{
+	DisplayedValueVersion = GetSourceValueVersion();
+	RefreshValueFromSettings();
+}
+
+uint64 UMCore_SettingsWidget_Base::GetSourceValueVersion() const
+{
+	const UMCore_PlayerSettingsSave* Save = GetPlayerSave();
+	return Save ? Save->GetValueVersion(SettingDefinition) : 0;
+}
+
+UMCore_PlayerSettingsSave* UMCore_SettingsWidget_Base::GetPlayerSave() const
+{
+	const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+	UMCore_PlayerSettingsSubsystem* Subsystem = LocalPlayer
+		? LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>()
+		: nullptr;
+	return Subsystem ? Subsystem->GetPlayerSettings() : nullptr;
+}
+
 FString UMCore_SettingsWidget_Base::GetValueAsString_Implementation() const
 {
 	return TEXT("(not implemented)");
@@ -86,6 +127,15 @@ void UMCore_SettingsWidget_Base::StepRight_Implementation()
 {
 }
 
+void UMCore_SettingsWidget_Base::SetSettingEnabled(bool bEnabled)
+{
+	if (bIsSettingEnabled == bEnabled && GetIsEnabled() == bEnabled) { return; }
+
+	bIsSettingEnabled = bEnabled;
+	SetIsEnabled(bEnabled);
+	K2_OnSettingEnabledChanged(bEnabled);
+}
+
 // ============================================================================
 // SUBCLASS SUPPORT
 // ============================================================================
@@ -118,8 +168,8 @@ void UMCore_SettingsWidget_Base::ApplyTheme_Implementation(UMCore_PDA_UITheme_Ba
 {
 	if (NewTheme)
 	{
-		UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-			GetOwningLocalPlayer(), Txt_SettingName, NewTheme->LabelTextStyle);
+		UMCore_ThemeLibrary::ApplyThemeTextStyle(
+			GetOwningLocalPlayer(), Txt_SettingName, NewTheme, EMCore_ThemeTextRole::Label);
 	}
 
 	K2_OnThemeApplied(NewTheme);
@@ -165,6 +215,31 @@ void UMCore_SettingsWidget_Base::UnbindThemeDelegate()
 	bThemeDelegateBound = false;
 }
 
+// ============================================================================
+// LIST ENTRY
+// ============================================================================
+
+void UMCore_SettingsWidget_Base::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	const UMCore_SettingsListItem* Item = Cast<UMCore_SettingsListItem>(ListItemObject);
+	const UMCore_DA_SettingDefinition* Definition = Item ? Item->Definition.Get() : nullptr;
+	if (!Definition) { return; }
+
+	/* A new item means the page was rebuilt, possibly for an edited definition */
+	if (Definition != SettingDefinition || ListItemObject != BoundListItem.Get())
+	{
+		BoundListItem = ListItemObject;
+		InitFromDefinition(Definition);
+		return;
+	}
+
+	/* Same row scrolled back into view; its events kept firing while it sat in the pool */
+	SetSettingEnabled(UMCore_GameSettingsLibrary::IsSettingEnabled(this, Definition));
+	RefreshValueIfStale();
+}
+
 // ============================================================================
 // LIFECYCLE
 // ============================================================================
@@ -194,6 +269,9 @@ void UMCore_SettingsWidget_Base::NativeOnInitialized()
 				this, &UMCore_SettingsWidget_Base::HandleLocalEvent);
 		}
 	}
+
+	DependentsUpdatedHandle = UMCore_GameSettingsLibrary::OnSettingDependentsUpdated.AddUObject(
+		this, &UMCore_SettingsWidget_Base::HandleDependentsUpdated);
 }
 
 void UMCore_SettingsWidget_Base::NativeDestruct()
@@ -210,15 +288,40 @@ void UMCore_SettingsWidget_Base::NativeDestruct()
 		EventSubscriptionHandle.Reset();
 	}
 
+	UMCore_GameSettingsLibrary::OnSettingDependentsUpdated.Remove(DependentsUpdatedHandle);
+	DependentsUpdatedHandle.Reset();
+
 	UnbindThemeDelegate();
 	Super::NativeDestruct();
 }
 
 void UMCore_SettingsWidget_Base::HandleLocalEvent(const FMCore_EventData& EventData)
 {
-	if (EventData.EventTag.MatchesTagExact(MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange)
-		&& SettingDefinition != nullptr)
+	if (!EventData.EventTag.MatchesTagExact(MCore_SettingsTags::MCore_Settings_Event_ExternalValueChange)
+		|| SettingDefinition == nullptr)
+	{
+		return;
+	}
+
+	/* The event doesn't name what changed; the version check keeps every other row to one compare */
+	if (SettingDefinition->Dependencies.Num() > 0)
+	{
+		SetSettingEnabled(UMCore_GameSettingsLibrary::IsSettingEnabled(this, SettingDefinition));
+	}
+	RefreshValueIfStale();
+}
+
+void UMCore_SettingsWidget_Base::HandleDependentsUpdated(const FMCore_SettingDependencyUpdate& Update)
+{
+	if (!SettingDefinition) { return; }
+
+	if (const bool* bEnabled = Update.EnabledStates.Find(SettingDefinition->SettingTag))
+	{
+		SetSettingEnabled(*bEnabled);
+	}
+
+	if (Update.ValueChangedTags.Contains(SettingDefinition->SettingTag))
 	{
-		RefreshValueFromSettings();
+		RefreshValueAndRecordVersion();
 	}
 }
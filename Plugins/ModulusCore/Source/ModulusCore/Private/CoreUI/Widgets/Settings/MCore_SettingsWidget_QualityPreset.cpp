@@ -48,3 +48,12 @@ int32 UMCore_SettingsWidget_QualityPreset::ResolveDisplayedIndex_Implementation(
 		Intent);
 	return FMath::Clamp(Intent, 0, 3);
 }
+
+uint64 UMCore_SettingsWidget_QualityPreset::GetSourceValueVersion() const
+{
+	/* Versions share one increasing counter, so the newest of the two identifies the pair */
+	const UMCore_PlayerSettingsSave* Save = GetPlayerSave();
+	return Save
+		? FMath::Max(Super::GetSourceValueVersion(), Save->GetQualityPresetVersion())
+		: Super::GetSourceValueVersion();
+}
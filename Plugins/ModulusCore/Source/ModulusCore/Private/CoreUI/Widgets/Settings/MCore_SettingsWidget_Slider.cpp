@@ -273,14 +273,14 @@ void UMCore_SettingsWidget_Slider::ApplyTheme_Implementation(UMCore_PDA_UITheme_
 		return;
 	}
 
-	UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-		GetOwningLocalPlayer(), Txt_ValueDisplay, NewTheme->ValueTextStyle);
+	UMCore_ThemeLibrary::ApplyThemeTextStyle(
+		GetOwningLocalPlayer(), Txt_ValueDisplay, NewTheme, EMCore_ThemeTextRole::Value);
 	
 	if (Slider_Value && NewTheme->SliderStyle)
 	{
 		Slider_Value->SetWidgetStyle(
-			UMCore_ThemeLibrary::BuildSliderStyle(
-				NewTheme->SliderStyle, Slider_Value->GetWidgetStyle()));
+			UMCore_ThemeLibrary::ResolveThemeSliderStyle(
+				GetOwningLocalPlayer(), NewTheme, Slider_Value->GetWidgetStyle()));
 	}
 	
 	const TSubclassOf<UCommonButtonStyle> StepButtonStyle =
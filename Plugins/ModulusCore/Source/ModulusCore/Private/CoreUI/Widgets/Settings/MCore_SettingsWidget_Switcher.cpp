@@ -262,8 +262,8 @@ void UMCore_SettingsWidget_Switcher::ApplyTheme_Implementation(UMCore_PDA_UIThem
 
 	if (!NewTheme) { return; }
 	
-	UMCore_ThemeLibrary::ApplyTextStyleFromTheme(
-		GetOwningLocalPlayer(), Txt_CurrentOption, NewTheme->ValueTextStyle);
+	UMCore_ThemeLibrary::ApplyThemeTextStyle(
+		GetOwningLocalPlayer(), Txt_CurrentOption, NewTheme, EMCore_ThemeTextRole::Value);
 	
 	const TSubclassOf<UCommonButtonStyle> ArrowStyle =
 		UMCore_ThemeLibrary::ResolveButtonStyle(
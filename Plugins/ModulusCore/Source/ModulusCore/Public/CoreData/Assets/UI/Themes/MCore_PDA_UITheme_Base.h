@@ -11,6 +11,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "CoreData/Types/UI/MCore_ThemeTypes.h"
 #include "MCore_PDA_UITheme_Base.generated.h"
 
 class UCommonButtonStyle;
@@ -65,6 +66,9 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "CommonUI Styles")
 	TArray<TSubclassOf<UCommonTextStyle>> DescriptionTextStyle;
 
+	/** Per-text-size style array for Role. */
+	const TArray<TSubclassOf<UCommonTextStyle>>& GetTextStyles(EMCore_ThemeTextRole Role) const;
+
 	// ============================================================================
 	// MODULUSCORE STYLE DATA ASSETS
 	// ============================================================================
@@ -24,10 +24,15 @@ class UMCore_PrimaryGameLayout;
 class UMCore_GameMenuHub;
 class UMCore_SettingsWidget_Slider;
 class UMCore_SettingsWidget_Switcher;
+class UMCore_SettingsSectionHeader;
+class UMCore_SettingsListView;
+class UMCore_KeyBindingListView;
 class UMCore_ConfirmationDialog;
 class UMCore_KeyBindingPanel_Base;
 class UMCore_SettingsRevertCountdown;
 class USoundMix;
+class UMCore_DA_QualityGovernorRules;
+class UMCore_DA_SettingsRegistry;
 
 /**
  * Developer settings for the Modulus Game Framework (Project Settings > Game > Modulus Core).
@@ -73,6 +78,23 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="UI", meta=(DisplayName="Layout Z-Order", ClampMin="-100", ClampMax="100"))
 	int32 PrimaryGameLayoutZOrder{0};
 
+	/**
+	 * Keep screens closed through UMCore_UISubsystem and reopen the same instance instead
+	 * of creating a widget per open. Applies to UMCore_ActivatableBase subclasses that
+	 * leave bAllowPooling set.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="UI")
+	bool bEnableWidgetPooling = true;
+
+	/* Closed instances kept per widget class on each layer; extras are left to GC. */
+	UPROPERTY(Config, EditAnywhere, Category="UI", meta=(ClampMin="0", ClampMax="16", EditCondition="bEnableWidgetPooling"))
+	int32 MaxPooledWidgetsPerClass{2};
+
+	/* Per-layer overrides of MaxPooledWidgetsPerClass. */
+	UPROPERTY(Config, EditAnywhere, Category="UI",
+		meta=(Categories="MCore.UI.Layer", ClampMin="0", ClampMax="16", EditCondition="bEnableWidgetPooling"))
+	TMap<FGameplayTag, int32> WidgetPoolLayerCaps;
+
 	// ============================================================================
 	// MENU HUB
 	// ============================================================================
@@ -95,6 +117,34 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Menu Hub", meta=(DisplayName="Default Menu Tabs"))
 	TArray<FMCore_MenuTab> DefaultMenuTabs;
 
+	/**
+	 * Construct the menu hub and its tab pages over idle frames once UISubsystem initializes,
+	 * so the first OpenMenuHub does not build every page in one frame. Needs bEnableWidgetPooling.
+	 * Games can instead call UISubsystem BeginMenuHubWarmUp, e.g. behind a loading screen.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub")
+	bool bWarmUpMenuHub = false;
+
+	/* Game-thread time the warm-up may spend per frame. A step always builds at least one page. */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub", meta=(ClampMin="0.1", ClampMax="33.0", Units="ms"))
+	float MenuHubWarmUpBudgetMs{2.0f};
+
+	/* Give menu tabs a placeholder page and construct the real page on first selection. */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub")
+	bool bLazyMenuTabPages = true;
+
+	/* After a tab change, construct the unbuilt tabs either side of it, one per frame. */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub", meta=(EditCondition="bLazyMenuTabPages"))
+	bool bPrefetchAdjacentMenuTabs = true;
+
+	/* Pages not selected for this long go back to placeholders on the next tab change. 0 keeps them. */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub", meta=(ClampMin="0", Units="s", EditCondition="bLazyMenuTabPages"))
+	float MenuTabPageUnloadSeconds{0.0f};
+
+	/* Most constructed pages a hub keeps; the least recently selected go first. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category="Menu Hub", meta=(ClampMin="0", EditCondition="bLazyMenuTabPages"))
+	int32 MaxLiveMenuTabPages{0};
+
 	// ============================================================================
 	// THEME CONFIGURATION
 	// ============================================================================
@@ -111,6 +161,14 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Theme", meta=(DisplayName="Default Theme", ClampMin="0"))
 	int32 DefaultThemeIndex{0};
 
+	/**
+	 * Keep the themes next to the active one in AvailableThemes streamed in, so stepping
+	 * through themes in the settings menu switches without waiting on a load.
+	 * Other inactive themes are released either way.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Theme", meta=(DisplayName="Preload Adjacent Themes"))
+	bool bPreloadAdjacentThemes{true};
+
 	// ============================================================================
 	// SETTINGS COLLECTIONS
 	// ============================================================================
@@ -123,6 +181,18 @@ public:
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings",
 		meta=(DisplayName="Settings Collections"))
 	TArray<TSoftObjectPtr<UMCore_DA_SettingsCollection>> SettingsCollections;
+
+	/**
+	 * Flattened, pre-sorted copy of SettingsCollections written by the
+	 * ModulusBakeSettingsRegistry commandlet. Cooked builds load this single asset
+	 * instead of the collections. Re-bake whenever a collection or definition changes.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, Category="Settings")
+	TSoftObjectPtr<UMCore_DA_SettingsRegistry> BakedSettingsRegistry;
+
+	/** Use BakedSettingsRegistry in editor/PIE too (cooked builds always use it when set). */
+	UPROPERTY(Config, EditDefaultsOnly, Category="Settings")
+	bool bUseBakedSettingsRegistryInEditor = false;
 	
 	/** Widget class used to render Slider-type settings. */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings")
@@ -132,6 +202,36 @@ public:
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings")
 	TSubclassOf<UMCore_SettingsWidget_Switcher> SettingsSwitcherWidgetClass;
 
+	/**
+	 * Build settings and key binding pages as virtualized lists: only rows in view exist, and
+	 * row widgets are recycled per class as the page scrolls. Off leaves one widget per setting
+	 * or action in a scroll box. Worth enabling once a page holds more rows than fit on screen
+	 * a few times over.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings")
+	bool bVirtualizeSettingsLists = false;
+
+	/**
+	 * Row shown above each run of settings sharing a SectionName, and above each key binding
+	 * category, in virtualized pages. None = no headers.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings",
+		meta=(EditCondition="bVirtualizeSettingsLists"))
+	TSubclassOf<UMCore_SettingsSectionHeader> SettingsSectionHeaderWidgetClass;
+
+	/**
+	 * List classes for virtualized pages: Blueprint subclasses with EntryWidgetClass set in their
+	 * class defaults. Rows still pick their own class; EntryWidgetClass is the list's required
+	 * fallback. Unset, or without an EntryWidgetClass, pages are built as scroll boxes.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings",
+		meta=(EditCondition="bVirtualizeSettingsLists"))
+	TSubclassOf<UMCore_SettingsListView> SettingsListViewClass;
+
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings",
+		meta=(EditCondition="bVirtualizeSettingsLists"))
+	TSubclassOf<UMCore_KeyBindingListView> KeyBindingListViewClass;
+
 	/** Widget class for inline key binding panel content in the Settings Panel. */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category="Settings")
 	TSubclassOf<UMCore_KeyBindingPanel_Base> KeyBindingPanelClass;
@@ -171,6 +271,31 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Settings", meta = (ClampMin = "5.0", ClampMax = "30.0", Units = "s"))
 	float ConfirmationRevertDelay = 15.0f;
 
+	/** Number of settings changes the player can step back through with undo. 0 disables undo. */
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", meta = (ClampMin = "0", ClampMax = "64"))
+	int32 SettingsUndoDepth{16};
+
+	/**
+	 * Persist committed setting values by appending to a per-slot journal instead of
+	 * rewriting the whole save on every change. Desktop platforms only: the journal is
+	 * a loose file beside the save slot, so platforms with their own save storage ignore
+	 * this and do a full save on every commit.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Settings")
+	bool bUseSettingsJournal = true;
+
+	/** Journal records after which the next commit compacts them into a full save. */
+	UPROPERTY(Config, EditAnywhere, Category = "Settings",
+		meta = (ClampMin = "8", ClampMax = "4096", EditCondition = "bUseSettingsJournal"))
+	int32 SettingsJournalCompactionThreshold{64};
+
+	/**
+	 * Per-phase apply cost above which a setting is flagged by Modulus.Settings.ApplyCost.Report
+	 * and the ModulusSettingsApplyReport commandlet. Non-Shipping telemetry only.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", meta = (ClampMin = "0.0", Units = "ms"))
+	float SettingApplyBudgetMs{2.0f};
+
 	// ============================================================================
 	// AUDIO
 	// ============================================================================
@@ -185,6 +310,22 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Audio")
 	TSoftObjectPtr<USoundMix> VolumeMix;
 
+	// ============================================================================
+	// QUALITY GOVERNOR
+	// ============================================================================
+
+	/**
+	 * Start UMCore_QualityGovernorSubsystem automatically with the GameInstance.
+	 * The governor steps ScalabilityQuality groups down and back up at runtime to hold
+	 * frame time; it never writes the player save. Can also be started from Blueprint.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Quality Governor")
+	bool bEnableQualityGovernor = false;
+
+	/** Frame-time rules the governor runs when auto-started. */
+	UPROPERTY(Config, EditAnywhere, Category = "Quality Governor", meta = (EditCondition = "bEnableQualityGovernor"))
+	TSoftObjectPtr<UMCore_DA_QualityGovernorRules> QualityGovernorRules;
+
 	// ============================================================================
 	// DEBUG (EDITOR ONLY)
 	// ============================================================================
@@ -277,10 +418,15 @@ public:
 	// SETTINGS AGGREGATION HELPERS
 	// ============================================================================
 
-	/** Returns all loaded settings collections. Resolves soft references on first call, caches results. */
+	/** Returns all loaded settings collections. Resolves soft references on first call, caches results.
+	 *  Empty when a baked registry backs the cache; use GetAllSettingDefinitions() to enumerate settings. */
 	UFUNCTION(BlueprintPure, Category = "Modulus|Settings")
 	const TArray<UMCore_DA_SettingsCollection*>& GetAllSettingsCollections() const;
 
+	/** Returns every registered setting definition in ordinal order, baked or not. */
+	UFUNCTION(BlueprintPure, Category = "Modulus|Settings")
+	TArray<UMCore_DA_SettingDefinition*> GetAllSettingDefinitions() const;
+
 	/** Searches all collections for a setting definition matching the tag. Returns first match. */
 	UFUNCTION(BlueprintPure, Category = "Modulus|Settings")
 	UMCore_DA_SettingDefinition* FindSettingDefinitionByTag(const FGameplayTag& SettingTag) const;
@@ -18,6 +18,7 @@
 
 class UMCore_DA_SettingDefinition;
 class UMCore_PlayerSettingsSave;
+class UMCore_PlayerSettingsSubsystem;
 class USoundClass;
 class USoundMix;
 
@@ -31,6 +32,15 @@ DECLARE_MULTICAST_DELEGATE_OneParam(
 	const TArray<FGameplayTag>&  /* AffectedTags */
 );
 
+/**
+ * Broadcast after a commit's dependency pass rewrote or re-enabled settings downstream
+ * of the ones the caller wrote. Settings widgets refresh or enable themselves from it.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FOnSettingDependentsUpdated,
+	const FMCore_SettingDependencyUpdate&  /* Update */
+);
+
 /**
  * Game settings library providing typed getters/setters with immediate-apply semantics.
  *
@@ -50,6 +60,9 @@ public:
 	 */
 	static FOnSettingsConfirmationRequired OnSettingsConfirmationRequired;
 
+	/** Static delegate carrying each commit's DrivenBy / ClampedTo rewrites and DisabledBy states. */
+	static FOnSettingDependentsUpdated OnSettingDependentsUpdated;
+
 	// ============================================================================
 	// TYPED GETTERS
 	// ============================================================================
@@ -133,6 +146,35 @@ public:
 		const TArray<FMCore_BoolSettingChange>& Changes,
 		bool bBypassConfirmation = false);
 
+	// ============================================================================
+	// TRANSACTIONS (MIXED-TYPE BATCH)
+	// ============================================================================
+
+	/**
+	 * Commits every change in the transaction as one pass: each value is clamped once,
+	 * engine targets flush once, the save is written once and a single SettingsChanged
+	 * event carries all committed tags (in place of one event per tag). Confirmation
+	 * handling matches the typed setters; the whole pass is one undo step.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static void CommitSettingsTransaction(
+		const UObject* WorldContextObject,
+		const FMCore_SettingsTransaction& Transaction,
+		bool bBypassConfirmation = false);
+
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	static void AddFloatToSettingsTransaction(UPARAM(ref) FMCore_SettingsTransaction& Transaction,
+		UMCore_DA_SettingDefinition* Setting, float Value);
+
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	static void AddIntToSettingsTransaction(UPARAM(ref) FMCore_SettingsTransaction& Transaction,
+		UMCore_DA_SettingDefinition* Setting, int32 Value);
+
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	static void AddBoolToSettingsTransaction(UPARAM(ref) FMCore_SettingsTransaction& Transaction,
+		UMCore_DA_SettingDefinition* Setting, bool Value);
+
 	// ============================================================================
 	// UTILITIES
 	// ============================================================================
@@ -172,30 +214,149 @@ public:
 
 	/** Re-applies every persisted setting to the engine without touching disk. Used by the
 	 *  boot-time replay path; also called internally by ReloadAndApplyFromDisk after refreshing
-	 *  in-memory state. Idempotent and safe to call repeatedly. Early-outs on dedicated server. */
+	 *  in-memory state. Skips settings the engine already holds. Idempotent and safe to call
+	 *  repeatedly. Early-outs on dedicated server. */
 	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
 		meta = (WorldContext = "WorldContextObject"))
 	static void ApplyAllSettingsToEngine(const UObject* WorldContextObject);
 
+	/** Forgets which values were last applied to the engine, so the next ApplyAllSettingsToEngine
+	 *  re-applies every setting. Call after engine state was changed behind the library's back
+	 *  (console commands, third-party GUS writes). */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	static void InvalidateAppliedSettingsCache();
+
+	/** Forgets the last applied value of one setting, so the next apply pass re-pushes it. */
+	static void InvalidateAppliedSetting(const UMCore_DA_SettingDefinition* Setting);
+
+	// ============================================================================
+	// DEPENDENCIES
+	// ============================================================================
+
+	/** False while any DisabledBy source of Setting is outside its enabled range. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static bool IsSettingEnabled(const UObject* WorldContextObject, const UMCore_DA_SettingDefinition* Setting);
+
+	// ============================================================================
+	// RUNTIME SCALABILITY OVERRIDES
+	// ============================================================================
+
+	/** FQualityLevels member names of every ScalabilityQuality child the library can drive. */
+	static TArray<FName> GetScalabilityGroupNames();
+
+	/** Level the engine currently runs a ScalabilityQuality child at, including any runtime
+	 *  override. INDEX_NONE for unknown groups. */
+	static int32 GetActiveScalabilityLevel(FName GroupName);
+
+	/** Runtime-only override of ScalabilityQuality children (group name -> level 0-3), pushed to the
+	 *  sg.* CVars in one SetQualityLevels. GameUserSettings keeps the player's levels, so its saves
+	 *  never persist an override; the player save, the Custom preset flag, undo and the confirmation
+	 *  flow are untouched too. A group set back to the player's level drops its override, and the
+	 *  written groups are dropped from the applied-value cache so the next ApplyAllSettingsToEngine
+	 *  restores the player's levels. Honors CoreSettings::bApplyScalabilitySettingsInPIE.
+	 *  Returns the number of groups written. */
+	static int32 ApplyTransientScalabilityLevels(const TMap<FName, int32>& Levels);
+
+	// ============================================================================
+	// CONFIRMATION & UNDO
+	// ============================================================================
+
+	/** Accepts every change awaiting confirmation: saves to disk and pushes the pre-change
+	 *  values onto the undo stack. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static void ConfirmPendingSettings(const UObject* WorldContextObject);
+
+	/** Restores the pre-change values of every setting awaiting confirmation and re-applies
+	 *  only those settings, from memory. Falls back to ReloadAndApplyFromDisk when no
+	 *  snapshot was captured. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static void RevertPendingSettings(const UObject* WorldContextObject);
+
+	/** Restores the values held before the most recent committed change and saves.
+	 *  Returns false when the history is empty or a confirmation is still pending. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static bool UndoLastSettingsChange(const UObject* WorldContextObject);
+
+	/** True when UndoLastSettingsChange would restore something. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static bool CanUndoSettingsChange(const UObject* WorldContextObject);
+
+	/** Drops every undo entry for the calling player. Pending confirmations are unaffected. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings",
+		meta = (WorldContext = "WorldContextObject"))
+	static void ClearSettingsUndoHistory(const UObject* WorldContextObject);
+
 private:
 	// ============================================================================
 	// INTERNAL HELPERS
 	// ============================================================================
 
+	static UMCore_PlayerSettingsSubsystem* GetPlayerSettingsSubsystem(const UObject* WorldContextObject);
+
 	static UMCore_PlayerSettingsSave* GetPlayerSave(const UObject* WorldContextObject);
 
+	static FMCore_SettingsHistory* GetSettingsHistory(const UObject* WorldContextObject);
+
 	static void BroadcastSettingChanged(const UObject* WorldContextObject,
 		const FGameplayTag& SettingTag);
 
+	/* Accumulates one commit pass across any number of typed staging calls. */
+	struct FSettingsCommitContext
+	{
+		UMCore_PlayerSettingsSave* Save = nullptr;
+		FMCore_SettingsHistory* History = nullptr;
+		bool bBypassConfirmation = false;
+
+		/* Pre-change values of settings committed outright; becomes one undo step. */
+		FMCore_SettingsSnapshot UndoSnapshot;
+
+		/* Confirmation-gated tags vs. tags committed outright. */
+		TArray<FGameplayTag> AffectedTags;
+		TArray<FGameplayTag> ProcessedTags;
+
+		bool bTouchedGameUserSettings = false;
+
+		/* Every definition staged in this pass, caller-written first, dependency-written after. */
+		TArray<const UMCore_DA_SettingDefinition*> StagedSettings;
+
+		FMCore_SettingDependencyUpdate DependencyUpdate;
+	};
+
+	/* Opens the context, runs StageChanges inside one scalability batch, then performs
+	 * the single GUS flush / undo push / save-or-confirm / event broadcast. With
+	 * bCoalesceEvents the per-tag events collapse into one SettingsChanged event. */
+	static void CommitSettingChanges_Internal(
+		const UObject* WorldContextObject,
+		bool bBypassConfirmation,
+		bool bCoalesceEvents,
+		TFunctionRef<void(FSettingsCommitContext&)> StageChanges);
+
+	/* Re-evaluates the dependency subgraph downstream of Context.StagedSettings in
+	 * topological order, staging DrivenBy / ClampedTo rewrites into the same commit. */
+	static void PropagateSettingDependencies(const UObject* WorldContextObject, FSettingsCommitContext& Context);
+
+	/* Clamp, write and engine-apply one typed change list into an open commit. */
 	template<typename TChangeStruct, typename TValue>
-	static void ApplySettingChanges_Internal(
+	static void StageSettingChanges_Internal(
 		const UObject* WorldContextObject,
+		FSettingsCommitContext& Context,
 		const TArray<TChangeStruct>& Changes,
-		bool bBypassConfirmation,
 		TFunctionRef<TValue(const UMCore_DA_SettingDefinition*, TValue)> ClampValue,
-		TFunctionRef<void(UMCore_PlayerSettingsSave*, const FString&, TValue)> SetCommitted,
+		TFunctionRef<void(UMCore_PlayerSettingsSave*, const UMCore_DA_SettingDefinition*, TValue)> SetCommitted,
 		TFunctionRef<void(const UMCore_DA_SettingDefinition*, TValue)> ApplyToEngine);
 
+	static void StageFloatChanges(const UObject* WorldContextObject,
+		FSettingsCommitContext& Context, const TArray<FMCore_FloatSettingChange>& Changes);
+	static void StageIntChanges(const UObject* WorldContextObject,
+		FSettingsCommitContext& Context, const TArray<FMCore_IntSettingChange>& Changes);
+	static void StageBoolChanges(const UObject* WorldContextObject,
+		FSettingsCommitContext& Context, const TArray<FMCore_BoolSettingChange>& Changes);
+
 	template<typename TValue>
 	static TValue GetSettingByTag_Internal(
 		const UObject* WorldContextObject,
@@ -225,17 +386,57 @@ private:
 		float FloatValue, int32 IntValue, bool bBoolValue);
 
 	/** Reads each ScalabilityQuality member from GUS and writes its value to the matching
-	 *  DA's save key (Definition->NamedSetter matched against 10 known names). */
-	static void CascadeScalabilityValuesToSave(UMCore_PlayerSettingsSave* Save);
+	 *  DA's save key. DAs are found through the dependency graph's NamedSetter index, so
+	 *  the cost follows the number of child setters, not the number of settings. */
+	static void CascadeScalabilityValuesToSave(const UObject* WorldContextObject, UMCore_PlayerSettingsSave* Save);
 
 	/** Sets LastSelectedQualityPreset to -1 (Custom) on the given save. No-op if Save is null. */
 	static void MarkQualityPresetCustom(UMCore_PlayerSettingsSave* Save);
 
-	static void ApplyToConsoleVariable(const FName& CVarName, float Value);
-	static void ApplyToConsoleVariable(const FName& CVarName, int32 Value);
-	static void ApplyToConsoleVariable(const FName& CVarName, bool Value);
+	/* Post-write half of every ScalabilityQuality child setter: push the struct onto the
+	 * sg.* CVars (when bPushToEngine), flip the saved preset to Custom, and broadcast
+	 * ExternalValueChange. Inside an FScalabilityBatchScope all three are deferred and
+	 * coalesced into a single push + single event when the outermost scope closes. */
+	static void CommitScalabilityChange(const UObject* WorldContextObject, bool bPushToEngine);
+
+	/* Pass-scoped scalability transaction. Opened around every apply pass
+	 * (CommitSettingChanges_Internal, ApplyAllSettingsToEngine, RestoreSnapshot);
+	 * nests, and only the outermost scope flushes. */
+	struct FScalabilityBatchScope
+	{
+		explicit FScalabilityBatchScope(const UObject* WorldContextObject);
+		~FScalabilityBatchScope();
+
+		FScalabilityBatchScope(const FScalabilityBatchScope&) = delete;
+		FScalabilityBatchScope& operator=(const FScalabilityBatchScope&) = delete;
+
+	private:
+		/* False when Modulus.Settings.BatchScalabilityPushes=0 left the scope inert */
+		bool bOpened{false};
+	};
+
+	// ============================================================================
+	// SNAPSHOT HELPERS
+	// ============================================================================
+
+	/* Records the current effective value of Setting into Snapshot. Capturing
+	 * OverallScalabilityLevel also captures every scalability child and the
+	 * LastSelectedQualityPreset intent, since the preset cascade rewrites them. */
+	static void CaptureSnapshotEntry(const UObject* WorldContextObject,
+		FMCore_SettingsSnapshot& Snapshot, const UMCore_DA_SettingDefinition* Setting);
+
+	/* Pushes onto the bounded undo stack, dropping the oldest entry past SettingsUndoDepth. */
+	static void PushUndoSnapshot(const UObject* WorldContextObject, FMCore_SettingsSnapshot&& Snapshot);
+
+	/* Writes every entry back to the save and re-applies only those settings to the engine. */
+	static void RestoreSnapshot(const UObject* WorldContextObject, const FMCore_SettingsSnapshot& Snapshot);
+
+	/* Apply helpers return false when nothing reached the engine (missing target, load failure, no world). */
+	static bool ApplyToConsoleVariable(const FName& CVarName, float Value);
+	static bool ApplyToConsoleVariable(const FName& CVarName, int32 Value);
+	static bool ApplyToConsoleVariable(const FName& CVarName, bool Value);
 
-	static void ApplyToSoundClass(const UObject* WorldContextObject,
+	static bool ApplyToSoundClass(const UObject* WorldContextObject,
 		const TSoftObjectPtr<USoundClass>& SoundClassRef, float Volume);
 
 	/* Idempotent. Pushes the configured volume mix to the active audio
@@ -243,7 +444,7 @@ private:
 	 * slider commit; no-ops after first push. */
 	static void EnsureVolumeMixActive(const UObject* WorldContextObject, USoundMix* VolumeMix);
 
-	static void ApplyToSoundMix(const UObject* WorldContextObject,
+	static bool ApplyToSoundMix(const UObject* WorldContextObject,
 		TSoftObjectPtr<USoundMix> SoundMixRef,
 		const FString& SaveKey, bool bDesiredActive);
 
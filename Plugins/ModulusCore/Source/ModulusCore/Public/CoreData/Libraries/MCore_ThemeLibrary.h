@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Styling/SlateTypes.h"
+#include "CoreData/Types/UI/MCore_ThemeTypes.h"
 #include "MCore_ThemeLibrary.generated.h"
 
 class UCommonTextBlock;
@@ -19,6 +20,7 @@ class UCommonTextStyle;
 class UCommonButtonStyle;
 class ULocalPlayer;
 class UMCore_PDA_SliderStyle;
+class UMCore_PDA_UITheme_Base;
 
 /**
  * 
@@ -37,6 +39,36 @@ public:
 	static void ApplyTextStyleFromTheme(const ULocalPlayer* LocalPlayer,
 		UCommonTextBlock* TextBlock,
 		const TArray<TSubclassOf<UCommonTextStyle>>& TextStyleArray);
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * ApplyTextStyleFromTheme as it was before the resolved style table: reads the text size
+	 * setting through the player settings subsystem on every call. Baseline for
+	 * Modulus.UI.Theme.RestyleBenchmark only.
+	 */
+	static void ApplyTextStyleFromSettings(const ULocalPlayer* LocalPlayer,
+		UCommonTextBlock* TextBlock,
+		const TArray<TSubclassOf<UCommonTextStyle>>& TextStyleArray);
+#endif
+
+	/**
+	 * Applies Theme's text style for Role at the player's text size. For the active
+	 * theme this is a lookup in the UI subsystem's resolved style table; other themes
+	 * (e.g. designer previews) resolve from the theme's arrays.
+	 */
+	UFUNCTION(BlueprintCallable, Category="ModulusCore|Theme")
+	static void ApplyThemeTextStyle(const ULocalPlayer* LocalPlayer,
+		UCommonTextBlock* TextBlock,
+		const UMCore_PDA_UITheme_Base* Theme,
+		EMCore_ThemeTextRole Role);
+
+	/**
+	 * Theme's slider style. Reuses the UI subsystem's prebuilt copy for the active theme,
+	 * otherwise builds it from the theme's SliderStyle DataAsset over BaseStyle.
+	 */
+	static FSliderStyle ResolveThemeSliderStyle(const ULocalPlayer* LocalPlayer,
+		const UMCore_PDA_UITheme_Base* Theme,
+		const FSliderStyle& BaseStyle);
 	
 	/**
 	 * Construct FSliderStyle based on SliderStyle DataAsset.
@@ -55,4 +87,9 @@ public:
 	static TSubclassOf<UCommonButtonStyle> ResolveButtonStyle(
 		TSubclassOf<UCommonButtonStyle> StyleOverride,
 		TSubclassOf<UCommonButtonStyle> ThemeDefault);
+
+private:
+	/* Out-of-range sizes use the first entry */
+	static void ApplyTextStyleAtSizeIndex(UCommonTextBlock* TextBlock,
+		const TArray<TSubclassOf<UCommonTextStyle>>& TextStyleArray, int32 SizeIndex);
 };
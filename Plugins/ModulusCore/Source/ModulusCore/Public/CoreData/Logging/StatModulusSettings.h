@@ -0,0 +1,14 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * StatModulusSettings.h
+ *
+ * Stat group declaration for Modulus settings systems.
+ * View at runtime with "stat ModulusSettings".
+ */
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ModulusSettings"), STATGROUP_ModulusSettings, STATCAT_Advanced);
@@ -0,0 +1,18 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * StatModulusUI.h
+ *
+ * Stat group declaration for Modulus UI systems.
+ * View at runtime with "stat ModulusUI".
+ */
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ModulusUI"), STATGROUP_ModulusUI, STATCAT_Advanced);
+
+/* UMCore_GameMenuHub tab pages built from a placeholder / dropped back to one, per frame */
+DECLARE_DWORD_COUNTER_STAT(TEXT("Menu Pages Materialized"), STAT_MCore_MenuPagesMaterialized, STATGROUP_ModulusUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Menu Pages Unloaded"), STAT_MCore_MenuPagesUnloaded, STATGROUP_ModulusUI);
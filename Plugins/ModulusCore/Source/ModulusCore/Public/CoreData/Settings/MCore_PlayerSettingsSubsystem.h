@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "CoreData/Types/Settings/MCore_SettingsTypes.h"
 #include "MCore_PlayerSettingsSubsystem.generated.h"
 
 class APlayerController;
@@ -54,9 +55,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
 	int32 GetActiveTextSizeIndex() const;
 
+	// ============================================================================
+	// SETTINGS HISTORY
+	// ============================================================================
+
+	/** In-memory confirmation-revert and undo state. Never persisted; cleared on Deinitialize. */
+	FMCore_SettingsHistory& GetSettingsHistory() { return SettingsHistory; }
+
 private:
 	UPROPERTY(Transient)
 	TObjectPtr<UMCore_PlayerSettingsSave> CachedPlayerSettings;
 
+	FMCore_SettingsHistory SettingsHistory;
+
 	bool bBootApplyDone = false;
 };
@@ -0,0 +1,152 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_QualityGovernorSubsystem.h
+ *
+ * Opt-in runtime governor that samples frame time and steps individual
+ * ScalabilityQuality groups down or up according to a
+ * UMCore_DA_QualityGovernorRules asset.
+ *
+ * Changes go through UMCore_GameSettingsLibrary::ApplyTransientScalabilityLevels:
+ * same FQualityLevels members and SetQualityLevels push as the settings pipeline,
+ * but layered over GameUserSettings rather than written into it, so nothing is
+ * persisted and the confirmation flow never fires.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "MCore_QualityGovernorSubsystem.generated.h"
+
+class UMCore_DA_QualityGovernorRules;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQualityGovernorStep, FName, ScalabilityGroup, int32, NewLevel);
+
+/**
+ * Engine-free decision core of the governor. Holds the moving average, the
+ * hysteresis timers and the governed level per group; emits at most one step
+ * per sample. Feed it synthetic frame-time series to exercise rules headlessly.
+ */
+struct MODULUSCORE_API FMCore_QualityGovernor
+{
+	struct FStep
+	{
+		int32 GroupIndex{INDEX_NONE};
+		int32 NewLevel{0};
+	};
+
+	/** Copies thresholds and groups out of Rules; every group starts at level 3 until SetCeilingLevels. */
+	void Configure(const UMCore_DA_QualityGovernorRules& Rules);
+
+	/** Sets the highest level each group may be restored to (the player's choice) and jumps to it. */
+	void SetCeilingLevels(TConstArrayView<int32> CeilingLevels);
+
+	/** Adopts a level set outside the governor as both the current level and the new ceiling. */
+	void AdoptLevel(int32 GroupIndex, int32 Level);
+
+	/** Records one frame and returns the step to apply, if the rules call for one. */
+	TOptional<FStep> AddFrameTimeSample(float FrameTimeMs, float DeltaSeconds);
+
+	/** Clears the moving average and hysteresis timers; levels are kept. */
+	void ResetTiming();
+
+	int32 NumGroups() const { return GroupNames.Num(); }
+	FName GetGroupName(int32 GroupIndex) const { return GroupNames[GroupIndex]; }
+	int32 GetLevel(int32 GroupIndex) const { return Levels[GroupIndex]; }
+	int32 GetCeilingLevel(int32 GroupIndex) const { return CeilingLevels[GroupIndex]; }
+	int32 FindGroupIndex(FName GroupName) const { return GroupNames.IndexOfByKey(GroupName); }
+	float GetAverageFrameTimeMs() const;
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Drives fixed drop, hysteresis, flapping and recovery frame-time series through a governor
+	 * and checks the levels and step timing it picks. Logs each mismatch as an error; returns
+	 * true if all passed. Backs Modulus.Settings.QualityGovernor.SelfTest.
+	 */
+	static bool RunSelfTest();
+#endif
+
+private:
+	float DowngradeAboveMs{18.0f};
+	float UpgradeBelowMs{14.0f};
+	float DowngradeSustainSeconds{1.0f};
+	float UpgradeSustainSeconds{5.0f};
+	float StepCooldownSeconds{2.0f};
+
+	TArray<FName> GroupNames;
+	TArray<int32> MinLevels;
+	TArray<int32> CeilingLevels;
+	TArray<int32> Levels;
+
+	/* Ring buffer of the last AveragingWindowFrames samples. */
+	TArray<float> Samples;
+	int32 NextSampleIndex{0};
+	int32 SampleCount{0};
+	float SampleSum{0.0f};
+
+	float OverBudgetSeconds{0.0f};
+	float UnderBudgetSeconds{0.0f};
+	float CooldownRemaining{0.0f};
+};
+
+/**
+ * GameInstance-scoped frame-time quality governor.
+ * Auto-starts when UMCore_CoreSettings::bEnableQualityGovernor is set; otherwise
+ * start it from Blueprint with StartGovernor. Stopping restores every governed
+ * group to the player's level.
+ */
+UCLASS()
+class MODULUSCORE_API UMCore_QualityGovernorSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ============================================================================
+	// CONTROL
+	// ============================================================================
+
+	/** Starts governing with Rules, taking the current scalability levels as the ceilings. Restarts if running. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	void StartGovernor(UMCore_DA_QualityGovernorRules* Rules);
+
+	/** Stops governing and restores every governed group to its ceiling. */
+	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+	void StopGovernor();
+
+	UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+	bool IsGovernorActive() const { return ActiveRules != nullptr; }
+
+	/** Level the governor currently holds a group at. INDEX_NONE if the group is not governed. */
+	UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+	int32 GetGovernedLevel(FName ScalabilityGroup) const;
+
+	/** Feeds one frame through the rules. Called from the core ticker; exposed for headless drivers. */
+	void FeedFrameTimeSample(float FrameTimeMs, float DeltaSeconds);
+
+	const FMCore_QualityGovernor& GetGovernor() const { return Governor; }
+
+	/** Fires after the governor changes a group's level. */
+	UPROPERTY(BlueprintAssignable, Category = "ModulusCore|Settings")
+	FOnQualityGovernorStep OnGovernorStep;
+
+private:
+	bool HandleTick(float DeltaTime);
+
+	/* Picks up levels the player (or anything else) set since the last sample. */
+	void AdoptExternalLevelChanges();
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMCore_DA_QualityGovernorRules> ActiveRules;
+
+	FMCore_QualityGovernor Governor;
+
+	/* Engine-side level per governed group as of the last sample; a mismatch means an outside write. */
+	TArray<int32> ObservedEngineLevels;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
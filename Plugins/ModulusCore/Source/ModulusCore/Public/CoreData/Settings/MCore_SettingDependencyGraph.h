@@ -0,0 +1,78 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_SettingDependencyGraph.h
+ *
+ * Compiled form of every UMCore_DA_SettingDefinition::Dependencies entry: one DAG
+ * over setting ordinals, built by UMCore_SettingsCollectionSubsystem next to the
+ * ordinal table. The commit pipeline walks only the part downstream of the
+ * settings it wrote, in topological order.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreData/Types/Settings/MCore_SettingsTypes.h"
+
+class UMCore_DA_SettingsCollection;
+
+/**
+ * Immutable once built; a registry rebuild produces a new graph. Nodes are setting
+ * ordinals. Edges that close a cycle are logged at build time and left out.
+ */
+class MODULUSCORE_API FMCore_SettingDependencyGraph
+{
+public:
+	struct FEdge
+	{
+		int32 Source{INDEX_NONE};
+		int32 Target{INDEX_NONE};
+
+		/* Index into the target definition's Dependencies array */
+		int32 DependencyIndex{INDEX_NONE};
+	};
+
+	/** Compiles the dependencies of every definition in Collections against Ordinals. */
+	static TSharedRef<const FMCore_SettingDependencyGraph> Build(
+		const TArray<UMCore_DA_SettingsCollection*>& Collections,
+		const TSharedRef<const FMCore_SettingOrdinalTable>& Ordinals);
+
+	/** Same, over definitions already flattened in registry order (a baked registry's Settings). */
+	static TSharedRef<const FMCore_SettingDependencyGraph> Build(
+		TConstArrayView<const UMCore_DA_SettingDefinition*> Definitions,
+		const TSharedRef<const FMCore_SettingOrdinalTable>& Ordinals);
+
+	int32 NumNodes() const { return Definitions.Num(); }
+	bool HasEdges() const { return Edges.Num() > 0; }
+
+	/** Node of a definition (any listing of its save key), or INDEX_NONE. */
+	int32 FindNode(const UMCore_DA_SettingDefinition* Setting) const { return Ordinals->FindOrdinal(Setting); }
+
+	/** First-listed definition of a node. */
+	const UMCore_DA_SettingDefinition* GetDefinition(int32 Node) const { return Definitions[Node]; }
+
+	TConstArrayView<int32> GetInEdges(int32 Node) const { return InEdges[Node]; }
+	const FEdge& GetEdge(int32 EdgeIndex) const { return Edges[EdgeIndex]; }
+	const FMCore_SettingDependency& GetDependency(const FEdge& Edge) const;
+
+	/** Every node reachable from Seeds (seeds themselves only when reachable from another seed), in topological order. */
+	void CollectDownstream(TConstArrayView<int32> Seeds, TArray<int32>& OutNodes) const;
+
+	/** Nodes whose definition targets NamedSetter, in ordinal order. */
+	TConstArrayView<int32> FindNodesByNamedSetter(FName NamedSetter) const;
+
+private:
+	/* Marks edges inside a strongly connected component as cycle edges and logs each cycle. */
+	void DropCycleEdges();
+	void AssignTopologicalRanks();
+
+	TSharedPtr<const FMCore_SettingOrdinalTable> Ordinals;
+	TArray<const UMCore_DA_SettingDefinition*> Definitions;
+
+	TArray<FEdge> Edges;
+	TArray<TArray<int32>> OutEdges;
+	TArray<TArray<int32>> InEdges;
+	TArray<int32> TopologicalRank;
+
+	TMap<FName, TArray<int32>> NodesByNamedSetter;
+};
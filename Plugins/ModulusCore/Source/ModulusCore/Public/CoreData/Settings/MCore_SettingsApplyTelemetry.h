@@ -0,0 +1,106 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_SettingsApplyTelemetry.h
+ *
+ * Per-setting apply cost telemetry. ApplySettingToEngine times each dispatch
+ * phase (NamedSetter, CVar, SoundClass, SoundMix, ColorVision) per setting tag;
+ * the aggregates are inspected with the Modulus.Settings.ApplyCost.* console
+ * commands or written to CSV for the editor-side budget report.
+ *
+ * Compiled out of Shipping builds. Toggle at runtime with
+ * Modulus.Settings.ApplyCost.Enable.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+#ifndef MCORE_WITH_SETTINGS_APPLY_TELEMETRY
+#define MCORE_WITH_SETTINGS_APPLY_TELEMETRY !UE_BUILD_SHIPPING
+#endif
+
+/** Dispatch phases of UMCore_GameSettingsLibrary::ApplySettingToEngine. */
+enum class EMCore_SettingApplyPhase : uint8
+{
+	NamedSetter,
+	ConsoleVariable,
+	SoundClass,
+	SoundMix,
+	ColorVision,
+	Num
+};
+
+MODULUSCORE_API const TCHAR* LexToString(EMCore_SettingApplyPhase Phase);
+MODULUSCORE_API bool LexTryParseString(EMCore_SettingApplyPhase& OutPhase, const TCHAR* Buffer);
+
+/** Aggregated cost of one phase for one setting. Times in milliseconds. */
+struct MODULUSCORE_API FMCore_SettingApplyCost
+{
+	FString SettingTag;
+	EMCore_SettingApplyPhase Phase{EMCore_SettingApplyPhase::NamedSetter};
+	uint32 CallCount{0};
+	double TotalMs{0.0};
+	double MinMs{0.0};
+	double MaxMs{0.0};
+
+	double GetAverageMs() const { return CallCount > 0 ? TotalMs / CallCount : 0.0; }
+
+	void AddSample(double Ms);
+};
+
+/**
+ * Process-wide apply cost aggregator. Game-thread only, like the settings library.
+ */
+class MODULUSCORE_API FMCore_SettingsApplyTelemetry
+{
+public:
+	static FMCore_SettingsApplyTelemetry& Get();
+
+	/** True when Modulus.Settings.ApplyCost.Enable is set (always false when compiled out). */
+	static bool IsEnabled();
+
+	void Record(const FGameplayTag& SettingTag, EMCore_SettingApplyPhase Phase, double Ms);
+	void Reset();
+
+	/** Every aggregate, most expensive (by max) first. */
+	TArray<FMCore_SettingApplyCost> GetSortedCosts() const;
+
+	/** Aggregates whose max exceeds BudgetMs, most expensive first. */
+	static TArray<FMCore_SettingApplyCost> FilterOverBudget(TArrayView<const FMCore_SettingApplyCost> Costs, double BudgetMs);
+
+	/** Writes Costs as CSV (SettingTag,Phase,Calls,AvgMs,MinMs,MaxMs). */
+	static bool WriteCsv(const FString& FilePath, TArrayView<const FMCore_SettingApplyCost> Costs);
+
+	/** Reads a CSV written by WriteCsv. Malformed rows are skipped. */
+	static bool ReadCsv(const FString& FilePath, TArray<FMCore_SettingApplyCost>& OutCosts);
+
+	/** Default dump location: <Saved>/Profiling/ModulusSettings/ApplyCost-<timestamp>.csv */
+	static FString MakeDefaultCsvPath();
+
+private:
+	TMap<TPair<FGameplayTag, EMCore_SettingApplyPhase>, FMCore_SettingApplyCost> Costs;
+};
+
+/** Times one dispatch phase for one setting and records it on destruction. */
+struct MODULUSCORE_API FMCore_ScopedSettingApplyTimer
+{
+	FMCore_ScopedSettingApplyTimer(const FGameplayTag& InSettingTag, EMCore_SettingApplyPhase InPhase);
+	~FMCore_ScopedSettingApplyTimer();
+
+	FMCore_ScopedSettingApplyTimer(const FMCore_ScopedSettingApplyTimer&) = delete;
+	FMCore_ScopedSettingApplyTimer& operator=(const FMCore_ScopedSettingApplyTimer&) = delete;
+
+private:
+	const FGameplayTag& SettingTag;
+	EMCore_SettingApplyPhase Phase;
+	uint64 StartCycles{0};
+};
+
+#if MCORE_WITH_SETTINGS_APPLY_TELEMETRY
+#define MCORE_SCOPE_SETTING_APPLY_COST(SettingTag, Phase) \
+	const FMCore_ScopedSettingApplyTimer ANONYMOUS_VARIABLE(SettingApplyTimer)(SettingTag, Phase)
+#else
+#define MCORE_SCOPE_SETTING_APPLY_COST(SettingTag, Phase)
+#endif
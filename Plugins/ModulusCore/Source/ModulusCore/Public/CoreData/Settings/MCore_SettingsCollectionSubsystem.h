@@ -20,10 +20,34 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "CoreData/Types/Settings/MCore_SettingsTypes.h"
 #include "MCore_SettingsCollectionSubsystem.generated.h"
 
 class UMCore_DA_SettingsCollection;
 class UMCore_DA_SettingDefinition;
+class UMCore_DA_SettingsRegistry;
+class FMCore_SettingDependencyGraph;
+class FMCore_SettingsSearchIndex;
+
+/**
+ * What an in-editor edit of a collection or definition changed in the resolved registry.
+ * Consumers patch only what is listed; bCategoryLayoutChanged means tabs must be rebuilt.
+ */
+struct FMCore_SettingsRegistryChange
+{
+	/* Definitions whose content changed but whose row placement did not (re-init the row). */
+	TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>> ChangedDefinitions;
+
+	/* Leaf categories whose row set or row order changed (rebuild the page). */
+	TSet<FGameplayTag> AffectedCategories;
+
+	/* A category appeared, disappeared or was renamed. */
+	bool bCategoryLayoutChanged{false};
+
+	bool IsEmpty() const { return ChangedDefinitions.Num() == 0 && AffectedCategories.Num() == 0 && !bCategoryLayoutChanged; }
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSettingsRegistryPatched, const FMCore_SettingsRegistryChange&);
 
 /**
  * GameInstance-scoped runtime cache for resolved settings collections.
@@ -32,6 +56,9 @@ class UMCore_DA_SettingDefinition;
  * Soft-ref source-of-truth stays on UMCore_CoreSettings::SettingsCollections (CDO,
  * config-driven). This subsystem resolves those soft refs on first access and
  * holds the loaded DAs UPROPERTY-tracked so they survive GC across alt-tab.
+ *
+ * Cooked builds with UMCore_CoreSettings::BakedSettingsRegistry set load that one
+ * asset instead and answer category/tag queries from its pre-sorted tables.
  */
 UCLASS()
 class MODULUSCORE_API UMCore_SettingsCollectionSubsystem : public UGameInstanceSubsystem
@@ -39,6 +66,9 @@ class MODULUSCORE_API UMCore_SettingsCollectionSubsystem : public UGameInstanceS
 	GENERATED_BODY()
 
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 	/* Static accessor — looks up the subsystem from a world context. Returns nullptr
 	   if WorldContextObject is null, has no world, or the world has no GameInstance. */
 	static UMCore_SettingsCollectionSubsystem* Get(const UObject* WorldContextObject);
@@ -53,15 +83,116 @@ public:
 	FText GetCategoryDisplayName(const FGameplayTag& CategoryTag);
 	bool HasValidSettingsCollections();
 
+	/* Every registered definition (first listing of each save key) in ordinal order.
+	   Prefer this over walking GetAllSettingsCollections(), which is empty when the
+	   cache is backed by a baked registry. */
+	TArray<UMCore_DA_SettingDefinition*> GetAllSettingDefinitions();
+
+	/* Main-tab parent of a leaf category tag; invalid for a root-level tag. */
+	FGameplayTag GetCategoryParent(const FGameplayTag& CategoryTag);
+
+	/* Baked registry backing the cache, or nullptr when collections were resolved directly. */
+	UMCore_DA_SettingsRegistry* GetBakedRegistry();
+
+	/* Dense ordinal index over every resolved definition; rebuilt with the collection
+	   cache. Player saves bind to it for array-indexed value storage. */
+	TSharedPtr<const FMCore_SettingOrdinalTable> GetSettingOrdinalTable();
+
+	/* Compiled Dependencies of every resolved definition, over the same ordinals. */
+	TSharedPtr<const FMCore_SettingDependencyGraph> GetDependencyGraph();
+
+	/* Search index over every resolved definition in the current language. Built on
+	   first use; rebuilt with the registry or after the language changes. */
+	TSharedPtr<const FMCore_SettingsSearchIndex> GetSearchIndex();
+
 	/* Drops the cache; next read re-resolves. Called by the CoreSettings proxy from
 	   PostEditChangeProperty (editor-only invalidation). */
 	void InvalidateCollectionCache();
 
+	/* Fires after an editor edit to a resolved collection or definition was patched into
+	   the registry (editor builds only). Open settings panels update just the listed rows. */
+	FOnSettingsRegistryPatched OnRegistryPatched;
+
 private:
+	/* Loads CoreSettings' baked registry when this build should use it (cooked, or opted in). */
+	static UMCore_DA_SettingsRegistry* LoadBakedRegistry();
+
+	void BuildSettingOrdinalTable();
+	void BuildBakedSettingOrdinalTable();
+
+	/* Resolves every SoundClass / SoundMix the collections reference (plus the
+	   CoreSettings VolumeMix) once, so volume slider drags never hit the loader. */
+	void PinSoundAssets();
+	void PinDefinitionSounds(const UMCore_DA_SettingDefinition* Definition);
+	void PinSoundAsset(const TSoftObjectPtr<UObject>& SoftRef);
+
+	TSharedPtr<const FMCore_SettingOrdinalTable> SettingOrdinalTable;
+	TSharedPtr<const FMCore_SettingDependencyGraph> DependencyGraph;
+	TSharedPtr<const FMCore_SettingsSearchIndex> SearchIndex;
+
 	/* GC-rooted via UPROPERTY. Legal here — subsystem is a runtime UObject, not in
 	   the disregard-for-GC permanent pool. */
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UMCore_DA_SettingsCollection>> ResolvedCollections;
 
+	UPROPERTY(Transient)
+	TObjectPtr<UMCore_DA_SettingsRegistry> BakedRegistry;
+
+	/* Held for the cache's lifetime; soft refs elsewhere resolve via Get() without loading. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> PinnedSoundAssets;
+
 	bool bCollectionsCacheValid = false;
+
+#if WITH_EDITOR
+	/* Row placement of a definition as of the last registry build or patch. */
+	struct FDefinitionLayout
+	{
+		FGameplayTag SettingTag;
+		FGameplayTag CategoryTag;
+		int32 SortOrder{0};
+		EMCore_SettingType SettingType{EMCore_SettingType::Toggle};
+		const UClass* WidgetClass{nullptr};
+
+		/* Not placement, but compared to decide whether the patch needs to pin anything */
+		FSoftObjectPath SoundClass;
+		FSoftObjectPath PushedSoundMix;
+
+		/* SettingTag is the save key, so a retag moves the row like any other placement change */
+		bool HasSamePlacement(const FDefinitionLayout& Other) const
+		{
+			return SettingTag == Other.SettingTag && CategoryTag == Other.CategoryTag
+				&& SortOrder == Other.SortOrder && SettingType == Other.SettingType
+				&& WidgetClass == Other.WidgetClass;
+		}
+
+		bool HasSameSounds(const FDefinitionLayout& Other) const
+		{
+			return SoundClass == Other.SoundClass && PushedSoundMix == Other.PushedSoundMix;
+		}
+	};
+
+	static FDefinitionLayout CaptureDefinitionLayout(const UMCore_DA_SettingDefinition* Definition);
+
+	/* Snapshots membership and placement so later edits can be diffed against it. */
+	void CaptureRegistryLayout();
+	TSet<FGameplayTag> GetLayoutCategories() const;
+
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void PatchDefinition(const UMCore_DA_SettingDefinition* Definition, FName ChangedProperty);
+	void PatchCollection(const UMCore_DA_SettingsCollection* Collection, FName ChangedProperty);
+
+	/* Re-slots only the listed definitions in a copy of the ordinal table (the new table
+	   pointer makes the player save rebind) and rebuilds the dependency graph against it. */
+	void PatchSettingOrdinals(TConstArrayView<const UMCore_DA_SettingDefinition*> Remapped,
+		TConstArrayView<const UMCore_DA_SettingDefinition*> Removed);
+
+	/* Broadcasts a non-empty change and drops the search index so it rebuilds on next use. */
+	void FinishPatch(FMCore_SettingsRegistryChange&& Change, const TSet<FGameplayTag>& CategoriesBefore);
+
+	TMap<TWeakObjectPtr<const UMCore_DA_SettingDefinition>, FDefinitionLayout> DefinitionLayouts;
+	TMap<TWeakObjectPtr<const UMCore_DA_SettingsCollection>, TArray<TWeakObjectPtr<const UMCore_DA_SettingDefinition>>> CollectionMembers;
+
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
 };
@@ -0,0 +1,124 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_SettingsJournal.h
+ *
+ * Crash-safe persistence for UMCore_PlayerSettingsSave. Committed setting values
+ * are appended to a small per-slot journal file; the full save is rewritten only
+ * when the journal grows past a threshold (compaction), alternating between two
+ * slots so a torn write always leaves the previous snapshot readable.
+ *
+ * Every journal record and every snapshot carries a CRC. Loading takes the newest
+ * snapshot that verifies and replays the journal records newer than it, stopping
+ * at the first record that does not.
+ *
+ * Snapshots go through ISaveGameSystem; the journal is a loose file next to them,
+ * written with IPlatformFile, because the save system has no append. Journaling is
+ * therefore limited to platforms whose save slots are loose files (see IsEnabled).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EMCore_SettingsJournalRecordType : uint8
+{
+	Float,
+	Int,
+	Bool,
+	/* UMCore_PlayerSettingsSave::LastSelectedQualityPreset in IntValue; Key unused */
+	QualityPreset
+};
+
+/** One persisted value. Only the value field matching Type is meaningful. */
+struct FMCore_SettingsJournalRecord
+{
+	uint64 Sequence{0};
+	EMCore_SettingsJournalRecordType Type{EMCore_SettingsJournalRecordType::Float};
+	FString Key;
+	float FloatValue{0.0f};
+	int32 IntValue{0};
+	bool bBoolValue{false};
+};
+
+/** Header framed onto every snapshot written by SaveSettings. */
+struct FMCore_SettingsSnapshotInfo
+{
+	/* Increments per compaction; the newer of the two slots wins on load */
+	uint64 Generation{0};
+
+	/* Highest journal sequence already folded into the snapshot */
+	uint64 LastSequence{0};
+};
+
+/**
+ * File format helpers. Game-thread only except ParseRecords/UnframeSnapshot,
+ * which touch no shared state.
+ */
+class MODULUSCORE_API FMCore_SettingsJournal
+{
+public:
+	enum class EReadResult : uint8
+	{
+		/* No journal, or a header with no records */
+		Empty,
+		/* Every byte belonged to a verified record */
+		Clean,
+		/* Stopped at a torn or corrupt record (or header); everything before it was kept */
+		TornTail
+	};
+
+	enum class ESnapshotResult : uint8
+	{
+		/* Framed and verified; the frame was stripped */
+		Valid,
+		/* Written before journaling existed; no checksum to verify */
+		Legacy,
+		Corrupt
+	};
+
+	/**
+	 * True when CoreSettings::bUseSettingsJournal is on and this platform keeps save
+	 * slots as loose files under <Saved>/SaveGames (desktop). Elsewhere the save system
+	 * owns storage the journal cannot safely sit beside, and every commit is a full save.
+	 */
+	static bool IsEnabled();
+
+	/** <Saved>/SaveGames/<SlotName>.journal */
+	static FString GetJournalFilename(const FString& SlotName);
+
+	/** Second snapshot slot; compaction alternates between SlotName and this. */
+	static FString GetAlternateSlotName(const FString& SlotName);
+
+	/**
+	 * Appends Records and flushes to disk. Starts the file with a header naming
+	 * BaseSequence when it is missing or empty. False if the file cannot be written.
+	 */
+	static bool AppendRecords(const FString& SlotName, uint64 BaseSequence,
+		TConstArrayView<FMCore_SettingsJournalRecord> Records);
+
+	/** Replaces the journal with an empty one following a snapshot that holds everything up to BaseSequence. */
+	static bool Reset(const FString& SlotName, uint64 BaseSequence);
+
+	static void Delete(const FString& SlotName);
+
+	/** Whole journal file; empty if there is none. */
+	static void ReadFile(const FString& SlotName, TArray<uint8>& OutBytes);
+
+	/** Decodes a journal file. OutBaseSequence is 0 when the header is missing or corrupt. */
+	static EReadResult ParseRecords(TConstArrayView<uint8> Bytes, uint64& OutBaseSequence,
+		TArray<FMCore_SettingsJournalRecord>& OutRecords);
+
+	/** Prepends the checksummed frame to serialized save bytes. */
+	static void FrameSnapshot(TArray<uint8>& InOutBytes, const FMCore_SettingsSnapshotInfo& Info);
+
+	/** Verifies and strips the frame. Legacy bytes are left as they are with a default Info. */
+	static ESnapshotResult UnframeSnapshot(TArray<uint8>& InOutBytes, FMCore_SettingsSnapshotInfo& OutInfo);
+
+	/**
+	 * Writes a scratch slot through snapshots and journal appends, truncates the
+	 * journal or newest snapshot at random offsets and checks every reload recovers
+	 * a state the settings actually passed through.
+	 */
+	static void RunFaultInjectionTest(int32 NumTrials, int32 Seed);
+};
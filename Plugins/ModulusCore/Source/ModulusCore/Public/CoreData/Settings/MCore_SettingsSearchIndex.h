@@ -0,0 +1,146 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_SettingsSearchIndex.h
+ *
+ * Runtime search over the resolved settings registry. The index flattens each
+ * definition's localized display name, search keywords, category path and
+ * description into lowercase terms once per UI language; a query object then
+ * ranks definitions against what the player has typed so far.
+ *
+ * Owned by UMCore_SettingsCollectionSubsystem and rebuilt with the registry or
+ * when the current language changes.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UMCore_DA_SettingDefinition;
+
+/* One ranked match: an index entry and its score (higher is better). */
+struct FMCore_SettingSearchHit
+{
+	int32 Entry{INDEX_NONE};
+	float Score{0.0f};
+};
+
+/**
+ * Immutable once built. Terms live in one shared character pool so a query
+ * only walks flat arrays.
+ *
+ * A query token matches a term by exact word, word prefix, substring, or as an
+ * in-order subsequence starting on the term's first character ("shdw" finds
+ * "shadows"). Every rule still matches when the token is shortened, which is
+ * what lets FMCore_SettingsSearchQuery narrow the previous results per keystroke.
+ */
+class MODULUSCORE_API FMCore_SettingsSearchIndex
+{
+public:
+	/** Localized name of a category tag as shown on its tab. */
+	using FCategoryNameResolver = TFunctionRef<FText(const FGameplayTag&)>;
+
+	/** Main-tab parent of a leaf category tag; invalid for a root-level tag. */
+	using FCategoryParentResolver = TFunctionRef<FGameplayTag(const FGameplayTag&)>;
+
+	/** Indexes Definitions (null entries skipped) in the current language. Entry order follows Definitions. */
+	static TSharedRef<const FMCore_SettingsSearchIndex> Build(
+		TConstArrayView<const UMCore_DA_SettingDefinition*> Definitions,
+		FCategoryNameResolver GetCategoryName,
+		FCategoryParentResolver GetCategoryParent);
+
+	int32 Num() const { return Entries.Num(); }
+	const UMCore_DA_SettingDefinition* GetDefinition(int32 Entry) const { return Entries[Entry].Definition; }
+
+	/** Localized "Parent / Leaf" path of the entry's category, as indexed. */
+	const FText& GetCategoryPath(int32 Entry) const { return Entries[Entry].CategoryPath; }
+
+	/** Language the text was read in; stale once it differs from the current language. */
+	const FString& GetLanguage() const { return Language; }
+	bool IsCurrentLanguage() const;
+
+	/**
+	 * Builds an index over NumDefinitions synthetic definitions and logs build time
+	 * plus per-keystroke query latency for a set of typed queries.
+	 */
+	static void RunSyntheticBenchmark(int32 NumDefinitions, int32 NumRepeats);
+
+private:
+	friend class FMCore_SettingsSearchQuery;
+
+	/* Where a term came from; weights the score of a match */
+	enum class EField : uint8
+	{
+		DisplayName,
+		Keyword,
+		Category,
+		Description
+	};
+
+	struct FTerm
+	{
+		int32 Offset{0};
+		int32 Length{0};
+		EField Field{EField::DisplayName};
+	};
+
+	struct FEntry
+	{
+		const UMCore_DA_SettingDefinition* Definition{nullptr};
+		FText CategoryPath;
+		int32 FirstTerm{0};
+		int32 NumTerms{0};
+	};
+
+	/* Splits Source on non-alphanumerics, lowercases, and appends the words as terms. */
+	void AddTerms(const FString& Source, EField Field);
+
+	/* Best weighted score of one lowercase query token against Entry's terms; 0 if none match. */
+	float ScoreToken(const FEntry& Entry, FStringView Token) const;
+
+	FString Language;
+	TArray<TCHAR> CharPool;
+	TArray<FTerm> Terms;
+	TArray<FEntry> Entries;
+};
+
+/**
+ * Per-search-field query state. Keep one alive for the lifetime of the field and
+ * call Update with the full text on every change. All buffers are sized on
+ * SetIndex, so updates do not allocate. When the new text extends the previous
+ * text only the previous hits are re-scored.
+ */
+class MODULUSCORE_API FMCore_SettingsSearchQuery
+{
+public:
+	/** Binds to an index and clears results. No-op if already bound to InIndex. */
+	void SetIndex(const TSharedPtr<const FMCore_SettingsSearchIndex>& InIndex);
+	const FMCore_SettingsSearchIndex* GetIndex() const { return Index.Get(); }
+
+	/** Re-ranks for Text. Returns every match, best first (ties keep index order). */
+	TConstArrayView<FMCore_SettingSearchHit> Update(FStringView Text);
+
+	TConstArrayView<FMCore_SettingSearchHit> GetHits() const { return Hits; }
+
+	void Reset();
+
+private:
+	struct FTokenRange
+	{
+		int32 Start{0};
+		int32 Length{0};
+	};
+
+	/* Lowercases Text into Normalized and splits it into Tokens. */
+	void Normalize(FStringView Text);
+
+	float ScoreEntry(int32 Entry) const;
+
+	TSharedPtr<const FMCore_SettingsSearchIndex> Index;
+
+	TArray<TCHAR> Normalized;
+	TArray<TCHAR> PreviousNormalized;
+	TArray<FTokenRange> Tokens;
+	TArray<FMCore_SettingSearchHit> Hits;
+};
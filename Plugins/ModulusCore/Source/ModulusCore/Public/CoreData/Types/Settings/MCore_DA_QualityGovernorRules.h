@@ -0,0 +1,96 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_DA_QualityGovernorRules.h
+ *
+ * DataAsset describing how UMCore_QualityGovernorSubsystem trades scalability
+ * for frame time: the hysteresis band, how long a breach must persist, and
+ * which ScalabilityQuality groups may be stepped, in priority order.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MCore_DA_QualityGovernorRules.generated.h"
+
+/** One ScalabilityQuality group the governor is allowed to step. */
+USTRUCT(BlueprintType)
+struct MODULUSCORE_API FMCore_QualityGovernorGroupRule
+{
+	GENERATED_BODY()
+
+	/* FQualityLevels member name (e.g. ShadowQuality), same names the setting NamedSetter uses. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Governor",
+		meta = (GetOptions = "MCore_DA_QualityGovernorRules.GetScalabilityGroupOptions"))
+	FName ScalabilityGroup;
+
+	/* Lowest level the governor may step this group down to. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Governor", meta = (ClampMin = "0", ClampMax = "3"))
+	int32 MinLevel{0};
+};
+
+/**
+ * Frame-time rules for the runtime quality governor.
+ *
+ * Groups are stepped down one level at a time in list order (the first group is
+ * sacrificed first) and restored in reverse order, never above the level the
+ * player chose. Frame times between UpgradeBelowMs and DowngradeAboveMs hold
+ * the current levels, which keeps the governor from oscillating.
+ *
+ * Create as a DataAsset; assign to UMCore_CoreSettings::QualityGovernorRules.
+ */
+UCLASS(BlueprintType, Const)
+class MODULUSCORE_API UMCore_DA_QualityGovernorRules : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================================================
+	// THRESHOLDS
+	// ============================================================================
+
+	/* Averaged frame time above which the governor starts stepping quality down. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Thresholds", meta = (ClampMin = "1.0", Units = "ms"))
+	float DowngradeAboveMs{18.0f};
+
+	/* Averaged frame time below which the governor starts restoring quality. Must be below DowngradeAboveMs. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Thresholds", meta = (ClampMin = "1.0", Units = "ms"))
+	float UpgradeBelowMs{14.0f};
+
+	/* Number of frames in the moving average the thresholds are compared against. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Thresholds", meta = (ClampMin = "1", ClampMax = "600"))
+	int32 AveragingWindowFrames{30};
+
+	// ============================================================================
+	// TIMING
+	// ============================================================================
+
+	/* How long the average must stay above DowngradeAboveMs before one group steps down. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timing", meta = (ClampMin = "0.0", Units = "s"))
+	float DowngradeSustainSeconds{1.0f};
+
+	/* How long the average must stay below UpgradeBelowMs before one group steps up. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timing", meta = (ClampMin = "0.0", Units = "s"))
+	float UpgradeSustainSeconds{5.0f};
+
+	/* Minimum time between two steps, so each change is measured before the next. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Timing", meta = (ClampMin = "0.0", Units = "s"))
+	float StepCooldownSeconds{2.0f};
+
+	// ============================================================================
+	// GROUPS
+	// ============================================================================
+
+	/* Governed groups in downgrade priority order. Groups not listed are never touched. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Groups")
+	TArray<FMCore_QualityGovernorGroupRule> Groups;
+
+	/** Options source for FMCore_QualityGovernorGroupRule::ScalabilityGroup. */
+	UFUNCTION()
+	static TArray<FName> GetScalabilityGroupOptions();
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+};
@@ -76,6 +76,11 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Setting|Identity")
 	FText Description;
 
+	/* Extra terms the settings search should match (e.g. "fps", "vsync" for Frame Rate Limit).
+	   Localized like DisplayName. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Setting|Identity")
+	TArray<FText> SearchKeywords;
+
 	// ============================================================================
 	// TYPE & VALUES
 	// ============================================================================
@@ -208,6 +213,18 @@ public:
 		        EditConditionHides))
 	TSoftObjectPtr<USoundMix> PushedSoundMix;
 
+	// ============================================================================
+	// DEPENDENCIES
+	// ============================================================================
+
+	/**
+	 * Typed edges from other settings to this one (DrivenBy / DisabledBy / ClampedTo).
+	 * Compiled into one graph when the collections load; cycles are reported and ignored.
+	 * A commit re-evaluates only the settings downstream of what it wrote, in topological order.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Setting|Dependencies")
+	TArray<FMCore_SettingDependency> Dependencies;
+
 	// ============================================================================
 	// BEHAVIOR
 	// ============================================================================
@@ -0,0 +1,193 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_DA_SettingsRegistry.h
+ *
+ * Baked, pre-sorted flattening of every configured UMCore_DA_SettingsCollection.
+ * Produced offline by the ModulusBakeSettingsRegistry commandlet; at runtime
+ * UMCore_SettingsCollectionSubsystem loads this one asset instead of resolving
+ * each collection soft ref, bucketing categories and parsing tag parents.
+ *
+ * Everything is stored in arrays in a fixed order so two bakes of the same
+ * sources serialize to the same bytes.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+#include "MCore_DA_SettingsRegistry.generated.h"
+
+class UMCore_DA_SettingsCollection;
+
+/* One resolved setting. Array index in UMCore_DA_SettingsRegistry::Settings is its ordinal. */
+USTRUCT()
+struct MODULUSCORE_API FMCore_BakedSettingEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	TObjectPtr<UMCore_DA_SettingDefinition> Definition;
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	FGameplayTag SettingTag;
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	FGameplayTag CategoryTag;
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	FString SaveKey;
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	EMCore_SettingType SettingType{EMCore_SettingType::Toggle};
+
+	UPROPERTY(VisibleAnywhere, Category = "Identity")
+	int32 SortOrder{0};
+
+	/* Defaults -- only the field matching SettingType is meaningful */
+	UPROPERTY(VisibleAnywhere, Category = "Defaults")
+	float DefaultValue{0.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "Defaults")
+	int32 DefaultDropdownIndex{0};
+
+	UPROPERTY(VisibleAnywhere, Category = "Defaults")
+	bool bDefaultToggleValue{false};
+
+	/* Clamps */
+	UPROPERTY(VisibleAnywhere, Category = "Clamps")
+	float MinValue{0.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "Clamps")
+	float MaxValue{1.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "Clamps")
+	float StepSize{0.0f};
+
+	/* Highest index the player may select, +1. Dropdowns only. */
+	UPROPERTY(VisibleAnywhere, Category = "Clamps")
+	int32 NumSelectableOptions{0};
+
+	/* Apply targets */
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	FName NamedSetter;
+
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	FName ConsoleVariable;
+
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	FSoftObjectPath SoundClass;
+
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	FSoftObjectPath PushedSoundMix;
+
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	EModulusColorVisionRole ColorVisionRole{EModulusColorVisionRole::None};
+
+	UPROPERTY(VisibleAnywhere, Category = "Apply")
+	bool bRequiresConfirmation{false};
+};
+
+/* One leaf category with its rows already in display order. */
+USTRUCT()
+struct MODULUSCORE_API FMCore_BakedSettingCategory
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	FGameplayTag CategoryTag;
+
+	/* Direct parent tag (main tab); invalid for a root-level category. */
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	FGameplayTag ParentTag;
+
+	/* Collection-authored name; empty means "use the tag leaf". */
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	FText DisplayName;
+
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	int32 MinSortOrder{0};
+
+	/* Ordinals into Settings, sorted by SortOrder then ordinal. */
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	TArray<int32> SettingOrdinals;
+};
+
+/* Parent tag -> its leaf categories, in the order the panel builds tabs. */
+USTRUCT()
+struct MODULUSCORE_API FMCore_BakedCategoryGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	FGameplayTag ParentTag;
+
+	/* Indices into Categories. */
+	UPROPERTY(VisibleAnywhere, Category = "Category")
+	TArray<int32> CategoryIndices;
+};
+
+/**
+ * Flattened settings registry. Do not author by hand -- run
+ * `-run=ModulusBakeSettingsRegistry` and assign the result to
+ * UMCore_CoreSettings::BakedSettingsRegistry.
+ */
+UCLASS(Const)
+class MODULUSCORE_API UMCore_DA_SettingsRegistry : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================================================
+	// BAKED DATA
+	// ============================================================================
+
+	/* Collections the bake read, in CoreSettings order. Soft so loading the registry does not
+	   pull them in; only editor staleness checks resolve them. Runtime reads Settings. */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	TArray<TSoftObjectPtr<UMCore_DA_SettingsCollection>> SourceCollections;
+
+	/* Indexed by ordinal (collection order, then definition order; first listing of a save key wins). */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	TArray<FMCore_BakedSettingEntry> Settings;
+
+	/* Sorted by MinSortOrder, then tag name. */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	TArray<FMCore_BakedSettingCategory> Categories;
+
+	/* In first-encounter order over Categories. */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	TArray<FMCore_BakedCategoryGroup> CategoryGroups;
+
+	/* ComputeContentHash() at bake time; a mismatch against a fresh bake means the asset is stale. */
+	UPROPERTY(VisibleAnywhere, Category = "Registry")
+	uint32 ContentHash{0};
+
+	// ============================================================================
+	// LOOKUPS
+	// ============================================================================
+
+	/** Ordinal of the setting with this tag, or INDEX_NONE. */
+	int32 FindOrdinalByTag(const FGameplayTag& SettingTag) const;
+
+	/** Baked category for a leaf tag, or nullptr. */
+	const FMCore_BakedSettingCategory* FindCategory(const FGameplayTag& CategoryTag) const;
+
+	/** CRC over every baked field (object refs by path). Stable across runs and machines. */
+	uint32 ComputeContentHash() const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	/** Replaces all baked data with a flattening of Collections and refreshes ContentHash. */
+	void BakeFrom(TConstArrayView<UMCore_DA_SettingsCollection*> Collections);
+#endif
+
+private:
+	void BuildLookups();
+
+	TMap<FGameplayTag, int32> TagToOrdinal;
+	TMap<FGameplayTag, int32> CategoryToIndex;
+};
@@ -12,8 +12,11 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "GameFramework/SaveGame.h"
+#include "CoreData/Types/Settings/MCore_SettingsTypes.h"
 #include "MCore_PlayerSettingsSave.generated.h"
 
+struct FMCore_SettingsJournalRecord;
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPlayerSettingsLoaded, UMCore_PlayerSettingsSave*, PlayerSettings);
 
 /**
@@ -71,6 +74,10 @@ class MODULUSCORE_API UMCore_PlayerSettingsSave : public USaveGame
 	// GENERIC SETTING STORAGE
 	// ========================================================================
 
+	/* On-disk format, keyed by UMCore_DA_SettingDefinition::GetSaveKey(). Once ordinals
+	   are bound these only hold keys with no registered definition (kept verbatim for
+	   migrations); registered values live in the dense arrays below and are folded
+	   back in by SaveSettings. */
 	UPROPERTY(SaveGame)
 	TMap<FString, float> FloatSettings;
 
@@ -80,10 +87,59 @@ class MODULUSCORE_API UMCore_PlayerSettingsSave : public USaveGame
 	UPROPERTY(SaveGame)
 	TMap<FString, bool> BoolSettings;
 
+	// ========================================================================
+	// ORDINAL STORAGE
+	// ========================================================================
+
+	/** Moves registered values out of the keyed maps into dense arrays indexed by Table's
+	 *  ordinals. Rebinding to a newer table first folds current values back into the maps,
+	 *  so no value is lost across collection reloads. Null unbinds. */
+	void BindOrdinals(const TSharedPtr<const FMCore_SettingOrdinalTable>& Table);
+
+	bool IsBoundTo(const FMCore_SettingOrdinalTable* Table) const { return BoundOrdinals.Get() == Table; }
+
+	/* Definition-keyed accessors. O(1) array access when bound; fall back to the keyed
+	   maps (via GetSaveKey) when unbound or the definition isn't registered. */
+	bool GetFloatValue(const UMCore_DA_SettingDefinition* Setting, float& OutValue) const;
+	void SetFloatValue(const UMCore_DA_SettingDefinition* Setting, float Value);
+	bool GetIntValue(const UMCore_DA_SettingDefinition* Setting, int32& OutValue) const;
+	void SetIntValue(const UMCore_DA_SettingDefinition* Setting, int32 Value);
+	bool GetBoolValue(const UMCore_DA_SettingDefinition* Setting, bool& OutValue) const;
+	void SetBoolValue(const UMCore_DA_SettingDefinition* Setting, bool Value);
+
+	/** Version of the stored value a widget for Setting displays. A new version is taken
+	 *  from one process-wide counter whenever a write changes the value, so versions never
+	 *  repeat across saves -- compare for equality. Unregistered settings share one version. */
+	uint64 GetValueVersion(const UMCore_DA_SettingDefinition* Setting) const;
+
+	/** Version of LastSelectedQualityPreset, from the same counter as GetValueVersion. */
+	uint64 GetQualityPresetVersion() const { return QualityPresetVersion; }
+
+	/** True if any setting value changed since it was last persisted. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "ModulusCore|Settings")
+	bool HasUnsavedSettingChanges() const
+	{
+		return DirtyValues.Contains(true) || PendingKeyedWrites.Num() > 0 || bQualityPresetPendingPersist || bRequiresFullSave;
+	}
+
+	bool IsSettingDirty(int32 Ordinal) const
+	{
+		return DirtyValues.IsValidIndex(Ordinal) && DirtyValues[Ordinal];
+	}
+
+	/** Replaces every stored setting value with Source's, then rebinds. Framework UI state is untouched. */
+	void CopySettingValuesFrom(const UMCore_PlayerSettingsSave* Source);
+
+	/** Number of stored setting values across dense and keyed storage. */
+	int32 GetStoredSettingCount() const;
+
 	// ========================================================================
 	// GENERIC ACCESSORS
 	// ========================================================================
 
+	/* String-keyed compatibility layer. Keys belonging to a bound ordinal of the matching
+	   type route to dense storage; everything else reads and writes the keyed maps. */
+
 	/** Returns true and populates OutValue if a float value exists for the given key. */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "ModulusCore|Settings")
 	bool GetFloatSetting(const FString& Key, float& OutValue) const;
@@ -109,12 +165,26 @@ class MODULUSCORE_API UMCore_PlayerSettingsSave : public USaveGame
 	// PERSISTENCE
 	// ========================================================================
 
+	/**
+	 * Full save: writes a checksummed snapshot of everything, including framework UI
+	 * state, to whichever of the two snapshot slots is older, then empties the journal.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
 	void SaveSettings();
 
+	/**
+	 * Persists setting values written since the last persist. With the journal enabled
+	 * (UMCore_CoreSettings::bUseSettingsJournal) each value is one small appended record
+	 * and the journal is compacted into a SaveSettings once it reaches the configured
+	 * threshold; otherwise this is SaveSettings. Framework UI state is left to SaveSettings.
+	 */
+	void PersistSettingValues();
+
 	/**
 	 * Load player settings from disk (synchronous).
-	 * Returns existing save if found, or creates new instance with defaults.
+	 * Takes the newest snapshot slot that verifies and replays journal records newer
+	 * than it; a torn journal tail is dropped and compacted away immediately.
+	 * Returns a new instance with defaults if nothing is readable.
 	 * Caches the slot name on the returned object for use by SaveSettings().
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
@@ -128,8 +198,17 @@ class MODULUSCORE_API UMCore_PlayerSettingsSave : public USaveGame
 	UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
 	static void LoadPlayerSettingsAsync(const FString& SlotName, FOnPlayerSettingsLoaded OnLoaded);
 
+	/**
+	 * LoadPlayerSettings without any disk writes: a torn journal tail is dropped but left on disk.
+	 * For reading a slot whose live save object owns the files; that object compacts on its next full save.
+	 */
+	static UMCore_PlayerSettingsSave* ReadPlayerSettings(const FString& SlotName);
+
 	const FString& GetCachedSlotName() const { return CachedSlotName; }
 
+	/** Removes both snapshot slots and the journal of SlotName. */
+	static void DeletePlayerSettings(const FString& SlotName);
+
 	// ========================================================================
 	// FRAMEWORK CONVENIENCE
 	// ========================================================================
@@ -172,5 +251,74 @@ class MODULUSCORE_API UMCore_PlayerSettingsSave : public USaveGame
 private:
 	FString CachedSlotName;
 
+	/* Reads both snapshot slots and the journal; safe off the game thread. */
+	static void ReadPersistedData(const FString& SlotName,
+		TArray<uint8>& OutPrimary, TArray<uint8>& OutAlternate, TArray<uint8>& OutJournal);
+
+	/* Builds the save from ReadPersistedData's bytes (any may be empty). Game thread.
+	 * bCompactTornJournal saves the result straight back when the journal tail was torn. */
+	static UMCore_PlayerSettingsSave* LoadFromPersistedData(const FString& SlotName,
+		TArray<uint8>& PrimaryBytes, TArray<uint8>& AlternateBytes, const TArray<uint8>& JournalBytes,
+		bool bCompactTornJournal = true);
+
+	/* Journal records for every value written since the last persist, sequenced. */
+	void CollectPendingJournalRecords(TArray<FMCore_SettingsJournalRecord>& OutRecords);
+
+	void ClearPendingPersist();
+
 	void ApplyUIScale();
+
+	/* Ordinal of Key when bound and registered with ExpectedType, else INDEX_NONE. */
+	int32 FindDenseOrdinal(const FString& Key, EMCore_SettingType ExpectedType) const;
+	int32 FindDenseOrdinal(const UMCore_DA_SettingDefinition* Setting, EMCore_SettingType ExpectedType) const;
+
+	/* Flags Ordinal stored and dirty; takes a new value version if bChanged or it was unset. */
+	void MarkDenseValueWritten(int32 Ordinal, bool bChanged);
+
+	/* Writes every stored dense value back into the keyed maps. */
+	void FoldDenseValuesIntoMaps();
+
+	/* Pulls registered keys out of the keyed maps into the dense arrays. */
+	void DrainMapsIntoDenseValues();
+
+	TSharedPtr<const FMCore_SettingOrdinalTable> BoundOrdinals;
+
+	/* Indexed by ordinal; only the array matching the ordinal's SettingType is meaningful. */
+	TArray<float> FloatValues;
+	TArray<int32> IntValues;
+	TBitArray<> BoolValues;
+
+	/* Ordinal holds a stored value (absent = DataAsset default). */
+	TBitArray<> StoredValues;
+
+	/* Ordinal changed since it was last persisted. */
+	TBitArray<> DirtyValues;
+
+	/* Keyed-map writes not yet persisted, with the map they went to. */
+	TMap<FString, EMCore_SettingType> PendingKeyedWrites;
+
+	bool bQualityPresetPendingPersist{false};
+
+	/* Set by changes the journal cannot express (wholesale replacement); the next persist is a full save. */
+	bool bRequiresFullSave{false};
+
+	/* Snapshot this object was loaded from or last wrote: 0 primary slot, 1 alternate, INDEX_NONE neither. */
+	int32 SnapshotSlot{INDEX_NONE};
+	uint64 SnapshotGeneration{0};
+
+	/* Highest journal sequence handed out; the next snapshot records it as folded in. */
+	uint64 LastJournalSequence{0};
+
+	/* Sequence the current journal file starts after. */
+	uint64 JournalBaseSequence{0};
+
+	int32 NumJournalRecords{0};
+
+	/* Indexed by ordinal. See GetValueVersion. */
+	TArray<uint64> ValueVersions;
+
+	/* Shared by every value in the keyed maps. */
+	uint64 KeyedValuesVersion{0};
+
+	uint64 QualityPresetVersion{0};
 };
@@ -4,12 +4,16 @@
  * MCore_SettingsTypes.h
  *
  * Enums and structs supporting the DataAsset-driven settings system.
- * Defines setting widget types and batch change payloads.
+ * Defines setting widget types, batch change payloads, transactions, declarative
+ * dependencies between settings and the in-memory snapshots backing confirmation
+ * reverts and undo.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 #include "MCore_SettingsTypes.generated.h"
 
 class UMCore_DA_SettingDefinition;
@@ -23,6 +27,79 @@ enum class EMCore_SettingType : uint8
     Dropdown     UMETA(DisplayName = "Dropdown (Selection)")
 };
 
+/* How a setting depends on another (its Source). Declared on the dependent setting. */
+UENUM(BlueprintType)
+enum class EMCore_SettingDependencyType : uint8
+{
+    /* Source drives this setting: changing Source writes this setting's value */
+    DrivenBy     UMETA(DisplayName = "Driven By"),
+    /* This setting is disabled unless Source's value is inside the enabled range */
+    DisabledBy   UMETA(DisplayName = "Disabled By"),
+    /* This setting's value is clamped against Source's value */
+    ClampedTo    UMETA(DisplayName = "Clamped To")
+};
+
+/* Which side of the Source value a ClampedTo dependency keeps this setting on */
+UENUM(BlueprintType)
+enum class EMCore_SettingClampMode : uint8
+{
+    AtMost       UMETA(DisplayName = "At Most Source"),
+    AtLeast      UMETA(DisplayName = "At Least Source")
+};
+
+/* One typed edge from another setting to the setting declaring it. Values are
+   compared as floats: toggles read as 0/1, dropdowns as their option index. */
+USTRUCT(BlueprintType)
+struct MODULUSCORE_API FMCore_SettingDependency
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency")
+    EMCore_SettingDependencyType Type = EMCore_SettingDependencyType::DisabledBy;
+
+    /* Setting this one depends on */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (Categories = "Settings"))
+    FGameplayTag SourceSetting;
+
+    /* Value written for each Source value (index 0 = off / first option). Empty copies
+       the Source value. Source values past the end (e.g. a "Custom" preset) write nothing. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (EditCondition = "Type == EMCore_SettingDependencyType::DrivenBy", EditConditionHides))
+    TArray<float> DrivenValues;
+
+    /* Enabled while EnabledMinValue <= Source <= EnabledMaxValue. Defaults: enabled while a toggle is on. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (EditCondition = "Type == EMCore_SettingDependencyType::DisabledBy", EditConditionHides))
+    float EnabledMinValue{1.0f};
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (EditCondition = "Type == EMCore_SettingDependencyType::DisabledBy", EditConditionHides))
+    float EnabledMaxValue{TNumericLimits<float>::Max()};
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (EditCondition = "Type == EMCore_SettingDependencyType::ClampedTo", EditConditionHides))
+    EMCore_SettingClampMode ClampMode = EMCore_SettingClampMode::AtMost;
+
+    /* Added to the Source value before clamping */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dependency",
+        meta = (EditCondition = "Type == EMCore_SettingDependencyType::ClampedTo", EditConditionHides))
+    float ClampOffset{0.0f};
+};
+
+/* What one commit's dependency pass changed downstream of the settings the caller
+   wrote. Pushed to widgets through UMCore_GameSettingsLibrary::OnSettingDependentsUpdated. */
+struct FMCore_SettingDependencyUpdate
+{
+    /* Settings whose stored value was rewritten by a DrivenBy or ClampedTo edge */
+    TArray<FGameplayTag> ValueChangedTags;
+
+    /* Enabled state of every re-evaluated setting with a DisabledBy edge */
+    TMap<FGameplayTag, bool> EnabledStates;
+
+    bool IsEmpty() const { return ValueChangedTags.IsEmpty() && EnabledStates.IsEmpty(); }
+};
+
 /* Float setting + value pair for batch setter operations */
 USTRUCT(BlueprintType)
 struct MODULUSCORE_API FMCore_FloatSettingChange
@@ -67,3 +144,117 @@ struct MODULUSCORE_API FMCore_BoolSettingChange
         meta = (DisplayName = "Value"))
     bool Value = false;
 };
+
+/* Mixed-type batch of setting changes, committed atomically through
+   UMCore_GameSettingsLibrary::CommitSettingsTransaction: one clamp pass, one
+   engine flush, one save and one coalesced SettingsChanged event. */
+USTRUCT(BlueprintType)
+struct MODULUSCORE_API FMCore_SettingsTransaction
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+    TArray<FMCore_FloatSettingChange> FloatChanges;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+    TArray<FMCore_IntSettingChange> IntChanges;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings")
+    TArray<FMCore_BoolSettingChange> BoolChanges;
+
+    void AddFloat(UMCore_DA_SettingDefinition* Setting, float Value) { FloatChanges.Add({ Setting, Value }); }
+    void AddInt(UMCore_DA_SettingDefinition* Setting, int32 Value) { IntChanges.Add({ Setting, Value }); }
+    void AddBool(UMCore_DA_SettingDefinition* Setting, bool Value) { BoolChanges.Add({ Setting, Value }); }
+
+    int32 Num() const { return FloatChanges.Num() + IntChanges.Num() + BoolChanges.Num(); }
+    bool IsEmpty() const { return Num() == 0; }
+
+    void Reset()
+    {
+        FloatChanges.Reset();
+        IntChanges.Reset();
+        BoolChanges.Reset();
+    }
+};
+
+/* Dense index over every registered setting definition, built once per collection
+   resolve by UMCore_SettingsCollectionSubsystem. Immutable once published — a
+   rebuild produces a new table, so holders compare by pointer to detect it.
+   Ordinals follow collection order, then definition order within a collection. */
+struct FMCore_SettingOrdinalTable
+{
+    /* Ordinal -> persisted save key / value type */
+    TArray<FString> SaveKeys;
+    TArray<EMCore_SettingType> Types;
+
+    TMap<const UMCore_DA_SettingDefinition*, int32> DefinitionToOrdinal;
+    TMap<FString, int32> SaveKeyToOrdinal;
+
+    int32 Num() const { return SaveKeys.Num(); }
+
+    int32 FindOrdinal(const UMCore_DA_SettingDefinition* Setting) const
+    {
+        const int32* Found = DefinitionToOrdinal.Find(Setting);
+        return Found ? *Found : INDEX_NONE;
+    }
+
+    int32 FindOrdinal(const FString& SaveKey) const
+    {
+        const int32* Found = SaveKeyToOrdinal.Find(SaveKey);
+        return Found ? *Found : INDEX_NONE;
+    }
+};
+
+/* Pre-change value of one setting. Only the field matching the definition's
+   SettingType is meaningful. */
+struct FMCore_SettingSnapshotEntry
+{
+    TWeakObjectPtr<const UMCore_DA_SettingDefinition> Setting;
+    float FloatValue = 0.f;
+    int32 IntValue = 0;
+    bool bBoolValue = false;
+};
+
+/* In-memory capture of the values a set of settings held before a change.
+   Restoring it re-applies only these settings; no disk I/O. */
+struct FMCore_SettingsSnapshot
+{
+    /* Capture order, which restore replays. Append through AddEntry so CapturedSettings stays in step. */
+    TArray<FMCore_SettingSnapshotEntry> Entries;
+
+    /* Keys of Entries, so the per-change "already captured?" check is O(1) */
+    TSet<TObjectKey<UMCore_DA_SettingDefinition>> CapturedSettings;
+
+    /* LastSelectedQualityPreset at capture time, set when the snapshot covers
+       OverallScalabilityLevel (the preset cascade rewrites every child key). */
+    TOptional<int32> QualityPreset;
+
+    bool IsEmpty() const { return Entries.IsEmpty(); }
+
+    bool Contains(const UMCore_DA_SettingDefinition* Setting) const
+    {
+        return CapturedSettings.Contains(Setting);
+    }
+
+    FMCore_SettingSnapshotEntry& AddEntry(const UMCore_DA_SettingDefinition* Setting)
+    {
+        CapturedSettings.Add(Setting);
+        FMCore_SettingSnapshotEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Setting = Setting;
+        return Entry;
+    }
+};
+
+/* Session-only revert/undo state for one local player. Owned by
+   UMCore_PlayerSettingsSubsystem, driven by UMCore_GameSettingsLibrary. */
+struct FMCore_SettingsHistory
+{
+    /* Values held before the changes currently awaiting confirmation. First capture per setting wins. */
+    FMCore_SettingsSnapshot PendingConfirmation;
+
+    /* Set when a save ran while PendingConfirmation was non-empty, i.e. unconfirmed values reached disk. */
+    bool bPendingConfirmationPersisted = false;
+
+    /* One entry per committed pass, most recent last. Bounded by UMCore_CoreSettings::SettingsUndoDepth. */
+    TArray<FMCore_SettingsSnapshot> UndoStack;
+};
@@ -61,3 +61,24 @@ public:
 		, TabIcon(nullptr)
   	{}
 };
+
+/**
+ * Page construction state of one menu hub. Bytes count the UObjects of each live page
+ * and every widget it owns; Slate-side memory is not included.
+ */
+USTRUCT(BlueprintType)
+struct MODULUSCORE_API FMCore_MenuPageStats
+{
+	GENERATED_BODY()
+
+	/* Tabs whose page widget is constructed */
+	UPROPERTY(BlueprintReadOnly, Category = "Menu Tab")
+	int32 LivePages{0};
+
+	/* Tabs holding a placeholder until first selected, or after being unloaded */
+	UPROPERTY(BlueprintReadOnly, Category = "Menu Tab")
+	int32 PlaceholderPages{0};
+
+	UPROPERTY(BlueprintReadOnly, Category = "Menu Tab")
+	int64 LivePageBytes{0};
+};
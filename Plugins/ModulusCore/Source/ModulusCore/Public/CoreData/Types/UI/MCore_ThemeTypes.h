@@ -4,16 +4,32 @@
  * MCore_ThemeTypes.h
  *
  * Data types for the theme system. FMCore_ThemeEntry maps a display name
- * and description to a soft-referenced theme DataAsset.
+ * and description to a soft-referenced theme DataAsset. EMCore_ThemeTextRole
+ * and FMCore_ResolvedThemeStyles back the UI subsystem's resolved style table.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Styling/SlateTypes.h"
+#include "Templates/SubclassOf.h"
 #include "MCore_ThemeTypes.generated.h"
 
+class UCommonTextStyle;
 class UMCore_PDA_UITheme_Base;
 
+/** Text style slots of a theme. Widgets resolve their style by role instead of reading the theme's arrays. */
+UENUM(BlueprintType)
+enum class EMCore_ThemeTextRole : uint8
+{
+	Heading,
+	Label,
+	Value,
+	Description,
+	MAX UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct MODULUSCORE_API FMCore_ThemeEntry
 {
@@ -30,3 +46,21 @@ struct MODULUSCORE_API FMCore_ThemeEntry
 
 	bool IsValid() const { return !ThemeAsset.IsNull(); }
 };
+
+/**
+ * The active theme's styles resolved for one text size index. Built once per theme
+ * or text-size change; every lookup after that is an array index. Holds no strong
+ * references -- the theme asset keeps its style classes alive.
+ */
+struct FMCore_ResolvedThemeStyles
+{
+	const UMCore_PDA_UITheme_Base* Theme{nullptr};
+	int32 TextSizeIndex{INDEX_NONE};
+
+	TStaticArray<TSubclassOf<UCommonTextStyle>, static_cast<int32>(EMCore_ThemeTextRole::MAX)> TextStyles;
+
+	/* Built from the theme's SliderStyle asset; unset when the theme has none */
+	TOptional<FSliderStyle> SliderStyle;
+
+	bool IsResolved() const { return Theme != nullptr; }
+};
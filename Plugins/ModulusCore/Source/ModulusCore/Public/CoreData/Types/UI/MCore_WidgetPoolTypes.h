@@ -0,0 +1,73 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_WidgetPoolTypes.h
+ *
+ * Screen widget pooling data for UMCore_UISubsystem: per-layer, per-class
+ * instance buckets and the counters exposed for profiling.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "MCore_WidgetPoolTypes.generated.h"
+
+class SWidget;
+class UMCore_ActivatableBase;
+
+/**
+ * Widget pool counters since the UISubsystem was created (or last reset).
+ * A healthy menu flow settles at a handful of misses and then only hits.
+ */
+USTRUCT(BlueprintType)
+struct MODULUSCORE_API FMCore_WidgetPoolStats
+{
+	GENERATED_BODY()
+
+	/* Opens served by a closed pooled instance */
+	UPROPERTY(BlueprintReadOnly, Category = "Widget Pool")
+	int32 Hits{0};
+
+	/* Opens of a poolable class that had to create a widget */
+	UPROPERTY(BlueprintReadOnly, Category = "Widget Pool")
+	int32 Misses{0};
+
+	/* Closed instances dropped because their bucket was over its cap */
+	UPROPERTY(BlueprintReadOnly, Category = "Widget Pool")
+	int32 Evictions{0};
+
+	/* Instances currently owned by the pool, open or closed */
+	UPROPERTY(BlueprintReadOnly, Category = "Widget Pool")
+	int32 PooledInstances{0};
+};
+
+/* One pooled widget and its Slate widget. */
+USTRUCT()
+struct FMCore_PooledWidget
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UMCore_ActivatableBase> Widget;
+
+	/* Held so the stack releasing the widget does not destroy it (and run NativeDestruct);
+	   a reopened instance keeps the bindings it made in NativeOnInitialized. */
+	TSharedPtr<SWidget> CachedSlateWidget;
+};
+
+/* Every pooled instance of one widget class on one layer. */
+USTRUCT()
+struct FMCore_WidgetPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag LayerTag;
+
+	UPROPERTY()
+	TObjectPtr<UClass> WidgetClass;
+
+	UPROPERTY()
+	TArray<FMCore_PooledWidget> Instances;
+};
@@ -4,22 +4,27 @@
  * MCore_UISubsystem.h
  *
  * Per-player UI subsystem managing widget lifecycle, layer stacks,
- * menu hub orchestration, and theme distribution.
+ * screen widget pooling, menu hub orchestration, and theme distribution.
  */
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
 #include "GameplayTagContainer.h"
 #include "CoreUI/Widgets/MCore_PrimaryGameLayout.h"
 #include "CoreData/Types/UI/MCore_MenuTabTypes.h"
 #include "CoreData/Types/UI/MCore_ThemeTypes.h"
+#include "CoreData/Types/UI/MCore_WidgetPoolTypes.h"
 #include "MCore_UISubsystem.generated.h"
 
 class UCommonActivatableWidgetStack;
 class UCommonActivatableWidget;
 class UMCore_PDA_UITheme_Base;
+class UMCore_ActivatableBase;
 class UMCore_GameMenuHub;
 class UMCore_PrimaryGameLayout;
 class UTexture2D;
@@ -29,6 +34,8 @@ struct FMCore_EventData;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnThemeChanged, UMCore_PDA_UITheme_Base*, NewTheme);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPrimaryGameLayoutReady, UMCore_PrimaryGameLayout*, Layout);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWidgetLayerChanged, UCommonActivatableWidget*, Widget, FGameplayTag, LayerTag);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnScreenOpened, UCommonActivatableWidget*, Screen);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMenuHubWarmUpProgress, float, Progress, bool, bFinished);
 
 
 /**
@@ -64,6 +71,31 @@ public:
 		UPARAM(meta = (Categories = "MCore.UI.Layer")) FGameplayTag LayerTag,
 		bool bAllowDuplicates = false);
 
+	/**
+	 * Streams ScreenClass and opens it on LayerTag once loaded, without a hitch on first use.
+	 * PlaceholderClass, if set, is pushed to the layer meanwhile and closed when the screen opens.
+	 * Closing the placeholder, clearing the layer or CancelOpenScreenAsync cancels the open.
+	 * OnOpened receives the screen, or nullptr if the load failed or was cancelled.
+	 * Returns the request id, or INDEX_NONE if the request already finished (class was loaded).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI", meta = (AutoCreateRefTerm = "OnOpened"))
+	int32 OpenScreenAsync(TSoftClassPtr<UCommonActivatableWidget> ScreenClass,
+		UPARAM(meta = (Categories = "MCore.UI.Layer")) FGameplayTag LayerTag,
+		const FOnScreenOpened& OnOpened,
+		TSubclassOf<UCommonActivatableWidget> PlaceholderClass = nullptr,
+		bool bAllowDuplicates = false);
+
+	/** Cancels a pending OpenScreenAsync. Returns false if the request already finished. */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI")
+	bool CancelOpenScreenAsync(int32 RequestId);
+
+	UFUNCTION(BlueprintPure, Category = "MCore|UI")
+	bool IsOpenScreenAsyncPending(int32 RequestId) const;
+
+	/** Closes every tracked screen on the layer and cancels async opens targeting it. Returns screens closed. */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI")
+	int32 ClearLayer(UPARAM(meta = (Categories = "MCore.UI.Layer")) FGameplayTag LayerTag);
+
 	/** Closes a screen: untracks it and deactivates it. */
 	UFUNCTION(BlueprintCallable, Category = "MCore|UI")
 	void CloseScreen(UCommonActivatableWidget* Screen);
@@ -97,6 +129,54 @@ public:
 
 	void NotifyWidgetDestroyed(UCommonActivatableWidget* Widget);
 
+// ============================================================================
+// WIDGET POOL
+// ============================================================================
+
+	/**
+	 * Screens of UMCore_ActivatableBase classes are kept per layer and class once closed,
+	 * and the next open of that class on that layer reuses one after ResetForReuse.
+	 * Caps and the global switch live in UMCore_CoreSettings; bAllowPooling opts a class out.
+	 */
+	UFUNCTION(BlueprintPure, Category = "MCore|UI|Pool")
+	FMCore_WidgetPoolStats GetWidgetPoolStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI|Pool")
+	void ResetWidgetPoolStats();
+
+	/** Releases every closed pooled instance to GC. Open screens stay pooled. */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI|Pool")
+	void TrimWidgetPool();
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Opens ScreenClass fresh, closes it, reopens it from the pool and compares the widget
+	 * tree state of both opens. Result is logged. Backs Modulus.UI.WidgetPool.Verify.
+	 */
+	void VerifyPooledReopen(TSubclassOf<UCommonActivatableWidget> ScreenClass, FGameplayTag LayerTag);
+
+	/**
+	 * Cross-checks the per-layer tracking arrays against the widget->layer and
+	 * (layer, class)->screen indices. Logs the first mismatch and returns false.
+	 */
+	bool VerifyWidgetTracking() const;
+
+	/**
+	 * Runs Iterations random opens, duplicate opens, closes, pops and out-of-band
+	 * deactivations of ScreenClass on the Menu and Modal layers, verifying tracking
+	 * after each step. Backs Modulus.UI.Tracking.Stress. Returns true if every step passed.
+	 */
+	bool RunWidgetTrackingStress(TSubclassOf<UCommonActivatableWidget> ScreenClass, int32 Iterations, int32 Seed);
+
+	/**
+	 * Restyles NumTextBlocks transient text blocks through the pre-table path
+	 * (ThemeLibrary::ApplyTextStyleFromSettings) and through the resolved style table, and logs
+	 * both, with the one-off table rebuild timed on its own.
+	 * Backs Modulus.UI.Theme.RestyleBenchmark.
+	 */
+	void RunRestyleBenchmark(int32 NumTextBlocks);
+#endif
+
 // ============================================================================
 // MENU HUB
 // ============================================================================
@@ -109,7 +189,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCore|UI|MenuHub")
 	void CloseMenuHub();
 
-	/** Register a menu screen tab in the MenuHub. Duplicate TabIDs are rejected. */
+	/**
+	 * Register a menu screen tab in the MenuHub. Duplicate TabIDs are rejected.
+	 * An open hub adds the tab at the end of the frame, batched with other registration changes.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "MCore|UI|MenuHub")
 	void RegisterMenuScreen(
 		FGameplayTag TabID,
@@ -124,9 +207,33 @@ public:
 	UFUNCTION(BlueprintPure, Category = "MCore|UI|MenuHub")
 	const TArray<FMCore_MenuTab>& GetRegisteredMenuScreens() const { return RegisteredMenuScreens; }
 
-	/** Force rebuild of MenuHub tab bar. Auto-called when screens registered/unregistered while hub is active. */
+	/** Force a full rebuild of the open MenuHub's tab bar, recreating every page. */
 	UFUNCTION(BlueprintCallable, Category = "MCore|UI|MenuHub")
 	void RebuildMenuHubTabBar();
+
+	/**
+	 * Constructs the menu hub and its tab pages dormant in the widget pool, a slice per frame,
+	 * so the first OpenMenuHub only activates them. Call behind a loading screen with a larger
+	 * budget to finish sooner. FrameBudgetMs <= 0 uses CoreSettings MenuHubWarmUpBudgetMs.
+	 * Returns false if widget pooling is off for the GameMenu layer.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI|MenuHub")
+	bool BeginMenuHubWarmUp(float FrameBudgetMs = 0.0f);
+
+	/** Stops a warm-up; what was built stays pooled and OpenMenuHub builds the rest. */
+	UFUNCTION(BlueprintCallable, Category = "MCore|UI|MenuHub")
+	void CancelMenuHubWarmUp();
+
+	UFUNCTION(BlueprintPure, Category = "MCore|UI|MenuHub")
+	bool IsMenuHubWarmUpInProgress() const { return MenuHubWarmUpTicker.IsValid(); }
+
+	/** Fraction of the hub and its pages constructed by the last warm-up; 1 once warm. */
+	UFUNCTION(BlueprintPure, Category = "MCore|UI|MenuHub")
+	float GetMenuHubWarmUpProgress() const { return MenuHubWarmUpProgress; }
+
+	/* Broadcast after every warm-up slice; bFinished on the last one (Progress < 1 if it failed) */
+	UPROPERTY(BlueprintAssignable, Category = "MCore|UI|MenuHub")
+	FOnMenuHubWarmUpProgress OnMenuHubWarmUpProgress;
 	
 // ============================================================================
 // THEME
@@ -144,13 +251,41 @@ public:
 	UFUNCTION(BlueprintPure, Category = "UI|Theme")
 	int32 GetActiveThemeIndex() const { return ActiveThemeIndex; }
 
+	/**
+	 * Switches to the theme at ThemeIndex. The theme streams in asynchronously; the current
+	 * theme stays applied until the new one and everything it references is resident, then
+	 * OnThemeChanged fires once. A newer request replaces a pending one.
+	 * Returns false if the index or its asset is invalid.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "UI|Theme")
 	bool SetActiveThemeByIndex(int32 ThemeIndex);
 
+	/** True while a theme requested by SetActiveThemeByIndex is still streaming. */
+	UFUNCTION(BlueprintPure, Category = "UI|Theme")
+	bool IsThemeLoadInProgress() const { return PendingThemeIndex != INDEX_NONE; }
+
+	/** Theme index being streamed in, or INDEX_NONE. */
+	UFUNCTION(BlueprintPure, Category = "UI|Theme")
+	int32 GetPendingThemeIndex() const { return PendingThemeIndex; }
+
 	/** Re-broadcasts OnThemeChanged so all widgets re-resolve text styles at the new size index. */
 	UFUNCTION(BlueprintCallable, Category = "UI|Theme")
 	void NotifyTextSizeChanged();
 
+	/**
+	 * Active theme's text style for Role at the player's text size. Served from a table
+	 * resolved once per theme or text-size change, so restyling many widgets is a lookup each.
+	 */
+	UFUNCTION(BlueprintPure, Category = "UI|Theme")
+	TSubclassOf<UCommonTextStyle> GetResolvedTextStyle(EMCore_ThemeTextRole Role) const;
+
+	/** Text size index the style table was resolved for. */
+	UFUNCTION(BlueprintPure, Category = "UI|Theme")
+	int32 GetResolvedTextSizeIndex() const;
+
+	/** Active theme's slider style, built once from its SliderStyle asset. Null if the theme has none. */
+	const FSliderStyle* GetResolvedSliderStyle() const;
+
 protected:
 	/* Widget class for PrimaryGameLayout. Set in project defaults or override in Blueprint. */
 	UPROPERTY(EditDefaultsOnly, Category = "Modulus|UI")
@@ -174,14 +309,83 @@ protected:
 
 private:
 	void LoadWidgetClasses();
+	void HandleMenuHubClassLoaded();
+
+	/* MenuHubClass, loading it synchronously if OpenMenuHub runs before the stream finished */
+	TSubclassOf<UMCore_GameMenuHub> ResolveMenuHubClass();
 	void BuildLayerStackMap();
+	/* Untracks destroyed widgets and closed ones still alive in the pool; clears the layer's dirty flag */
 	void CompactTrackedWidgets(FGameplayTag LayerTag);
 
+	/* Bound to each tracked widget's OnDeactivated; flags its layer for compaction */
+	void HandleTrackedWidgetDeactivated(FGameplayTag LayerTag);
+
+	/* Activated, or deactivated under another screen on the same stack */
+	bool IsWidgetOpen(const UCommonActivatableWidget* Widget, FGameplayTag LayerTag) const;
+
+	/* Same check against a prebuilt GetStackWidgetSet, for passes over a whole layer */
+	static bool IsWidgetOpen(const UCommonActivatableWidget* Widget, const TSet<const UCommonActivatableWidget*>& StackWidgets);
+	TSet<const UCommonActivatableWidget*> GetStackWidgetSet(FGameplayTag LayerTag) const;
+
 	UCommonActivatableWidgetStack* GetLayerStack(FGameplayTag LayerTag) const;
 	UCommonActivatableWidget* PushWidgetToLayer(TSubclassOf<UCommonActivatableWidget> WidgetClass, FGameplayTag LayerTag);
+
+	/* Widget owned by the subsystem (PlayerController as Outer), for instance-based pushes */
+	UCommonActivatableWidget* CreateLayerWidget(TSubclassOf<UCommonActivatableWidget> WidgetClass);
+
+	bool CanPoolWidgetClass(TSubclassOf<UCommonActivatableWidget> WidgetClass) const;
+	int32 GetWidgetPoolCap(FGameplayTag LayerTag) const;
+
+	/* Closed pooled instance of WidgetClass on LayerTag, reset for reuse, or a new pooled instance */
+	UCommonActivatableWidget* AcquirePooledWidget(TSubclassOf<UCommonActivatableWidget> WidgetClass, FGameplayTag LayerTag);
+
+	/* Closed pooled instance or a new pooled one, without resetting it or counting an open */
+	UMCore_ActivatableBase* PrewarmPooledWidget(TSubclassOf<UCommonActivatableWidget> WidgetClass, FGameplayTag LayerTag);
+
+	FMCore_WidgetPoolBucket& FindOrAddPoolBucket(TSubclassOf<UCommonActivatableWidget> WidgetClass, FGameplayTag LayerTag);
+	UMCore_ActivatableBase* AddPooledInstance(FMCore_WidgetPoolBucket& Bucket);
+
+	/* Drops closed instances past MaxIdle */
+	void TrimPoolBucket(FMCore_WidgetPoolBucket& Bucket, int32 MaxIdle);
+
+	bool IsPooledWidgetIdle(const FMCore_PooledWidget& Entry, FGameplayTag LayerTag) const;
+
+	/* Adds Widget to LayerTag's tracking and both indices; moves it if it was tracked elsewhere */
+	void TrackWidget(UCommonActivatableWidget* Widget, FGameplayTag LayerTag);
 	void UntrackWidget(UCommonActivatableWidget* Widget, FGameplayTag LayerTag);
+
+	/* Points the (layer, class) index at the newest remaining instance, or drops the entry */
+	void RefreshTrackedScreenIndex(FGameplayTag LayerTag, const UClass* WidgetClass);
+	void RebuildTrackedScreenIndex(FGameplayTag LayerTag);
 	UMCore_GameMenuHub* FindTrackedMenuHub() const;
 
+	/* Resolved style table for the active theme, rebuilt on first use after a theme or size change */
+	const FMCore_ResolvedThemeStyles& GetResolvedStyles() const;
+	void InvalidateResolvedStyles();
+
+	/* Player's text size setting, read through the settings save */
+	int32 ReadTextSizeIndex() const;
+
+	void HandleThemeLoaded(int32 ThemeIndex);
+
+	/* Swaps in a resident theme and broadcasts OnThemeChanged */
+	void ApplyLoadedTheme(int32 ThemeIndex, UMCore_PDA_UITheme_Base* Theme);
+
+	/* Completes a pending theme load on the spot; used where a themeless frame is worse than a hitch */
+	void FlushPendingThemeLoad();
+
+	void CancelPendingThemeLoad();
+
+	/* Streams the neighbours of the active theme and releases every other inactive theme */
+	void UpdateThemePreloads();
+
+	/* Schedules one end-of-frame sync of the open hub's tabs for any number of registration changes */
+	void QueueMenuHubTabSync();
+	bool FlushMenuHubTabSync(float DeltaTime);
+
+	bool TickMenuHubWarmUp(float DeltaTime);
+	void FinishMenuHubWarmUp(const TCHAR* Outcome);
+
 	/* Creates and adds PrimaryGameLayout to viewport */
 	void CreatePrimaryGameLayout();
 	/* Deferred layout creation once PlayerController is ready */
@@ -189,6 +393,28 @@ private:
 	
 	void HandleLocalEvent(const FMCore_EventData& EventData);
 
+	struct FPendingScreenOpen
+	{
+		int32 RequestId{INDEX_NONE};
+		FGameplayTag LayerTag;
+		TSoftClassPtr<UCommonActivatableWidget> ScreenClass;
+		FOnScreenOpened OnOpened;
+		bool bAllowDuplicates{false};
+
+		/* Shown while streaming; bHasPlaceholder stays set so a closed one still cancels */
+		TWeakObjectPtr<UCommonActivatableWidget> Placeholder;
+		bool bHasPlaceholder{false};
+
+		TSharedPtr<FStreamableHandle> LoadHandle;
+	};
+
+	void HandleScreenClassLoaded(int32 RequestId);
+
+	/* Removes matching requests, stops their loads and placeholders, and reports nullptr to each */
+	int32 CancelScreenOpenRequests(TFunctionRef<bool(const FPendingScreenOpen&)> Predicate, const TCHAR* Reason);
+
+	void ClosePlaceholder(FPendingScreenOpen& Request);
+
 	FDelegateHandle PlayerControllerReadyHandle;
 	FDelegateHandle LocalEventHandle;
 	
@@ -200,13 +426,52 @@ private:
 	TObjectPtr<UMCore_PDA_UITheme_Base> CachedActiveTheme;
 
 	int32 ActiveThemeIndex{INDEX_NONE};
+
+	mutable FMCore_ResolvedThemeStyles ResolvedStyles;
+
+	int32 PendingThemeIndex{INDEX_NONE};
+	TSharedPtr<FStreamableHandle> PendingThemeHandle;
+
+	/* Keeps preloaded neighbour themes resident; keyed by AvailableThemes index */
+	TMap<int32, TSharedPtr<FStreamableHandle>> ThemePreloadHandles;
 	
 	UPROPERTY(Transient)
 	TMap<FGameplayTag, TObjectPtr<UCommonActivatableWidgetStack>> LayerStackMap;
 
-	/* Widgets pushed via PushWidgetToLayer, tracked per-layer with weak refs */
+	/* Widgets pushed via PushWidgetToLayer, tracked per-layer with weak refs in push order */
 	TMap<FGameplayTag, TArray<TWeakObjectPtr<UCommonActivatableWidget>>> TrackedWidgets;
 
+	/* Layer each tracked widget lives on, so closing one never searches every layer */
+	TMap<TWeakObjectPtr<UCommonActivatableWidget>, FGameplayTag> TrackedWidgetLayers;
+
+	/* Newest tracked instance per (layer, exact class); OpenScreen's duplicate check */
+	using FTrackedScreenKey = TPair<FGameplayTag, TObjectKey<UClass>>;
+	TMap<FTrackedScreenKey, TWeakObjectPtr<UCommonActivatableWidget>> TrackedScreenIndex;
+
+	/* Layers where a tracked widget deactivated since the last CompactTrackedWidgets */
+	TSet<FGameplayTag> DirtyTrackedLayers;
+
+	/* Pooled screen instances, one bucket per layer and class */
+	UPROPERTY(Transient)
+	TArray<FMCore_WidgetPoolBucket> WidgetPool;
+
+	FMCore_WidgetPoolStats WidgetPoolStats;
+
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> MenuHubClassHandle;
+
+	TArray<FPendingScreenOpen> PendingScreenOpens;
+	int32 NextScreenOpenRequestId{1};
+
+	FTSTicker::FDelegateHandle MenuHubTabSyncTicker;
+	FTSTicker::FDelegateHandle MenuHubWarmUpTicker;
+
+	/* Pooled, dormant hub being warmed; the pool holds the strong reference */
+	TWeakObjectPtr<UMCore_GameMenuHub> WarmMenuHub;
+
+	double MenuHubWarmUpBudgetSeconds{0.0};
+	float MenuHubWarmUpProgress{0.0f};
+
 	/* Registered menu screens for this local player */
 	UPROPERTY(Transient)
 	TArray<FMCore_MenuTab> RegisteredMenuScreens;
@@ -0,0 +1,87 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_KeyBindingListView.h
+ *
+ * Virtualized key binding page. Each row is an action (or a category header);
+ * only rows in view get an entry widget, and KeyBindingRow widgets are recycled
+ * as the page scrolls.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ListView.h"
+#include "MCore_KeyBindingListView.generated.h"
+
+class UInputAction;
+class UMCore_KeyBindingRow;
+class UMCore_SettingsSectionHeader;
+
+/**
+ * One action row of a virtualized key binding page. Holds no key state; rows
+ * read the current bindings from the active key profile whenever they are bound.
+ * Category headers reuse UMCore_SettingsListItem so UMCore_SettingsSectionHeader
+ * can display them unchanged.
+ */
+UCLASS(BlueprintType)
+class MODULUSCORE_API UMCore_KeyBindingListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "UI|KeyBinding")
+	TObjectPtr<UInputAction> Action;
+};
+
+/**
+ * List view for one key binding page. Action rows use the panel's KeyBindingRowClass,
+ * category headers use CoreSettings' SettingsSectionHeaderWidgetClass.
+ * Headers are skipped by selection and gamepad navigation.
+ */
+UCLASS(ClassGroup = "ModulusUI")
+class MODULUSCORE_API UMCore_KeyBindingListView : public UListView
+{
+	GENERATED_BODY()
+
+public:
+	/** Entry class for action rows. Must be set before the first SetCategorizedActions. */
+	void SetRowClass(TSubclassOf<UMCore_KeyBindingRow> InRowClass) { RowClass = InRowClass; }
+
+	/**
+	 * Appends a category: a header row when CoreSettings has a header class, then one row
+	 * per action. Call ResetRows first, and CommitRows once every category is added.
+	 */
+	void AddCategory(const FText& CategoryDisplayName, TConstArrayView<UInputAction*> Actions);
+
+	void ResetRows();
+	void CommitRows();
+
+	/** Number of action rows, headers excluded. */
+	int32 GetNumActionRows() const { return NumActionRows; }
+
+	/** Entries currently bound to action rows. Rows scrolled out of view have none. */
+	TArray<UMCore_KeyBindingRow*> GetDisplayedRows() const;
+
+	/**
+	 * CoreSettings' KeyBindingListViewClass when virtualized pages are on and it has an
+	 * EntryWidgetClass; null means build a scroll box page instead.
+	 */
+	static TSubclassOf<UMCore_KeyBindingListView> GetConfiguredClass();
+
+protected:
+	virtual UUserWidget& OnGenerateEntryWidgetInternal(UObject* Item,
+		TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable) override;
+
+	virtual bool OnIsSelectableOrNavigableInternal(UObject* FirstSelectedItem) override;
+
+private:
+	UPROPERTY(Transient)
+	TSubclassOf<UMCore_KeyBindingRow> RowClass;
+
+	/* Backing array for SetListItems; the list view only holds raw pointers */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> Rows;
+
+	int32 NumActionRows{0};
+};
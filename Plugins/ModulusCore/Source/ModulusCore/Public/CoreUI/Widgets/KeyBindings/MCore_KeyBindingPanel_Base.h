@@ -4,7 +4,8 @@
  * MCore_KeyBindingPanel_Base.h
  *
  * Key binding panel that queries remappable actions per InputMappingContext
- * and builds grouped rows inside a tabbed container.
+ * and builds grouped rows inside a tabbed container. Rows follow binding
+ * changes through the Enhanced Input user settings notification.
  * Displayed inline in the Settings Panel's KeyBinding category tab.
  */
 
@@ -12,12 +13,15 @@
 
 #include "CoreMinimal.h"
 #include "CommonUserWidget.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
 #include "MCore_KeyBindingPanel_Base.generated.h"
 
 class UScrollBox;
 class UMCore_TabbedContainer;
 class UMCore_ButtonBase;
 class UMCore_KeyBindingRow;
+class UMCore_KeyBindingListView;
 class UMCore_KeyBindingButton;
 class UMCore_KeyBindingCaptureDialog;
 class UMCore_ConfirmationDialog;
@@ -25,11 +29,14 @@ class UMCore_PDA_UITheme_Base;
 class UCommonTextBlock;
 class UInputAction;
 class UInputMappingContext;
+class UEnhancedInputUserSettings;
 class APlayerController;
+struct FPlayerKeyMapping;
 
 /**
  * Key binding panel that populates a TabbedContainer with one tab per InputMappingContext.
- * Each tab contains category headers and binding rows in a ScrollBox.
+ * Each tab contains category headers and binding rows in a ScrollBox, or a recycling
+ * UMCore_KeyBindingListView when CoreSettings' bVirtualizeSettingsLists is on.
  * Falls back to a single flat page if no KeyBindingContexts are configured in CoreSettings.
  *
  * Requires BindWidget: TabbedContainer_Contexts.
@@ -45,7 +52,11 @@ public:
 	// PUBLIC API
 	// ====================================================================
 
-	/** Query all remappable actions, group by IMC and category, and spawn rows into tabs. */
+	/**
+	 * Query all remappable actions, group by IMC and category, and spawn rows into tabs.
+	 * Configured contexts that are not resident yet are streamed in first and the panel is
+	 * populated when they arrive.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "UI|KeyBinding")
 	void PopulateBindings(APlayerController* OwningPlayer);
 
@@ -53,6 +64,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UI|KeyBinding")
 	void RefreshAllRows();
 
+	/**
+	 * Refresh only rows whose action's keys changed since the last refresh.
+	 * Runs on its own a frame after any Enhanced Input settings change.
+	 * Returns the number of rows refreshed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI|KeyBinding")
+	int32 RefreshChangedRows();
+
 	// ====================================================================
 	// BLUEPRINT HOOKS
 	// ====================================================================
@@ -62,12 +81,18 @@ public:
 	void OnContextTabCreated(FName TabID, UWidget* PageWidget, const FText& ContextDisplayName);
 	virtual void OnContextTabCreated_Implementation(FName TabID, UWidget* PageWidget, const FText& ContextDisplayName) {}
 
-	/** Fires after each category header is added to a tab's ScrollBox. */
+	/**
+	 * Fires after each category header is added to a tab's ScrollBox. Virtualized pages
+	 * use UMCore_SettingsSectionHeader entries instead; customize those via K2_OnSectionSet.
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category = "UI|KeyBinding")
 	void OnCategoryHeaderCreated(const FText& CategoryDisplayName, UWidget* HeaderWidget);
 	virtual void OnCategoryHeaderCreated_Implementation(const FText& CategoryDisplayName, UWidget* HeaderWidget) {}
 
-	/** Fires after each row is created and added to a tab's ScrollBox. */
+	/**
+	 * Fires after each row is created and added to a tab's ScrollBox. In virtualized
+	 * pages, fires once per pooled row widget, when the list first generates it.
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category = "UI|KeyBinding")
 	void OnRowCreated(UMCore_KeyBindingRow* Row);
 	virtual void OnRowCreated_Implementation(UMCore_KeyBindingRow* Row) {}
@@ -141,10 +166,29 @@ private:
 	// PANEL BUILD
 	// ====================================================================
 
-	UScrollBox* BuildContextPage(APlayerController* OwningPlayer, const UInputMappingContext* MappingContext);
-	UScrollBox* BuildFallbackPage(APlayerController* OwningPlayer);
+	UWidget* BuildContextPage(APlayerController* OwningPlayer, const UInputMappingContext* MappingContext);
+	UWidget* BuildFallbackPage(APlayerController* OwningPlayer);
+
+	/** Scroll box or list view holding SortedCategories in order. Null if no row was added. */
+	UWidget* BuildBindingPage(APlayerController* OwningPlayer, const TArray<FString>& SortedCategories,
+		const TMap<FString, TArray<const FPlayerKeyMapping*>>& CategorizedActions);
+
 	UCommonTextBlock* CreateThemedCategoryHeader(const FText& CategoryDisplayName);
 
+	/**
+	 * Starts streaming any KeyBindingContexts not yet loaded, once per panel. True while that
+	 * load is pending, in which case HandleContextsLoaded populates the panel.
+	 */
+	bool RequestContextLoad(APlayerController* OwningPlayer);
+	void HandleContextsLoaded(TWeakObjectPtr<APlayerController> WeakOwningPlayer);
+
+	/** Binds the panel to a row's delegates and tracks it in AllRows. */
+	void RegisterRow(UMCore_KeyBindingRow* Row);
+	void UnregisterAllRows();
+
+	/* Virtualized pages: registers each pooled row the first time the list generates it */
+	void HandleListEntryGenerated(UUserWidget& EntryWidget);
+
 	// ====================================================================
 	// TAB CALLBACKS
 	// ====================================================================
@@ -183,6 +227,23 @@ private:
 	UFUNCTION()
 	void HandleCaptureDialogReadyForCapture();
 
+	// ====================================================================
+	// BINDING CHANGES
+	// ====================================================================
+
+	void BindUserSettingsDelegate(APlayerController* OwningPlayer);
+	void UnbindUserSettingsDelegate();
+
+	UFUNCTION()
+	void HandleInputUserSettingsChanged(UEnhancedInputUserSettings* Settings);
+
+	/* Coalesces every change in a frame (a reset remaps each action) into one RefreshChangedRows */
+	void QueueChangedRowRefresh();
+	bool FlushChangedRowRefresh(float DeltaTime);
+
+	/** One pass over the active key profile: per action, an order-independent hash of its slots and keys. */
+	void CaptureBindingSignatures(TMap<TObjectPtr<const UInputAction>, uint32>& OutSignatures) const;
+
 	// ====================================================================
 	// THEME INTERNALS
 	// ====================================================================
@@ -206,12 +267,24 @@ private:
 	// STATE
 	// ====================================================================
 
+	/* Pooled list rows are generated again on every reuse, so membership is checked per generation */
 	UPROPERTY(Transient)
-	TArray<TObjectPtr<UMCore_KeyBindingRow>> AllRows;
+	TSet<TObjectPtr<UMCore_KeyBindingRow>> AllRows;
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UCommonTextBlock>> SpawnedHeaders;
 
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMCore_KeyBindingListView>> ListPages;
+
+	/* Binding signatures as of the last refresh, diffed by RefreshChangedRows */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<const UInputAction>, uint32> BindingSignatures;
+
+	TWeakObjectPtr<UEnhancedInputUserSettings> BoundUserSettings;
+
+	FTSTicker::FDelegateHandle ChangedRowRefreshTicker;
+
 	TWeakObjectPtr<UMCore_ConfirmationDialog> PendingConfirmationDialog;
 
 	TWeakObjectPtr<UMCore_KeyBindingCaptureDialog> ActiveCaptureDialog;
@@ -219,4 +292,9 @@ private:
 	TWeakObjectPtr<UMCore_KeyBindingButton> ActiveCaptureButton;
 
 	FName ActiveContextTabID;
+
+	/* Keeps the configured contexts resident once streamed */
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> ContextLoadHandle;
+	bool bContextLoadRequested{false};
 };
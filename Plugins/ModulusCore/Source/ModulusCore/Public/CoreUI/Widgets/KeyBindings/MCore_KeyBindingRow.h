@@ -11,6 +11,7 @@
 
 #include "CoreMinimal.h"
 #include "CommonUserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "MCore_KeyBindingRow.generated.h"
 
 class UCommonTextBlock;
@@ -31,11 +32,14 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRowRebindResult,
  * Owns 4 KeyBindingButtons and routes capture state and rebind results
  * upward to the owning panel.
  *
+ * Also serves as the recycled entry of a virtualized page (UMCore_KeyBindingListView),
+ * where it re-inits for whichever action row it is bound to.
+ *
  * Requires BindWidget: Txt_ActionName, Btn_KBM_Primary, Btn_KBM_Secondary,
  * Btn_Gamepad_Primary, Btn_Gamepad_Secondary.
  */
 UCLASS(Abstract, Blueprintable, ClassGroup = "ModulusUI", meta = (DisableNativeTick))
-class MODULUSCORE_API UMCore_KeyBindingRow : public UCommonUserWidget
+class MODULUSCORE_API UMCore_KeyBindingRow : public UCommonUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -95,6 +99,7 @@ protected:
 
 	virtual void NativeOnInitialized() override;
 	virtual void NativeDestruct() override;
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
 
 private:
 
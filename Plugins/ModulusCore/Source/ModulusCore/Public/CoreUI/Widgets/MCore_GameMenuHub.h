@@ -10,7 +10,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Primitives/MCore_ActivatableBase.h"
+#include "CoreData/Types/UI/MCore_MenuTabTypes.h"
 #include "MCore_GameMenuHub.generated.h"
 
 class UCommonButtonBase;
@@ -37,12 +39,35 @@ public:
     // ============================================================================
 
     /**
-     * Rebuild tab bar from currently registered screens.
-     * Called by OpenMenuHub() on creation and RegisterMenuScreen() on dynamic registration.
+     * Rebuild tab bar from currently registered screens, recreating every page.
+     * Prefer SyncTabsWithRegisteredScreens() for runtime registration changes.
      */
     UFUNCTION(BlueprintCallable, Category = "Menu Hub")
     void RebuildTabBar();
 
+    /**
+     * Add tabs for newly registered screens and remove tabs for unregistered ones, keeping
+     * existing pages and the selected tab. Tabs re-registered at another priority are moved
+     * (with a new page); tabs whose page fails are retried on the next sync.
+     * Falls back to RebuildTabBar() before a complete build.
+     * Called by UISubsystem once per frame after RegisterMenuScreen()/UnregisterMenuScreen().
+     */
+    UFUNCTION(BlueprintCallable, Category = "Menu Hub")
+    void SyncTabsWithRegisteredScreens();
+
+    /**
+     * Build the registered tabs a slice at a time while the hub is dormant, warming each page.
+     * Restarts the build if registrations changed. Always builds at least one tab per call.
+     * Returns true once every tab is built.
+     */
+    bool WarmUpTabs(double BudgetSeconds);
+
+    /** Finish a partial warm build or sync with changed registrations, then select the first tab. */
+    void EnsureTabBarBuilt();
+
+    int32 GetNumTabsBuilt() const { return NumTabsBuilt; }
+    int32 GetNumTabsPlanned() const { return PlannedTabs.Num(); }
+
     UFUNCTION(BlueprintCallable, Category = "Menu Hub", meta = (Keywords = "Toggle Lock Tab Button"))
     bool SetTabEnabled(FGameplayTag TabID, bool bEnabled);
 
@@ -55,6 +80,14 @@ public:
     UFUNCTION(BlueprintPure, Category = "Menu Hub", meta = (Keywords = "Is Tab Hidden"))
     bool IsTabHidden(FGameplayTag TabID) const;
 
+    /** Construct a tab's page now if it is still a placeholder. Returns true if a page was built. */
+    UFUNCTION(BlueprintCallable, Category = "Menu Hub", meta = (Keywords = "Preload Build Tab Page"))
+    bool PrefetchTabPage(FGameplayTag TabID);
+
+    /** Live and placeholder page counts and approximate live page memory. */
+    UFUNCTION(BlueprintPure, Category = "Menu Hub")
+    FMCore_MenuPageStats GetPageStats() const;
+
     // ============================================================================
     // BLUEPRINT EXTENSION POINTS
     // ============================================================================
@@ -71,6 +104,7 @@ public:
 
 protected:
     virtual void NativeOnInitialized() override;
+    virtual void NativeOnDeactivated() override;
     virtual void NativeDestruct() override;
 
     /* Menu input mode: cursor visible, no capture, full menu navigation */
@@ -88,4 +122,49 @@ protected:
 private:
     UFUNCTION()
     void HandleContainerTabAdded(FName TabID, UCommonButtonBase* TabButton);
+
+    /* Builds a placeholder page before the container shows it */
+    void HandleContainerTabSelecting(FName TabID);
+
+    UFUNCTION()
+    void HandleContainerTabSelected(FName TabID);
+
+    /* Clears the container and plans tabs from the registered screens. False if there is nothing to build. */
+    bool BeginTabBuild();
+
+    /* Builds planned tabs until BudgetSeconds pass; selects the first tab when the last one is built */
+    bool ContinueTabBuild(double BudgetSeconds, bool bWarmPages);
+
+    /* A build was started from exactly the screens registered now */
+    bool IsTabPlanCurrent() const;
+
+    UCommonActivatableWidget* CreateTabPage(const FMCore_MenuTab& Tab);
+    void SelectFirstTab();
+
+    /* Adds Tab at ContainerIndex with its page, or a placeholder when pages are lazy and !bConstructPage */
+    bool AddTabPage(const FMCore_MenuTab& Tab, int32 ContainerIndex, bool bConstructPage, bool bWarmPage);
+
+    bool MaterializeTabPage(FName TabID);
+    bool UnloadTabPage(FName TabID);
+
+    /* Unloads pages past MenuTabPageUnloadSeconds or MaxLiveMenuTabPages; never the selected one */
+    void ApplyPageUnloadPolicy();
+
+    bool TickAdjacentPrefetch(float DeltaTime);
+    void StopAdjacentPrefetch();
+
+    /* Registered screens the tabs were (or are being) built from */
+    UPROPERTY(Transient)
+    TArray<FMCore_MenuTab> PlannedTabs;
+
+    int32 NumTabsBuilt{0};
+    bool bTabBuildStarted{false};
+
+    /* Tabs whose page is still a placeholder */
+    TSet<FName> PlaceholderTabs;
+
+    /* FPlatformTime::Seconds() of each live page's last selection (or construction) */
+    TMap<FName, double> PageLastSelectedTime;
+
+    FTSTicker::FDelegateHandle AdjacentPrefetchTicker;
 };
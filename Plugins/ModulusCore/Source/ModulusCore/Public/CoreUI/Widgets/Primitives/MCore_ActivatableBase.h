@@ -71,6 +71,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="UI|Input")
 	void UnregisterAllBindings();
 
+	/* Let UMCore_UISubsystem keep this widget once closed and reopen the same instance.
+	   Clear for widgets holding per-open state that NativeResetForReuse cannot clear. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="UI|Pooling")
+	bool bAllowPooling{true};
+
+	/** Called by UMCore_UISubsystem before a pooled instance is pushed again. */
+	void ResetForReuse();
+
+	/** Called on a dormant (created, not yet activated) widget to do first-activation work ahead of time. */
+	void WarmUp();
+
 #if WITH_EDITOR
 	// ============================================================================
 	// EDITOR VALIDATION
@@ -108,6 +119,28 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Theme", meta = (DisplayName = "On Theme Applied"))
 	void K2_OnThemeApplied(UMCore_PDA_UITheme_Base* Theme);
 
+	// ============================================================================
+	// POOLING
+	// ============================================================================
+
+	/**
+	 * Return per-open state to what a freshly created instance has. NativeOnInitialized
+	 * does not run again for a pooled instance. Overrides must call Super.
+	 */
+	virtual void NativeResetForReuse();
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|Pooling", meta = (DisplayName = "On Reset For Reuse"))
+	void K2_OnResetForReuse();
+
+	/**
+	 * Build content the first activation would otherwise build, while the widget is off-screen.
+	 * Must be safe to call more than once and must leave the widget as a later activation expects.
+	 */
+	virtual void NativeWarmUp();
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|Pooling", meta = (DisplayName = "On Warm Up"))
+	void K2_OnWarmUp();
+
 	/* Check if activation should be blocked based on OwningPlayer's tags */
 	bool bShouldBlockActivation() const;
 
@@ -54,6 +54,7 @@ protected:
 	virtual void NativeOnDeactivated() override;
 	virtual void NativeDestruct() override;
 	virtual UWidget* NativeGetDesiredFocusTarget() const override;
+	virtual void NativeResetForReuse() override;
 
 	// ============================================================================
 	// CONFIGURATION
@@ -99,4 +100,7 @@ private:
 	FMCore_InputActionBindingHandle BackBindingHandle;
 
 	bool bResolved{false};
+
+	/* Designer text of Txt_DialogMessage, restored when a pooled dialog is reused */
+	FText DefaultDialogMessage;
 };
@@ -15,11 +15,21 @@ UCLASS(Blueprintable, meta = (DisableNativeTick))
 class MODULUSCORE_API UMCore_TabListBase : public UCommonTabListWidgetBase
 {
 	GENERATED_BODY()
-	
+
+public:
+	/**
+	 * Re-slots the buttons of Order[FirstIndex..] after the ones before it, in Order's sequence.
+	 * RegisterTab always appends the new button to the box, whatever index it was given.
+	 */
+	void SyncTabButtonOrder(TConstArrayView<FName> Order, int32 FirstIndex);
+
 protected:
 	virtual void HandleTabCreation_Implementation(FName TabNameID, UCommonButtonBase* TabButton) override;
 	virtual void HandleTabRemoval_Implementation(FName TabNameID, UCommonButtonBase* TabButton) override;
 	
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget))
 	TObjectPtr<UHorizontalBox> HBox_Tabs;
+
+private:
+	void AddTabButtonSlot(UCommonButtonBase* TabButton);
 };
@@ -20,6 +20,7 @@ class UMCore_ActionButton;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTabbedContainerTabAdded, FName, TabID, UCommonButtonBase*, TabButton);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTabbedContainerTabSelected, FName, TabID);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTabbedContainerTabSelecting, FName /*TabID*/);
 
 /**
  * Reusable tabbed container wrapping CommonUI's tab list and animated switcher.
@@ -44,7 +45,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
 	bool AddTab(FName TabID, UWidget* PageWidget);
 
-	/** Remove a tab and its page. Does NOT destroy the page widget. Returns true if found. */
+	/**
+	 * Add a tab at Index in the tab order (clamped; appends past the end). Other tabs and the selection are kept.
+	 * A UMCore_TabListBase moves the button to match; GetTabOrder() is the authoritative order either way.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
+	bool InsertTab(FName TabID, UWidget* PageWidget, int32 Index);
+
+	/**
+	 * Remove a tab and its page. Does NOT destroy the page widget. Returns true if found.
+	 * The selection is kept; removing the selected tab selects its neighbour.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
 	bool RemoveTab(FName TabID);
 
@@ -54,6 +65,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
 	void ClearAllTabs();
 
+	/** Swap a tab's page for another widget, keeping its button, position and the selection. Does NOT destroy the old page. */
+	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
+	bool ReplaceTabPage(FName TabID, UWidget* NewPageWidget);
+
 	/** Select a tab by ID, switching to its page. Returns true if found. */
 	UFUNCTION(BlueprintCallable, Category = "Tabbed Container")
 	bool SelectTab(FName TabID);
@@ -127,6 +142,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Tabbed Container|Events")
 	FOnTabbedContainerTabSelected OnTabSelected;
 
+	/** Fires before a selected tab's page is shown; listeners may ReplaceTabPage() it. */
+	FOnTabbedContainerTabSelecting OnTabSelecting;
+
 protected:
 	virtual void NativeOnInitialized() override;
 	virtual void NativeDestruct() override;
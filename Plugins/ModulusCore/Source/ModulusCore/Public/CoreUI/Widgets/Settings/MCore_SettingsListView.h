@@ -0,0 +1,103 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * MCore_SettingsListView.h
+ *
+ * Virtualized settings page. Each row is a UMCore_SettingsListItem holding a
+ * definition (or a section name); only rows in view get an entry widget, and
+ * entries are recycled per widget class as the page scrolls.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ListView.h"
+#include "GameplayTagContainer.h"
+#include "MCore_SettingsListView.generated.h"
+
+class UMCore_DA_SettingDefinition;
+class UMCore_SettingsWidget_Base;
+
+/**
+ * One row of a virtualized settings page. Holds no value state; entries read the
+ * current value from the settings save whenever they are bound to the row.
+ */
+UCLASS(BlueprintType)
+class MODULUSCORE_API UMCore_SettingsListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/* Null for section headers */
+	UPROPERTY(BlueprintReadOnly, Category = "ModulusCore|Settings")
+	TObjectPtr<const UMCore_DA_SettingDefinition> Definition;
+
+	/* Header text, or the section the setting row belongs to */
+	UPROPERTY(BlueprintReadOnly, Category = "ModulusCore|Settings")
+	FText SectionName;
+
+	UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+	bool IsSectionHeader() const { return Definition == nullptr; }
+};
+
+/**
+ * List view for one leaf settings category. Picks the entry class per row:
+ * the section header class for headers, otherwise the definition's
+ * WidgetClassOverride or the CoreSettings class for its SettingType.
+ * Section headers are skipped by selection and gamepad navigation.
+ */
+UCLASS(ClassGroup = "ModulusUI")
+class MODULUSCORE_API UMCore_SettingsListView : public UListView
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Replaces the rows. A section header is inserted before each run of definitions
+	 * sharing a non-empty SectionName, when CoreSettings has a header class.
+	 */
+	void SetSettingDefinitions(TConstArrayView<const UMCore_DA_SettingDefinition*> Definitions);
+
+	/** Row index of SettingTag, or INDEX_NONE. */
+	int32 FindSettingIndex(const FGameplayTag& SettingTag) const;
+
+	/** Definition shown at Index; null for headers and out-of-range indices. */
+	const UMCore_DA_SettingDefinition* GetDefinitionAt(int32 Index) const;
+
+	/** Selects the row, scrolls it into view and focuses its entry once generated. False if there is no such row. */
+	bool FocusSetting(const FGameplayTag& SettingTag);
+
+	/** FocusSetting for the first non-header row. */
+	bool FocusFirstSetting();
+
+	/** Entries currently bound to rows. Rows scrolled out of view have none. */
+	TArray<UMCore_SettingsWidget_Base*> GetDisplayedSettingWidgets() const;
+
+	/**
+	 * Row class for a definition: WidgetClassOverride, else the CoreSettings
+	 * class for its SettingType. Null if nothing is configured.
+	 */
+	static TSubclassOf<UMCore_SettingsWidget_Base> ResolveSettingWidgetClass(const UMCore_DA_SettingDefinition* Definition);
+
+	/**
+	 * CoreSettings' SettingsListViewClass when virtualized pages are on and it has an
+	 * EntryWidgetClass; null means build a scroll box page instead.
+	 */
+	static TSubclassOf<UMCore_SettingsListView> GetConfiguredClass();
+
+protected:
+	virtual UUserWidget& OnGenerateEntryWidgetInternal(UObject* Item,
+		TSubclassOf<UUserWidget> DesiredEntryClass, const TSharedRef<STableViewBase>& OwnerTable) override;
+
+	virtual bool OnIsSelectableOrNavigableInternal(UObject* FirstSelectedItem) override;
+
+	virtual void OnItemScrolledIntoViewInternal(UObject* Item, UUserWidget& EntryWidget) override;
+
+private:
+	/* Backing array for SetListItems; the list view only holds raw pointers */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMCore_SettingsListItem>> Rows;
+
+	/* Row FocusSetting navigated to; its entry takes focus when it scrolls into view */
+	TWeakObjectPtr<UObject> PendingFocusItem;
+};
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Types/SlateEnums.h"
+#include "CoreData/Settings/MCore_SettingsSearchIndex.h"
 #include "CoreUI/Widgets/Primitives/MCore_ActivatableBase.h"
 #include "MCore_SettingsPanel.generated.h"
 
@@ -14,8 +16,13 @@ class UMCore_ConfirmationDialog;
 class UMCore_SettingsRevertCountdown;
 class UMCore_DA_SettingDefinition;
 class UMCore_SettingsWidget_Base;
+class UMCore_SettingsListView;
 class UCommonTextBlock;
+class UEditableTextBox;
+class UPanelWidget;
 class UScrollBox;
+class UUserWidget;
+struct FMCore_SettingsRegistryChange;
 
 /**
  * Data-driven settings panel for auto-generating category tabs
@@ -25,6 +32,8 @@ class UScrollBox;
  * Depth-3 tags become main tabs (Settings_Category_Video, etc.)
  * If Depth-4 tags >1 sub-tabbing occurs (Settings_Category_Video_Display, Settings_Category_Video_GraphicQuality, etc.)
  * KeyBinding category creates an inline KeyBindingPanel_Base widget instead of setting rows.
+ * With CoreSettings bVirtualizeSettingsLists, leaf pages are UMCore_SettingsListView instead of
+ * scroll boxes: only rows in view have widgets, and rows carry section headers.
  */
 UCLASS()
 class MODULUSCORE_API UMCore_SettingsPanel : public UMCore_ActivatableBase
@@ -36,6 +45,26 @@ public:
 	/** Re-reads current values from the settings library and updates all setting widgets. */
 	UFUNCTION(BlueprintCallable, Category = "Modulus|Settings")
 	void RefreshAllWidgets();
+
+	/** Re-reads only the rows whose stored value changed since they last displayed it. Returns how many refreshed. */
+	UFUNCTION(BlueprintCallable, Category = "Modulus|Settings")
+	int32 RefreshStaleWidgets();
+
+	/**
+	 * Selects the tab (and sub-tab) owning a setting, scrolls its row into view and focuses it.
+	 * Returns false if the panel has no row for SettingTag.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Modulus|Settings")
+	bool JumpToSetting(FGameplayTag SettingTag);
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Builds one page of NumSettings rows (cycling the project's definitions) as a scroll box
+	 * and as a virtualized list (SettingsListViewClass), draws each offscreen at 1080p and logs
+	 * construction time, prepass/arrange/paint time, scroll time and widget counts.
+	 */
+	void RunListBenchmark(int32 NumSettings);
+#endif
  
 protected:
  
@@ -44,6 +73,9 @@ protected:
 	virtual void NativeOnDeactivated() override;
 	virtual void NativeDestruct() override;
 	virtual UWidget* NativeGetDesiredFocusTarget() const override;
+
+	/* Builds the panel while dormant so the first activation only refreshes values */
+	virtual void NativeWarmUp() override;
  
 	// ============================================================================
 	// CONFIGURATION
@@ -60,6 +92,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel")
 	TSubclassOf<UMCore_ConfirmationDialog> ResetConfirmationDialogClass;
 
+	/** Button spawned into Panel_SearchResults for each search hit. Clicking it jumps to the setting. */
+	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel|Search")
+	TSubclassOf<UMCore_ButtonBase> SearchResultButtonClass;
+
+	/** Most search hits listed at once; the buttons are pooled to this count. */
+	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel|Search", meta = (ClampMin = "1"))
+	int32 MaxSearchResults{8};
+
 	// ============================================================================
 	// INPUT ACTIONS
 	// ============================================================================
@@ -82,6 +122,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel|Input Actions")
 	FDataTableRowHandle ResetDefaultsAction;
 
+	/** Optional. Steps back through the player's recent settings changes (see UndoLastSettingsChange). */
+	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel|Input Actions")
+	FDataTableRowHandle UndoSettingsAction;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Settings Panel|Input Actions")
 	FDataTableRowHandle BackAction;
 
@@ -116,6 +160,14 @@ protected:
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
 	TObjectPtr<UMCore_ActionButton> Btn_ActionBack;
 
+	/** Optional search field. Enter jumps to the best match. */
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	TObjectPtr<UEditableTextBox> Input_Search;
+
+	/** Optional container for search result buttons. Collapsed while there are no results. */
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	TObjectPtr<UPanelWidget> Panel_SearchResults;
+
 	// ============================================================================
 	// BLUEPRINT EXTENSION POINTS
 	// ============================================================================
@@ -125,6 +177,11 @@ protected:
 	void OnCategoryPageCreated(const FGameplayTag& CategoryTag,
 		UScrollBox* PageScrollBox);
 	
+	/** Virtualized counterpart of OnCategoryPageCreated. Rows are data here; there are no row widgets to inject into. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Modulus|Settings")
+	void OnCategoryListCreated(const FGameplayTag& CategoryTag,
+		UMCore_SettingsListView* PageListView);
+
 	/** Called after the full panel build completes. All tabs + pages ready */
 	UFUNCTION(BlueprintNativeEvent, Category = "Modulus|Settings")
 	void OnPanelBuildComplete();
@@ -137,7 +194,13 @@ private:
  
 	void BuildPanel();
  
-	UScrollBox* BuildSinglePage(const FGameplayTag& SubcategoryTag);
+	UWidget* BuildSinglePage(const FGameplayTag& SubcategoryTag);
+
+	/** Scroll box or virtualized list for one leaf category, per bVirtualizeSettingsLists. */
+	UWidget* CreateCategoryPage(const FGameplayTag& CategoryTag);
+
+	/** OnCategoryPageCreated or OnCategoryListCreated, by page type. */
+	void NotifyCategoryPageCreated(const FGameplayTag& CategoryTag, UWidget* Page);
 
 	UMCore_TabbedContainer* BuildTabbedPage(
 		const FGameplayTag& ParentTag, const TArray<FGameplayTag>& ChildTags);
@@ -145,6 +208,30 @@ private:
 	void PopulatePage(UScrollBox* ScrollBox, const FGameplayTag& CategoryTag);
  
 	UMCore_SettingsWidget_Base* CreateSettingWidget(const UMCore_DA_SettingDefinition* Definition);
+
+	/** Every setting row widget that exists: all scroll box rows plus the rows each list currently displays. */
+	void ForEachSettingWidget(TFunctionRef<void(UMCore_SettingsWidget_Base&)> Callback) const;
+
+	/** Binds focus for list rows as they are generated; recycled rows are already bound. */
+	void HandleListEntryGenerated(UUserWidget& EntryWidget);
+
+	/** Gamepad navigation moves list selection; show the selected row's description. */
+	void HandleListSelectionChanged(UObject* Item);
+
+	// ============================================================================
+	// REGISTRY HOT RELOAD
+	// ============================================================================
+
+	/** Patches rows and pages for an editor edit to a collection or definition (PIE iteration). */
+	void HandleSettingsRegistryPatched(const FMCore_SettingsRegistryChange& Change);
+
+	/** Clears and repopulates one leaf category page in place. Returns false if the page isn't built. */
+	bool RebuildCategoryPage(const FGameplayTag& CategoryTag);
+
+	void BindRegistryPatchedDelegate();
+	void UnbindRegistryPatchedDelegate();
+
+	FDelegateHandle RegistryPatchedHandle;
  
 	// ============================================================================
 	// TAB CALLBACKS
@@ -180,6 +267,9 @@ private:
 	UFUNCTION()
 	void HandleResetAllInput(FName ActionName);
 
+	UFUNCTION()
+	void HandleUndoInput(FName ActionName);
+
 	// ============================================================================
 	// ACTION BAR
 	// ============================================================================
@@ -205,6 +295,32 @@ private:
 
 	UFUNCTION()
 	void HandleSettingFocused(FGameplayTag SettingTag, FText Description);
+
+	// ============================================================================
+	// SEARCH
+	// ============================================================================
+
+	UFUNCTION()
+	void HandleSearchTextChanged(const FText& Text);
+
+	UFUNCTION()
+	void HandleSearchTextCommitted(const FText& Text, ETextCommit::Type CommitMethod);
+
+	void HandleSearchResultClicked(int32 ResultSlot);
+
+	/* Relabels the pooled result buttons from the current hits. */
+	void RefreshSearchResults();
+
+	void ClearSearch();
+
+	/* Reused across keystrokes; rebinds itself when the subsystem's index is rebuilt */
+	FMCore_SettingsSearchQuery SearchQuery;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMCore_ButtonBase>> SearchResultButtons;
+
+	/* Setting shown on each visible result button, by slot */
+	TArray<FGameplayTag> SearchResultTags;
  
 	// ============================================================================
 	// INTERNAL STATE
@@ -217,12 +333,21 @@ private:
 	 */
 	TMap<FName, FGameplayTag> TabIDToLeafTag;
 
+	/** Maps each depth-4 leaf category tag to the scroll box page holding its rows. */
+	UPROPERTY()
+	TMap<FGameplayTag, TObjectPtr<UScrollBox>> LeafTagToPage;
+
+	/** Maps each depth-4 leaf category tag to its list page (virtualized mode only). */
+	UPROPERTY()
+	TMap<FGameplayTag, TObjectPtr<UMCore_SettingsListView>> LeafTagToListPage;
+
 	/** Maps main tab IDs to their sub-tab container (only for multi-subcategory tabs). */
 	UPROPERTY()
 	TMap<FName, TObjectPtr<UMCore_TabbedContainer>> MainTabToSubContainer;
  
 	FGameplayTag ActiveLeafCategory;
  
+	/** Scroll box rows only; list rows belong to their list's entry pool. */
 	UPROPERTY()
 	TArray<TObjectPtr<UMCore_SettingsWidget_Base>> AllSettingWidgets;
 
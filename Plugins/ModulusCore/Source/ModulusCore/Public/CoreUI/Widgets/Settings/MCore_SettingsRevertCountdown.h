@@ -23,8 +23,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCountdownResult, bool, bConfirmed
 /**
  * Countdown modal for confirmation-required settings.
  * Caller pushes this to the Modal layer and calls StartCountdown with the affected
- * tags and their previous values. The widget handles confirm, revert, and auto-revert
- * on timeout via the existing batch setters with bBypassConfirmation=true.
+ * tags. Confirm saves via ConfirmPendingSettings; revert and timeout restore the
+ * in-memory snapshot captured when the change was made via RevertPendingSettings.
  *
  * Requires BindWidget: Txt_Message, Txt_Countdown, Btn_Confirm, Btn_Revert.
  */
@@ -0,0 +1,46 @@
+// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommonUserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "MCore_SettingsSectionHeader.generated.h"
+
+class UCommonTextBlock;
+class UMCore_PDA_UITheme_Base;
+
+/**
+ * Section header row in a virtualized settings page (UMCore_SettingsListView).
+ * Shows the SectionName shared by the setting rows below it. Not selectable;
+ * gamepad navigation skips straight over it.
+ */
+UCLASS(Abstract, Blueprintable, ClassGroup = "ModulusUI", meta = (DisableNativeTick))
+class MODULUSCORE_API UMCore_SettingsSectionHeader : public UCommonUserWidget, public IUserObjectListEntry
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+	FText GetSectionName() const { return SectionName; }
+
+protected:
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+	virtual void NativeOnInitialized() override;
+	virtual void NativeDestruct() override;
+
+	/** Fires each time the header is bound to a section, including when a pooled header is reused. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "ModulusCore|Settings",
+		meta = (DisplayName = "On Section Set"))
+	void K2_OnSectionSet(const FText& InSectionName);
+
+	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+	TObjectPtr<UCommonTextBlock> Txt_SectionName;
+
+private:
+	/* Applies the theme's heading style to Txt_SectionName */
+	UFUNCTION()
+	void HandleThemeChanged(UMCore_PDA_UITheme_Base* NewTheme);
+
+	FText SectionName;
+};
@@ -11,13 +11,16 @@
 
 #include "CoreMinimal.h"
 #include "CommonUserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "GameplayTagContainer.h"
 #include "MCore_SettingsWidget_Base.generated.h"
 
 class UMCore_DA_SettingDefinition;
 class UMCore_PDA_UITheme_Base;
+class UMCore_PlayerSettingsSave;
 class UCommonTextBlock;
 struct FMCore_EventData;
+struct FMCore_SettingDependencyUpdate;
 
 /**
  * Fired when user changes a setting value.
@@ -37,9 +40,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSettingFocused,
  * Derived classes implement type-specific value handling:
  * - UMCore_SettingsWidget_Slider (float values: volume, brightness, sensitivity)
  * - UMCore_SettingsWidget_Switcher (discrete options: resolution, quality presets)
+ *
+ * Also a list entry, so virtualized pages (UMCore_SettingsListView) recycle rows
+ * across settings of the same widget class.
  */
 UCLASS(Abstract, Blueprintable, ClassGroup= "ModulusUI", meta = (DisableNativeTick))
-class MODULUSCORE_API UMCore_SettingsWidget_Base : public UCommonUserWidget
+class MODULUSCORE_API UMCore_SettingsWidget_Base : public UCommonUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -70,6 +76,20 @@ public:
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "ModulusCore|Settings")
     void RefreshValueFromSettings();
 
+    /**
+     * Calls RefreshValueFromSettings only if the stored value changed since this row last
+     * read it (see UMCore_PlayerSettingsSave::GetValueVersion). Returns true if it refreshed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+    bool RefreshValueIfStale();
+
+    /** RefreshValueFromSettings, recording the source version so later stale checks skip this row. */
+    void RefreshValueAndRecordVersion();
+
+    /** True when the stored value this row displays has a newer version than the one it read. */
+    UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+    bool IsValueStale() const;
+
     /** String representation of current value (for debug/display). */
     UFUNCTION(BlueprintNativeEvent, BlueprintPure, Category = "ModulusCore|Settings")
     FString GetValueAsString() const;
@@ -88,6 +108,16 @@ public:
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "ModulusCore|Settings")
     void StepRight();
 
+    /**
+     * Enables or disables this row. Driven by the definition's DisabledBy dependencies;
+     * re-evaluated on init, on ExternalValueChange and after every commit's dependency pass.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
+    void SetSettingEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintPure, Category = "ModulusCore|Settings")
+    bool IsSettingEnabled() const { return bIsSettingEnabled; }
+
     // ====================================================================
     // EVENTS
     // ====================================================================
@@ -113,6 +143,19 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "ModulusCore|Settings")
     void BroadcastValueChanged();
 
+    /**
+     * Version of everything the displayed value is read from. Default: the definition's
+     * stored value. Override when the display also depends on other save state.
+     */
+    virtual uint64 GetSourceValueVersion() const;
+
+    UMCore_PlayerSettingsSave* GetPlayerSave() const;
+
+    /** Fires when SetSettingEnabled flips the row; style the disabled look here. */
+    UFUNCTION(BlueprintImplementableEvent, Category = "ModulusCore|Settings",
+        meta = (DisplayName = "On Setting Enabled Changed"))
+    void K2_OnSettingEnabledChanged(bool bEnabled);
+
     // ====================================================================
     // BIND WIDGETS
     // ====================================================================
@@ -144,6 +187,9 @@ protected:
     UPROPERTY(Transient)
     mutable TWeakObjectPtr<UMCore_PDA_UITheme_Base> CachedTheme;
 
+    /** Binds a recycled row to its list item's definition; a row returning to the same setting only re-reads stale state. */
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
     virtual void NativePreConstruct() override;
     virtual void NativeOnInitialized() override;
     virtual void NativeDestruct() override;
@@ -158,4 +204,14 @@ private:
     /** Filters local events for MCore.Settings.Event.ExternalValueChange and refreshes display. */
     void HandleLocalEvent(const FMCore_EventData& EventData);
     FDelegateHandle EventSubscriptionHandle;
+
+    /** Refreshes the value or enabled state when a commit's dependency pass touched this setting. */
+    void HandleDependentsUpdated(const FMCore_SettingDependencyUpdate& Update);
+    FDelegateHandle DependentsUpdatedHandle;
+
+    /** List item this row was last bound to in a virtualized page. */
+    TWeakObjectPtr<UObject> BoundListItem;
+
+    /** GetSourceValueVersion() as of the last read; 0 = never read. */
+    uint64 DisplayedValueVersion{0};
 };
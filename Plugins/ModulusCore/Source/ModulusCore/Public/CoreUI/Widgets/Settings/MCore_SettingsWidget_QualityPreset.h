@@ -21,4 +21,7 @@ class MODULUSCORE_API UMCore_SettingsWidget_QualityPreset : public UMCore_Settin
 
 protected:
 	virtual int32 ResolveDisplayedIndex_Implementation() override;
+
+	/* Also stale when the preset intent changes without the stored level changing (e.g. -> Custom). */
+	virtual uint64 GetSourceValueVersion() const override;
 };
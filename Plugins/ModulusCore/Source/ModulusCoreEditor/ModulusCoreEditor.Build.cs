@@ -36,7 +36,9 @@ public class ModulusCoreEditor : ModuleRules
                 "DesktopPlatform",
                 "Projects",
                 "WorkspaceMenuStructure",
-                "Settings"
+                "Settings",
+                "GameplayTags",
+                "AssetRegistry"
             }
         );
     }
@@ -0,0 +1,248 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "Commandlets/ModulusBakeSettingsRegistryCommandlet.h"
+
+#include "CoreEditorLogging/LogModulusEditor.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsCollection.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsRegistry.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	/* Runs Body Iterations times; returns the mean milliseconds per run. Sink keeps the work observable. */
+	double TimeIterations(int32 Iterations, uint32& Sink, TFunctionRef<uint32()> Body)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Sink += Body();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / FMath::Max(Iterations, 1);
+	}
+}
+
+UModulusBakeSettingsRegistryCommandlet::UModulusBakeSettingsRegistryCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UModulusBakeSettingsRegistryCommandlet::Main(const FString& Params)
+{
+	const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+	if (!CoreSettings)
+	{
+		UE_LOG(LogModulusEditor, Error, TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- CoreSettings unavailable"));
+		return 2;
+	}
+
+	FString PackageName;
+	if (!FParse::Value(*Params, TEXT("output="), PackageName))
+	{
+		PackageName = CoreSettings->BakedSettingsRegistry.ToSoftObjectPath().GetLongPackageName();
+	}
+
+	FText PackageError;
+	if (PackageName.IsEmpty() || !FPackageName::IsValidLongPackageName(PackageName, false, &PackageError))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- no valid -output= package and CoreSettings::BakedSettingsRegistry is unset (%s)"),
+			*PackageError.ToString());
+		return 2;
+	}
+
+	const bool bCheckOnly = FParse::Param(*Params, TEXT("check"));
+
+	// ============================================================================
+	// RESOLVE SOURCES
+	// ============================================================================
+
+	const double CollectionLoadStart = FPlatformTime::Seconds();
+	TArray<UMCore_DA_SettingsCollection*> Collections;
+	for (const TSoftObjectPtr<UMCore_DA_SettingsCollection>& SoftRef : CoreSettings->SettingsCollections)
+	{
+		if (SoftRef.IsNull()) { continue; }
+
+		UMCore_DA_SettingsCollection* Loaded = SoftRef.LoadSynchronous();
+		if (!Loaded)
+		{
+			UE_LOG(LogModulusEditor, Error,
+				TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- failed to load collection '%s', refusing to bake a partial registry"),
+				*SoftRef.ToString());
+			return 2;
+		}
+		Collections.Add(Loaded);
+	}
+	const double CollectionLoadMs = (FPlatformTime::Seconds() - CollectionLoadStart) * 1000.0;
+
+	UMCore_DA_SettingsRegistry* Fresh = NewObject<UMCore_DA_SettingsRegistry>(GetTransientPackage());
+	Fresh->BakeFrom(Collections);
+
+	const FString AssetName = FPackageName::GetLongPackageAssetName(PackageName);
+	const FString ObjectPath = PackageName + TEXT(".") + AssetName;
+
+	const double RegistryLoadStart = FPlatformTime::Seconds();
+	UMCore_DA_SettingsRegistry* Existing = LoadObject<UMCore_DA_SettingsRegistry>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn);
+	const double RegistryLoadMs = (FPlatformTime::Seconds() - RegistryLoadStart) * 1000.0;
+
+	/* A stored hash that no longer matches its own content means the asset was edited by hand */
+	const bool bUpToDate = Existing
+		&& Existing->ContentHash == Fresh->ContentHash
+		&& Existing->ComputeContentHash() == Existing->ContentHash;
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- %d collection(s), %d setting(s), %d categor(ies), hash %08x; '%s' is %s"),
+		Collections.Num(), Fresh->Settings.Num(), Fresh->Categories.Num(), Fresh->ContentHash, *ObjectPath,
+		!Existing ? TEXT("missing") : bUpToDate ? TEXT("up to date") : TEXT("stale"));
+
+	int32 BenchmarkIterations = 0;
+	if (FParse::Value(*Params, TEXT("benchmark="), BenchmarkIterations) || FParse::Param(*Params, TEXT("benchmark")))
+	{
+		UE_LOG(LogModulusEditor, Display,
+			TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- first load in process: collections %.3f ms, registry %.3f ms"),
+			CollectionLoadMs, RegistryLoadMs);
+		RunBenchmark(Collections, *Fresh, BenchmarkIterations > 0 ? BenchmarkIterations : 1000);
+	}
+
+	if (bCheckOnly)
+	{
+		if (!bUpToDate)
+		{
+			UE_LOG(LogModulusEditor, Error,
+				TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- '%s' does not match the current collections, re-run without -check"),
+				*ObjectPath);
+			return 1;
+		}
+		return 0;
+	}
+
+	if (bUpToDate)
+	{
+		/* Not rewriting keeps the file byte-identical to the last bake */
+		return 0;
+	}
+
+	// ============================================================================
+	// WRITE
+	// ============================================================================
+
+	UPackage* Package = Existing ? Existing->GetPackage() : CreatePackage(*PackageName);
+	Package->FullyLoad();
+
+	UMCore_DA_SettingsRegistry* Registry = Existing;
+	if (!Registry)
+	{
+		Registry = NewObject<UMCore_DA_SettingsRegistry>(Package, *AssetName, RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Registry);
+	}
+	Registry->BakeFrom(Collections);
+	Package->MarkPackageDirty();
+
+	const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError | SAVE_KeepGUID;
+	if (!UPackage::SavePackage(Package, Registry, *Filename, SaveArgs))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- failed to save '%s'"), *Filename);
+		return 2;
+	}
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusBakeSettingsRegistryCommandlet::Main -- wrote '%s'"), *Filename);
+	return 0;
+}
+
+void UModulusBakeSettingsRegistryCommandlet::RunBenchmark(
+	TConstArrayView<UMCore_DA_SettingsCollection*> Collections,
+	const UMCore_DA_SettingsRegistry& Registry, int32 Iterations)
+{
+	uint32 Sink = 0;
+
+	/* What the subsystem and panel did per build before the bake: bucket, sort, string-parse parents, scan collections per tag */
+	const double SourceMs = TimeIterations(Iterations, Sink, [Collections]()
+	{
+		uint32 Visited = 0;
+
+		TMap<FGameplayTag, int32> CategoryMinSort;
+		for (const UMCore_DA_SettingsCollection* Collection : Collections)
+		{
+			for (const TObjectPtr<UMCore_DA_SettingDefinition>& Setting : Collection->GetAllSettings())
+			{
+				if (!Setting || !Setting->CategoryTag.IsValid()) { continue; }
+				int32& MinSort = CategoryMinSort.FindOrAdd(Setting->CategoryTag, Setting->SortOrder);
+				MinSort = FMath::Min(MinSort, Setting->SortOrder);
+			}
+		}
+
+		TArray<FGameplayTag> Categories;
+		CategoryMinSort.GetKeys(Categories);
+		Categories.Sort([&CategoryMinSort](const FGameplayTag& A, const FGameplayTag& B)
+		{
+			return CategoryMinSort[A] < CategoryMinSort[B];
+		});
+
+		for (const FGameplayTag& CategoryTag : Categories)
+		{
+			const FString TagStr = CategoryTag.ToString();
+			int32 LastDot;
+			if (TagStr.FindLastChar(TEXT('.'), LastDot))
+			{
+				Visited += FGameplayTag::RequestGameplayTag(FName(*TagStr.Left(LastDot)), false).IsValid() ? 1 : 0;
+			}
+
+			TArray<UMCore_DA_SettingDefinition*> Combined;
+			for (const UMCore_DA_SettingsCollection* Collection : Collections)
+			{
+				Combined.Append(Collection->GetSettingsInCategory(CategoryTag));
+			}
+			Combined.Sort([](const UMCore_DA_SettingDefinition& A, const UMCore_DA_SettingDefinition& B)
+			{
+				return A.SortOrder < B.SortOrder;
+			});
+
+			for (const UMCore_DA_SettingDefinition* Setting : Combined)
+			{
+				for (const UMCore_DA_SettingsCollection* Collection : Collections)
+				{
+					if (Collection->FindSettingByTag(Setting->SettingTag))
+					{
+						++Visited;
+						break;
+					}
+				}
+			}
+		}
+		return Visited;
+	});
+
+	const double BakedMs = TimeIterations(Iterations, Sink, [&Registry]()
+	{
+		uint32 Visited = 0;
+		for (const FMCore_BakedSettingCategory& Category : Registry.Categories)
+		{
+			Visited += Category.ParentTag.IsValid() ? 1 : 0;
+			for (const int32 Ordinal : Category.SettingOrdinals)
+			{
+				const UMCore_DA_SettingDefinition* Setting = Registry.Settings[Ordinal].Definition;
+				Visited += Setting && Registry.FindOrdinalByTag(Setting->SettingTag) != INDEX_NONE ? 1 : 0;
+			}
+		}
+		return Visited;
+	});
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusBakeSettingsRegistryCommandlet::RunBenchmark -- %d iteration(s): collections %.4f ms, baked %.4f ms per full category/tag pass (x%.1f, sink %u)"),
+		Iterations, SourceMs, BakedMs, BakedMs > 0.0 ? SourceMs / BakedMs : 0.0, Sink);
+}
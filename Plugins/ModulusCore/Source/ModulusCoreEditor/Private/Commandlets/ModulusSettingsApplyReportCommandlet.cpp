@@ -0,0 +1,89 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "Commandlets/ModulusSettingsApplyReportCommandlet.h"
+
+#include "CoreEditorLogging/LogModulusEditor.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Settings/MCore_SettingsApplyTelemetry.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	FString FindNewestApplyCostCsv()
+	{
+		const FString Directory = FPaths::ProfilingDir() / TEXT("ModulusSettings");
+
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(Directory / TEXT("ApplyCost-*.csv")), true, false);
+
+		FString Newest;
+		FDateTime NewestTime = FDateTime::MinValue();
+		for (const FString& File : Files)
+		{
+			const FString FullPath = Directory / File;
+			const FDateTime Stamp = IFileManager::Get().GetTimeStamp(*FullPath);
+			if (Stamp > NewestTime)
+			{
+				NewestTime = Stamp;
+				Newest = FullPath;
+			}
+		}
+		return Newest;
+	}
+}
+
+UModulusSettingsApplyReportCommandlet::UModulusSettingsApplyReportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UModulusSettingsApplyReportCommandlet::Main(const FString& Params)
+{
+	FString CsvPath;
+	if (!FParse::Value(*Params, TEXT("csv="), CsvPath))
+	{
+		CsvPath = FindNewestApplyCostCsv();
+	}
+
+	if (CsvPath.IsEmpty())
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsApplyReportCommandlet::Main -- no -csv= given and no ApplyCost-*.csv found under Saved/Profiling/ModulusSettings"));
+		return 2;
+	}
+
+	float BudgetMs = 0.0f;
+	if (!FParse::Value(*Params, TEXT("budget="), BudgetMs))
+	{
+		const UMCore_CoreSettings* CoreSettings = UMCore_CoreSettings::Get();
+		BudgetMs = CoreSettings ? CoreSettings->SettingApplyBudgetMs : 0.0f;
+	}
+
+	TArray<FMCore_SettingApplyCost> Costs;
+	if (!FMCore_SettingsApplyTelemetry::ReadCsv(CsvPath, Costs))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsApplyReportCommandlet::Main -- could not read '%s'"), *CsvPath);
+		return 2;
+	}
+
+	const TArray<FMCore_SettingApplyCost> OverBudget = FMCore_SettingsApplyTelemetry::FilterOverBudget(Costs, BudgetMs);
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusSettingsApplyReportCommandlet::Main -- '%s': %d of %d entries over %.3f ms"),
+		*CsvPath, OverBudget.Num(), Costs.Num(), BudgetMs);
+
+	for (const FMCore_SettingApplyCost& Cost : OverBudget)
+	{
+		UE_LOG(LogModulusEditor, Warning,
+			TEXT("  %s [%s] max %.3f ms, avg %.3f ms over %u call(s)"),
+			*Cost.SettingTag, LexToString(Cost.Phase), Cost.MaxMs, Cost.GetAverageMs(), Cost.CallCount);
+	}
+
+	return OverBudget.Num() > 0 ? 1 : 0;
+}
@@ -0,0 +1,702 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+#include "Commandlets/ModulusSettingsBenchmarkCommandlet.h"
+
+#include "CoreEditorLogging/LogModulusEditor.h"
+#include "CoreData/DevSettings/MCore_CoreSettings.h"
+#include "CoreData/Libraries/MCore_GameSettingsLibrary.h"
+#include "CoreData/Settings/MCore_PlayerSettingsSubsystem.h"
+#include "CoreData/Settings/MCore_SettingDependencyGraph.h"
+#include "CoreData/Settings/MCore_SettingsCollectionSubsystem.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingDefinition.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsCollection.h"
+#include "CoreData/Types/Settings/MCore_DA_SettingsRegistry.h"
+#include "CoreData/Types/Settings/MCore_PlayerSettingsSave.h"
+
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/GameUserSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayTagsManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const TCHAR* const SettingTagFormat = TEXT("MCore.Settings.Benchmark.Setting.S%05d");
+	const TCHAR* const CategoryTagFormat = TEXT("MCore.Settings.Benchmark.Category.C%04d");
+	const TCHAR* const ConsoleVariableFormat = TEXT("modulus.benchmark.Var%02d");
+
+	constexpr int32 SettingsPerCategory = 25;
+	constexpr int32 NumConsoleVariables = 32;
+
+	/* Keeps the benchmark's save slot away from the real player 0 slot */
+	constexpr int32 BenchmarkControllerId = 31;
+
+	int32 GetNumCategories(int32 NumDefinitions)
+	{
+		return FMath::DivideAndRoundUp(FMath::Max(NumDefinitions, 1), SettingsPerCategory);
+	}
+
+	/**
+	 * Runs Prepare then Body Iterations times, timing only Body. One untimed warm-up
+	 * pass goes first so first-touch allocation does not land in the numbers.
+	 * Sink keeps the work observable.
+	 */
+	FModulusSettingsBenchmarkResult MeasureOperation(int32 NumDefinitions, const TCHAR* Operation,
+		int32 Iterations, int32 OpsPerIteration, uint32& Sink,
+		TFunctionRef<void()> Prepare, TFunctionRef<uint32()> Body)
+	{
+		FModulusSettingsBenchmarkResult Result;
+		Result.NumDefinitions = NumDefinitions;
+		Result.Operation = Operation;
+		Result.Iterations = Iterations;
+		Result.OpsPerIteration = OpsPerIteration;
+		Result.MinMs = TNumericLimits<double>::Max();
+
+		Prepare();
+		Sink += Body();
+
+		double TotalMs = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Prepare();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Sink += Body();
+			const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			TotalMs += Ms;
+			Result.MinMs = FMath::Min(Result.MinMs, Ms);
+			Result.MaxMs = FMath::Max(Result.MaxMs, Ms);
+		}
+		Result.MeanMs = TotalMs / FMath::Max(Iterations, 1);
+
+		UE_LOG(LogModulusEditor, Display, TEXT("  %-32s %6d %12.4f %12.4f %12.4f"),
+			Operation, OpsPerIteration, Result.MeanMs, Result.MinMs, Result.MaxMs);
+		return Result;
+	}
+}
+
+UModulusSettingsBenchmarkCommandlet::UModulusSettingsBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UModulusSettingsBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString SizesString = TEXT("100,1000,10000");
+	FParse::Value(*Params, TEXT("sizes="), SizesString, false);
+
+	TArray<FString> SizeTokens;
+	SizesString.ParseIntoArray(SizeTokens, TEXT(","));
+
+	TArray<int32> Sizes;
+	for (const FString& Token : SizeTokens)
+	{
+		const int32 Size = FCString::Atoi(*Token);
+		if (Size <= 0)
+		{
+			UE_LOG(LogModulusEditor, Error,
+				TEXT("ModulusSettingsBenchmarkCommandlet::Main -- invalid size '%s' in -sizes="), *Token);
+			return 2;
+		}
+		Sizes.AddUnique(Size);
+	}
+	if (Sizes.IsEmpty())
+	{
+		UE_LOG(LogModulusEditor, Error, TEXT("ModulusSettingsBenchmarkCommandlet::Main -- -sizes= lists no sizes"));
+		return 2;
+	}
+	Sizes.Sort();
+
+	int32 Iterations = 20;
+	FParse::Value(*Params, TEXT("iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	double ThresholdPercent = 10.0;
+	FParse::Value(*Params, TEXT("threshold="), ThresholdPercent);
+	double FloorMs = 0.05;
+	FParse::Value(*Params, TEXT("floor="), FloorMs);
+
+	/* Read the baseline up front so a bad path fails before minutes of timing */
+	FString BaselinePath;
+	TArray<FModulusSettingsBenchmarkResult> Baseline;
+	if (FParse::Value(*Params, TEXT("baseline="), BaselinePath) && !ReadJson(BaselinePath, Baseline))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::Main -- could not read baseline '%s'"), *BaselinePath);
+		return 2;
+	}
+
+	const FString Stamp = FDateTime::Now().ToString();
+	const FString OutputDirectory = FPaths::ProfilingDir() / TEXT("ModulusSettings");
+	FString CsvPath = OutputDirectory / FString::Printf(TEXT("Benchmark-%s.csv"), *Stamp);
+	FString JsonPath = OutputDirectory / FString::Printf(TEXT("Benchmark-%s.json"), *Stamp);
+	FParse::Value(*Params, TEXT("csv="), CsvPath);
+	FParse::Value(*Params, TEXT("json="), JsonPath);
+
+	if (FApp::CanEverRender())
+	{
+		UE_LOG(LogModulusEditor, Warning,
+			TEXT("ModulusSettingsBenchmarkCommandlet::Main -- rendering is enabled; pass -nullrhi for numbers comparable across machines"));
+	}
+
+	// ============================================================================
+	// RUN
+	// ============================================================================
+
+	if (!SetUpEnvironment(Sizes.Last()))
+	{
+		TearDownEnvironment();
+		return 2;
+	}
+
+	TArray<FModulusSettingsBenchmarkResult> Results;
+	for (const int32 Size : Sizes)
+	{
+		RunSize(Size, Iterations, Results);
+	}
+
+	TearDownEnvironment();
+
+	// ============================================================================
+	// REPORT
+	// ============================================================================
+
+	if (!WriteCsv(CsvPath, Results) || !WriteJson(JsonPath, Results))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::Main -- failed to write '%s' / '%s'"), *CsvPath, *JsonPath);
+		return 2;
+	}
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusSettingsBenchmarkCommandlet::Main -- %d result(s) written to '%s' and '%s'"),
+		Results.Num(), *CsvPath, *JsonPath);
+
+	if (BaselinePath.IsEmpty())
+	{
+		return 0;
+	}
+
+	const int32 NumRegressions = CompareToBaseline(Results, Baseline, ThresholdPercent, FloorMs);
+	if (NumRegressions > 0)
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::Main -- %d operation(s) regressed against '%s' (> %.1f%% and > %.3f ms)"),
+			NumRegressions, *BaselinePath, ThresholdPercent, FloorMs);
+		return 1;
+	}
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusSettingsBenchmarkCommandlet::Main -- no regressions against '%s'"), *BaselinePath);
+	return 0;
+}
+
+// ============================================================================
+// ENVIRONMENT
+// ============================================================================
+
+bool UModulusSettingsBenchmarkCommandlet::SetUpEnvironment(int32 MaxDefinitions)
+{
+	/* Tags come from a generated ini on a private search path; RemoveTagIniSearchPath drops them again */
+	const int32 MaxCategories = GetNumCategories(MaxDefinitions);
+	TagIniDirectory = FPaths::ProjectIntermediateDir() / TEXT("ModulusSettingsBenchmark") / TEXT("Tags");
+
+	FString TagIni = TEXT("[/Script/GameplayTags.GameplayTagsList]\n");
+	for (int32 Index = 0; Index < MaxCategories; ++Index)
+	{
+		TagIni += FString::Printf(TEXT("+GameplayTagList=(Tag=\"%s\",DevComment=\"\")\n"),
+			*FString::Printf(CategoryTagFormat, Index));
+	}
+	for (int32 Index = 0; Index < MaxDefinitions; ++Index)
+	{
+		TagIni += FString::Printf(TEXT("+GameplayTagList=(Tag=\"%s\",DevComment=\"\")\n"),
+			*FString::Printf(SettingTagFormat, Index));
+	}
+
+	if (!FFileHelper::SaveStringToFile(TagIni, *(TagIniDirectory / TEXT("ModulusSettingsBenchmark.ini"))))
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::SetUpEnvironment -- could not write tag ini under '%s'"), *TagIniDirectory);
+		return false;
+	}
+	UGameplayTagsManager::Get().AddTagIniSearchPath(TagIniDirectory);
+
+	for (int32 Index = 0; Index < MaxCategories; ++Index)
+	{
+		CategoryTags.Add(FGameplayTag::RequestGameplayTag(FName(FString::Printf(CategoryTagFormat, Index)), false));
+	}
+	for (int32 Index = 0; Index < MaxDefinitions; ++Index)
+	{
+		SettingTags.Add(FGameplayTag::RequestGameplayTag(FName(FString::Printf(SettingTagFormat, Index)), false));
+	}
+	if (!SettingTags.Last().IsValid() || !CategoryTags.Last().IsValid())
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::SetUpEnvironment -- generated gameplay tags did not register"));
+		return false;
+	}
+
+	for (int32 Index = 0; Index < NumConsoleVariables; ++Index)
+	{
+		const FString Name = FString::Printf(ConsoleVariableFormat, Index);
+		IConsoleManager::Get().RegisterConsoleVariable(*Name, 0.0f,
+			TEXT("Apply target for ModulusSettingsBenchmark; removed when the run ends."), ECVF_Default);
+		ConsoleVariableNames.Add(FName(*Name));
+	}
+
+	// ============================================================================
+	// DEFINITIONS
+	// ============================================================================
+
+	static const FName FrameRateLimitSetter(TEXT("FrameRateLimit"));
+	static const FName VSyncSetter(TEXT("bUseVSync"));
+	const TArray<FName> ScalabilityGroups = UMCore_GameSettingsLibrary::GetScalabilityGroupNames();
+
+	const TArray<FText> DropdownOptions = {
+		FText::FromString(TEXT("Low")), FText::FromString(TEXT("Medium")),
+		FText::FromString(TEXT("High")), FText::FromString(TEXT("Epic")) };
+
+	Definitions.Reserve(MaxDefinitions);
+	for (int32 Index = 0; Index < MaxDefinitions; ++Index)
+	{
+		UMCore_DA_SettingDefinition* Definition = NewObject<UMCore_DA_SettingDefinition>(GetTransientPackage());
+		Definition->SettingTag = SettingTags[Index];
+		Definition->DisplayName = FText::FromString(FString::Printf(TEXT("Benchmark Setting %d"), Index));
+		Definition->CategoryTag = CategoryTags[Index / SettingsPerCategory];
+		Definition->SortOrder = Index % SettingsPerCategory;
+
+		/* Types rotate Slider / Toggle / Dropdown */
+		switch (Index % 3)
+		{
+		case 0:
+			Definition->SettingType = EMCore_SettingType::Slider;
+			Definition->MinValue = 0.0f;
+			Definition->MaxValue = 100.0f;
+			Definition->StepSize = 1.0f;
+			Definition->DefaultValue = 50.0f;
+			break;
+		case 1:
+			Definition->SettingType = EMCore_SettingType::Toggle;
+			Definition->DefaultToggleValue = (Index % 2) == 0;
+			break;
+		default:
+			Definition->SettingType = EMCore_SettingType::Dropdown;
+			Definition->DropdownOptions = DropdownOptions;
+			Definition->DefaultDropdownIndex = 1;
+			break;
+		}
+
+		/* Targets: 5 of 8 console variables, 1 of 8 GameUserSettings, the rest save-only.
+		 * GameUserSettings dropdowns rotate through the scalability groups, which is what
+		 * the batched/unbatched boot apply comparison exercises. */
+		const int32 TargetSlot = Index % 8;
+		if (TargetSlot < 5)
+		{
+			Definition->ConsoleVariable = ConsoleVariableNames[Index % NumConsoleVariables];
+		}
+		else if (TargetSlot == 5)
+		{
+			Definition->NamedSetter = Definition->SettingType == EMCore_SettingType::Slider ? FrameRateLimitSetter
+				: Definition->SettingType == EMCore_SettingType::Toggle ? VSyncSetter
+				: ScalabilityGroups[(Index / 8) % ScalabilityGroups.Num()];
+		}
+
+		Definitions.Add(Definition);
+	}
+
+	// ============================================================================
+	// GAME INSTANCE
+	// ============================================================================
+
+	UMCore_CoreSettings* CoreSettings = GetMutableDefault<UMCore_CoreSettings>();
+	OriginalCollections = CoreSettings->SettingsCollections;
+	bOriginalUseBakedRegistry = CoreSettings->bUseBakedSettingsRegistryInEditor;
+	CoreSettings->bUseBakedSettingsRegistryInEditor = false;
+	CoreSettings->SettingsCollections.Reset();
+
+	/* Commandlets count as editor, where scalability writes are skipped by default */
+	bOriginalApplyScalabilityInPIE = CoreSettings->bApplyScalabilitySettingsInPIE;
+	CoreSettings->bApplyScalabilitySettingsInPIE = true;
+
+	if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+	{
+		OriginalFrameRateLimit = GUS->GetFrameRateLimit();
+		bOriginalVSync = GUS->IsVSyncEnabled();
+		OriginalScalabilityQuality = GUS->ScalabilityQuality;
+	}
+
+	/* Standalone instance registers a Game world context, which is what CoreSettings and the library resolve through */
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+
+	FString PlayerError;
+	ULocalPlayer* LocalPlayer = GameInstance->CreateLocalPlayer(BenchmarkControllerId, PlayerError, false);
+	if (!LocalPlayer)
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::SetUpEnvironment -- could not create a local player: %s"), *PlayerError);
+		return false;
+	}
+
+	/* Bare controller link; SetPlayer would pull in input and viewport setup the library never touches */
+	PlayerController = GameInstance->GetWorld()->SpawnActor<APlayerController>();
+	PlayerController->Player = LocalPlayer;
+	LocalPlayer->PlayerController = PlayerController;
+
+	const UMCore_PlayerSettingsSubsystem* PlayerSettings = LocalPlayer->GetSubsystem<UMCore_PlayerSettingsSubsystem>();
+	if (!PlayerSettings)
+	{
+		UE_LOG(LogModulusEditor, Error,
+			TEXT("ModulusSettingsBenchmarkCommandlet::SetUpEnvironment -- PlayerSettingsSubsystem did not initialize"));
+		return false;
+	}
+	SaveSlotName = PlayerSettings->GetSettingsSaveSlotName();
+
+	/* A crashed earlier run may have left its slot behind */
+	UMCore_PlayerSettingsSave::DeletePlayerSettings(SaveSlotName);
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusSettingsBenchmarkCommandlet::SetUpEnvironment -- %d definition(s), %d categor(ies), %d console variable(s), slot '%s'"),
+		MaxDefinitions, MaxCategories, NumConsoleVariables, *SaveSlotName);
+	return true;
+}
+
+void UModulusSettingsBenchmarkCommandlet::TearDownEnvironment()
+{
+	if (!SaveSlotName.IsEmpty())
+	{
+		UMCore_PlayerSettingsSave::DeletePlayerSettings(SaveSlotName);
+	}
+
+	if (GameInstance)
+	{
+		UWorld* World = GameInstance->GetWorld();
+		GameInstance->Shutdown();
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+		GameInstance = nullptr;
+		PlayerController = nullptr;
+	}
+
+	/* The applied-value cache is keyed by definition pointer; none of ours may outlive the run there */
+	UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache();
+
+	UMCore_CoreSettings* CoreSettings = GetMutableDefault<UMCore_CoreSettings>();
+	CoreSettings->SettingsCollections = OriginalCollections;
+	CoreSettings->bUseBakedSettingsRegistryInEditor = bOriginalUseBakedRegistry;
+	CoreSettings->bApplyScalabilitySettingsInPIE = bOriginalApplyScalabilityInPIE;
+
+	if (!Definitions.IsEmpty())
+	{
+		if (UGameUserSettings* GUS = UGameUserSettings::GetGameUserSettings())
+		{
+			GUS->SetFrameRateLimit(OriginalFrameRateLimit);
+			GUS->SetVSyncEnabled(bOriginalVSync);
+			GUS->ScalabilityQuality = OriginalScalabilityQuality;
+			GUS->ApplySettings(false);
+		}
+	}
+
+	for (const FName& Name : ConsoleVariableNames)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(*Name.ToString(), false);
+	}
+	ConsoleVariableNames.Reset();
+
+	if (!TagIniDirectory.IsEmpty())
+	{
+		UGameplayTagsManager::Get().RemoveTagIniSearchPath(TagIniDirectory);
+		IFileManager::Get().DeleteDirectory(*TagIniDirectory, false, true);
+	}
+
+	Collection = nullptr;
+	Definitions.Reset();
+	SettingTags.Reset();
+	CategoryTags.Reset();
+}
+
+void UModulusSettingsBenchmarkCommandlet::InstallSyntheticCollection(int32 NumDefinitions)
+{
+	Collection = NewObject<UMCore_DA_SettingsCollection>(GetTransientPackage(),
+		MakeUniqueObjectName(GetTransientPackage(), UMCore_DA_SettingsCollection::StaticClass(),
+			*FString::Printf(TEXT("ModulusSettingsBenchmark_%d"), NumDefinitions)));
+	Collection->CollectionName = FText::FromString(FString::Printf(TEXT("Benchmark (%d)"), NumDefinitions));
+	Collection->Settings.Append(Definitions.GetData(), NumDefinitions);
+	for (int32 Index = 0; Index < GetNumCategories(NumDefinitions); ++Index)
+	{
+		Collection->CategoryDisplayName.Add(CategoryTags[Index],
+			FText::FromString(FString::Printf(TEXT("Benchmark Category %d"), Index)));
+	}
+
+	/* Transient objects resolve by path while alive, so the soft reference loads without a package */
+	GetMutableDefault<UMCore_CoreSettings>()->SettingsCollections = { TSoftObjectPtr<UMCore_DA_SettingsCollection>(Collection) };
+
+	if (UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(PlayerController))
+	{
+		Collections->InvalidateCollectionCache();
+	}
+	UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache();
+	UMCore_GameSettingsLibrary::ClearSettingsUndoHistory(PlayerController);
+}
+
+// ============================================================================
+// OPERATIONS
+// ============================================================================
+
+void UModulusSettingsBenchmarkCommandlet::RunSize(int32 NumDefinitions, int32 Iterations,
+	TArray<FModulusSettingsBenchmarkResult>& OutResults)
+{
+	InstallSyntheticCollection(NumDefinitions);
+
+	const UObject* WorldContext = PlayerController;
+	UMCore_SettingsCollectionSubsystem* Collections = UMCore_SettingsCollectionSubsystem::Get(WorldContext);
+	UMCore_PlayerSettingsSubsystem* PlayerSettings =
+		PlayerController->GetLocalPlayer()->GetSubsystem<UMCore_PlayerSettingsSubsystem>();
+	const int32 NumCategories = GetNumCategories(NumDefinitions);
+
+	UE_LOG(LogModulusEditor, Display,
+		TEXT("ModulusSettingsBenchmarkCommandlet::RunSize -- %d definition(s), %d categor(ies), %d iteration(s)"),
+		NumDefinitions, NumCategories, Iterations);
+	UE_LOG(LogModulusEditor, Display, TEXT("  %-32s %6s %12s %12s %12s"),
+		TEXT("Operation"), TEXT("Ops"), TEXT("Mean ms"), TEXT("Min ms"), TEXT("Max ms"));
+
+	uint32 Sink = 0;
+	auto NoPrepare = []() {};
+
+	/* Cold resolve: collections, ordinal table, dependency graph */
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("RegistryBuild"), Iterations, 1, Sink,
+		[Collections]() { Collections->InvalidateCollectionCache(); },
+		[Collections]()
+		{
+			return static_cast<uint32>(Collections->GetAllSettingsCollections().Num()
+				+ Collections->GetDependencyGraph()->NumNodes());
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("RegistryBake"), Iterations, 1, Sink, NoPrepare,
+		[Collections]()
+		{
+			UMCore_DA_SettingsRegistry* Registry = NewObject<UMCore_DA_SettingsRegistry>(GetTransientPackage());
+			Registry->BakeFrom(Collections->GetAllSettingsCollections());
+			return static_cast<uint32>(Registry->Settings.Num());
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("TagLookup"), Iterations, NumDefinitions, Sink, NoPrepare,
+		[this, Collections, NumDefinitions]()
+		{
+			uint32 Found = 0;
+			for (int32 Index = 0; Index < NumDefinitions; ++Index)
+			{
+				Found += Collections->FindSettingDefinitionByTag(SettingTags[Index]) ? 1 : 0;
+			}
+			return Found;
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("GetSettingsForCategory"), Iterations, NumCategories, Sink, NoPrepare,
+		[this, Collections, NumCategories]()
+		{
+			uint32 Found = 0;
+			for (int32 Index = 0; Index < NumCategories; ++Index)
+			{
+				Found += Collections->GetSettingsForCategory(CategoryTags[Index]).Num();
+			}
+			return Found;
+		}));
+
+	/* Index 0 is a console-variable Slider; alternate values so no call is a no-op */
+	TArray<FMCore_FloatSettingChange> Changes;
+	FMCore_FloatSettingChange& Change = Changes.AddDefaulted_GetRef();
+	Change.Setting = Definitions[0];
+	auto FlipValue = [&Change]() { Change.Value = Change.Value == 25.0f ? 75.0f : 25.0f; };
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("SetSettingFloat"), Iterations, 1, Sink, FlipValue,
+		[WorldContext, &Changes]()
+		{
+			UMCore_GameSettingsLibrary::SetSettingFloat(WorldContext, Changes, true);
+			return 1u;
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("UndoLastSettingsChange"), Iterations, 1, Sink,
+		[WorldContext, &Changes, &FlipValue]()
+		{
+			FlipValue();
+			UMCore_GameSettingsLibrary::SetSettingFloat(WorldContext, Changes, true);
+		},
+		[WorldContext]()
+		{
+			return UMCore_GameSettingsLibrary::UndoLastSettingsChange(WorldContext) ? 1u : 0u;
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("ApplyAllSettingsToEngine.Cold"), Iterations, NumDefinitions, Sink,
+		[]() { UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache(); },
+		[WorldContext]()
+		{
+			UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(WorldContext);
+			return 1u;
+		}));
+
+	/* Boot replay with Modulus.Settings.BatchScalabilityPushes=0: every scalability child
+	 * pushes the sg.* family and broadcasts on its own, as before batching */
+	IConsoleVariable* BatchPushesVariable =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("Modulus.Settings.BatchScalabilityPushes"));
+	if (BatchPushesVariable)
+	{
+		BatchPushesVariable->Set(0, ECVF_SetByCode);
+		OutResults.Add(MeasureOperation(NumDefinitions, TEXT("ApplyAllSettingsToEngine.Cold.Unbatched"), Iterations, NumDefinitions, Sink,
+			[]() { UMCore_GameSettingsLibrary::InvalidateAppliedSettingsCache(); },
+			[WorldContext]()
+			{
+				UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(WorldContext);
+				return 1u;
+			}));
+		BatchPushesVariable->Set(1, ECVF_SetByCode);
+	}
+
+	/* Every value already matches what was applied; measures the skip path */
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("ApplyAllSettingsToEngine.Warm"), Iterations, NumDefinitions, Sink, NoPrepare,
+		[WorldContext]()
+		{
+			UMCore_GameSettingsLibrary::ApplyAllSettingsToEngine(WorldContext);
+			return 1u;
+		}));
+
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("Save"), Iterations, 1, Sink, NoPrepare,
+		[PlayerSettings]()
+		{
+			PlayerSettings->GetPlayerSettings()->SaveSettings();
+			return 1u;
+		}));
+
+	/* What the subsystem does on first access: deserialize, then bind to the live ordinal table */
+	OutResults.Add(MeasureOperation(NumDefinitions, TEXT("Load"), Iterations, 1, Sink, NoPrepare,
+		[this, Collections]()
+		{
+			UMCore_PlayerSettingsSave* Loaded = UMCore_PlayerSettingsSave::LoadPlayerSettings(SaveSlotName);
+			Loaded->BindOrdinals(Collections->GetSettingOrdinalTable());
+			return static_cast<uint32>(Loaded->GetCachedSlotName().Len());
+		}));
+
+	UE_LOG(LogModulusEditor, Verbose, TEXT("ModulusSettingsBenchmarkCommandlet::RunSize -- sink %u"), Sink);
+}
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+bool UModulusSettingsBenchmarkCommandlet::WriteCsv(const FString& Path,
+	TConstArrayView<FModulusSettingsBenchmarkResult> Results)
+{
+	FString Csv = TEXT("Size,Operation,Iterations,OpsPerIteration,MeanMs,MinMs,MaxMs\n");
+	for (const FModulusSettingsBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%d,%s,%d,%d,%.4f,%.4f,%.4f\n"),
+			Result.NumDefinitions, *Result.Operation, Result.Iterations, Result.OpsPerIteration,
+			Result.MeanMs, Result.MinMs, Result.MaxMs);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool UModulusSettingsBenchmarkCommandlet::WriteJson(const FString& Path,
+	TConstArrayView<FModulusSettingsBenchmarkResult> Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	for (const FModulusSettingsBenchmarkResult& Result : Results)
+	{
+		const TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetNumberField(TEXT("Size"), Result.NumDefinitions);
+		Entry->SetStringField(TEXT("Operation"), Result.Operation);
+		Entry->SetNumberField(TEXT("Iterations"), Result.Iterations);
+		Entry->SetNumberField(TEXT("OpsPerIteration"), Result.OpsPerIteration);
+		Entry->SetNumberField(TEXT("MeanMs"), Result.MeanMs);
+		Entry->SetNumberField(TEXT("MinMs"), Result.MinMs);
+		Entry->SetNumberField(TEXT("MaxMs"), Result.MaxMs);
+		Entries.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetArrayField(TEXT("Results"), Entries);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	return FJsonSerializer::Serialize(Root, Writer) && FFileHelper::SaveStringToFile(Json, *Path);
+}
+
+bool UModulusSettingsBenchmarkCommandlet::ReadJson(const FString& Path,
+	TArray<FModulusSettingsBenchmarkResult>& OutResults)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Path)) { return false; }
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("Results"), Entries))
+	{
+		return false;
+	}
+
+	OutResults.Reset(Entries->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *Entries)
+	{
+		const TSharedPtr<FJsonObject>* Entry = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(Entry)) { continue; }
+
+		FModulusSettingsBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+		(*Entry)->TryGetNumberField(TEXT("Size"), Result.NumDefinitions);
+		(*Entry)->TryGetStringField(TEXT("Operation"), Result.Operation);
+		(*Entry)->TryGetNumberField(TEXT("Iterations"), Result.Iterations);
+		(*Entry)->TryGetNumberField(TEXT("OpsPerIteration"), Result.OpsPerIteration);
+		(*Entry)->TryGetNumberField(TEXT("MeanMs"), Result.MeanMs);
+		(*Entry)->TryGetNumberField(TEXT("MinMs"), Result.MinMs);
+		(*Entry)->TryGetNumberField(TEXT("MaxMs"), Result.MaxMs);
+	}
+	return true;
+}
+
+int32 UModulusSettingsBenchmarkCommandlet::CompareToBaseline(
+	TConstArrayView<FModulusSettingsBenchmarkResult> Results,
+	TConstArrayView<FModulusSettingsBenchmarkResult> Baseline, double ThresholdPercent, double FloorMs)
+{
+	/* Best-of-N is the least noisy number a single local run produces */
+	int32 NumRegressions = 0;
+	for (const FModulusSettingsBenchmarkResult& Result : Results)
+	{
+		const FModulusSettingsBenchmarkResult* Previous = Baseline.FindByPredicate(
+			[&Result](const FModulusSettingsBenchmarkResult& Candidate)
+			{
+				return Candidate.NumDefinitions == Result.NumDefinitions && Candidate.Operation == Result.Operation;
+			});
+		if (!Previous) { continue; }
+
+		const double DeltaMs = Result.MinMs - Previous->MinMs;
+		const double DeltaPercent = Previous->MinMs > 0.0 ? DeltaMs * 100.0 / Previous->MinMs : 0.0;
+		if (DeltaMs > FloorMs && DeltaPercent > ThresholdPercent)
+		{
+			++NumRegressions;
+			UE_LOG(LogModulusEditor, Warning, TEXT("  %6d %-32s %10.4f -> %10.4f ms (+%.1f%%)"),
+				Result.NumDefinitions, *Result.Operation, Previous->MinMs, Result.MinMs, DeltaPercent);
+		}
+	}
+	return NumRegressions;
+}
@@ -0,0 +1,42 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * ModulusBakeSettingsRegistryCommandlet.h
+ *
+ * Flattens UMCore_CoreSettings::SettingsCollections into a
+ * UMCore_DA_SettingsRegistry asset for cooked builds to load instead.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ModulusBakeSettingsRegistryCommandlet.generated.h"
+
+class UMCore_DA_SettingsCollection;
+class UMCore_DA_SettingsRegistry;
+
+/**
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=ModulusBakeSettingsRegistry [-output=<PackagePath>] [-check] [-benchmark[=<Iterations>]]
+ *
+ * -output defaults to UMCore_CoreSettings::BakedSettingsRegistry.
+ * The asset is only rewritten when its content hash changes, so re-running on
+ * unchanged sources leaves the file byte-identical.
+ * -check bakes in memory and returns 1 if the asset on disk is missing or stale (CI gate).
+ * -benchmark times category/tag lookups over the source collections against the baked registry.
+ */
+UCLASS()
+class UModulusBakeSettingsRegistryCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UModulusBakeSettingsRegistryCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    static void RunBenchmark(TConstArrayView<UMCore_DA_SettingsCollection*> Collections,
+        const UMCore_DA_SettingsRegistry& Registry, int32 Iterations);
+};
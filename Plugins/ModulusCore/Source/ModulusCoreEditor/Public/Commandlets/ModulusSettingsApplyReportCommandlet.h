@@ -0,0 +1,33 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * ModulusSettingsApplyReportCommandlet.h
+ *
+ * Flags settings whose apply cost exceeds the configured budget, from a CSV
+ * written in-game by Modulus.Settings.ApplyCost.WriteCsv.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ModulusSettingsApplyReportCommandlet.generated.h"
+
+/**
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=ModulusSettingsApplyReport -csv=<File> [-budget=<Ms>]
+ *
+ * -csv defaults to the newest ApplyCost-*.csv under Saved/Profiling/ModulusSettings.
+ * -budget defaults to UMCore_CoreSettings::SettingApplyBudgetMs.
+ * Returns 1 when any setting exceeds the budget, so CI can gate on it.
+ */
+UCLASS()
+class UModulusSettingsApplyReportCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UModulusSettingsApplyReportCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,113 @@
+﻿// Copyright 2025, Midnight Pixel Studio LLC. All Rights Reserved
+
+/**
+ * ModulusSettingsBenchmarkCommandlet.h
+ *
+ * Headless timing of the settings pipeline over synthetic collections, so two
+ * builds can be compared on one machine without a GPU or a running game.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GameplayTagContainer.h"
+#include "Scalability.h"
+#include "ModulusSettingsBenchmarkCommandlet.generated.h"
+
+class APlayerController;
+class UGameInstance;
+class UMCore_DA_SettingDefinition;
+class UMCore_DA_SettingsCollection;
+
+/* Timing of one operation at one registry size. */
+struct FModulusSettingsBenchmarkResult
+{
+    int32 NumDefinitions{0};
+    FString Operation;
+    int32 Iterations{0};
+
+    /* Calls made per timed iteration (e.g. one tag lookup per definition) */
+    int32 OpsPerIteration{1};
+
+    double MeanMs{0.0};
+    double MinMs{0.0};
+    double MaxMs{0.0};
+};
+
+/**
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=ModulusSettingsBenchmark -nullrhi [-sizes=100,1000,10000] [-iterations=<N>]
+ *       [-csv=<Path>] [-json=<Path>] [-baseline=<Json>] [-threshold=<Percent>] [-floor=<Ms>]
+ *
+ * Each size gets one generated collection of Slider/Toggle/Dropdown definitions spread over
+ * categories, applying to benchmark-owned console variables, a few GameUserSettings setters,
+ * or nothing (save-only). The collections are swapped into UMCore_CoreSettings for the run and
+ * driven through a standalone GameInstance with one LocalPlayer, so every call goes through the
+ * same library and subsystem paths as the game. Times are wall-clock ms per iteration.
+ *
+ * Timed: registry build, registry bake, tag lookup, GetSettingsForCategory, SetSettingFloat
+ * (end-to-end, including the save), ApplyAllSettingsToEngine (cold, cold with scalability
+ * batching off, and warm), save, load, undo. Cold vs Cold.Unbatched is the boot-time cost of
+ * one sg.* push per pass against one per scalability setting.
+ *
+ * Results go to -csv= / -json= (default Saved/Profiling/ModulusSettings/Benchmark-<Time>.*).
+ * With -baseline=<Json> from an earlier run, returns 1 if any operation's best time grew more
+ * than -threshold percent (default 10) and by more than -floor ms (default 0.05).
+ * Pass -LogCmds="LogModulusSettings Warning" to keep per-save logging out of the timings.
+ */
+UCLASS()
+class UModulusSettingsBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UModulusSettingsBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /* Registers tags and console variables for up to MaxDefinitions and brings up the GameInstance. */
+    bool SetUpEnvironment(int32 MaxDefinitions);
+    void TearDownEnvironment();
+
+    /* Builds one collection of NumDefinitions and points CoreSettings at it. */
+    void InstallSyntheticCollection(int32 NumDefinitions);
+
+    void RunSize(int32 NumDefinitions, int32 Iterations, TArray<FModulusSettingsBenchmarkResult>& OutResults);
+
+    static bool WriteCsv(const FString& Path, TConstArrayView<FModulusSettingsBenchmarkResult> Results);
+    static bool WriteJson(const FString& Path, TConstArrayView<FModulusSettingsBenchmarkResult> Results);
+    static bool ReadJson(const FString& Path, TArray<FModulusSettingsBenchmarkResult>& OutResults);
+
+    /* Logs every operation slower than the baseline past both limits; returns how many. */
+    static int32 CompareToBaseline(TConstArrayView<FModulusSettingsBenchmarkResult> Results,
+        TConstArrayView<FModulusSettingsBenchmarkResult> Baseline, double ThresholdPercent, double FloorMs);
+
+    UPROPERTY(Transient)
+    TObjectPtr<UGameInstance> GameInstance;
+
+    UPROPERTY(Transient)
+    TObjectPtr<APlayerController> PlayerController;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UMCore_DA_SettingsCollection> Collection;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UMCore_DA_SettingDefinition>> Definitions;
+
+    TArray<FGameplayTag> SettingTags;
+    TArray<FGameplayTag> CategoryTags;
+    TArray<FName> ConsoleVariableNames;
+
+    FString TagIniDirectory;
+    FString SaveSlotName;
+
+    /* Restored on teardown */
+    TArray<TSoftObjectPtr<UMCore_DA_SettingsCollection>> OriginalCollections;
+    bool bOriginalUseBakedRegistry{false};
+    float OriginalFrameRateLimit{0.0f};
+    bool bOriginalVSync{false};
+    bool bOriginalApplyScalabilityInPIE{false};
+    Scalability::FQualityLevels OriginalScalabilityQuality;
+};